@@ -0,0 +1,138 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include <chrono>    // std::chrono
+#include <cstdlib>   // EXIT_SUCCESS, EXIT_FAILURE, std::atoi
+#include <iomanip>   // std::setprecision, std::setw
+#include <iostream>  // std::cerr, std::cout, std::endl
+#include <random>    // std::mt19937, std::uniform_real_distribution
+#include <vector>    // std::vector
+
+#include "SPTK/math/matrix.h"
+
+namespace {
+
+const int kDefaultMaxSize(1024);
+
+void FillRandom(std::mt19937* engine, sptk::Matrix* matrix) {
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  const int num_row(matrix->GetNumRow());
+  const int num_column(matrix->GetNumColumn());
+  for (int i(0); i < num_row; ++i) {
+    for (int j(0); j < num_column; ++j) {
+      (*matrix)[i][j] = distribution(*engine);
+    }
+  }
+}
+
+// Reference implementation: the i-j-k triple loop used before blocking.
+void MultiplyNaive(const sptk::Matrix& a, const sptk::Matrix& b,
+                   sptk::Matrix* c) {
+  const int m(a.GetNumRow());
+  const int n(b.GetNumColumn());
+  const int l(a.GetNumColumn());
+  for (int i(0); i < m; ++i) {
+    for (int j(0); j < n; ++j) {
+      double sum(0.0);
+      for (int k(0); k < l; ++k) {
+        sum += a[i][k] * b[k][j];
+      }
+      (*c)[i][j] = sum;
+    }
+  }
+}
+
+template <typename Function>
+double MeasureMilliseconds(Function function) {
+  // Repeat small problems so that each measurement lasts long enough.
+  int num_repetition(1);
+  for (;;) {
+    const auto begin(std::chrono::steady_clock::now());
+    for (int i(0); i < num_repetition; ++i) {
+      function();
+    }
+    const std::chrono::duration<double, std::milli> elapsed(
+        std::chrono::steady_clock::now() - begin);
+    if (100.0 <= elapsed.count() || 1024 <= num_repetition) {
+      return elapsed.count() / num_repetition;
+    }
+    num_repetition *= 2;
+  }
+}
+
+}  // namespace
+
+/**
+ * @a matrix_benchmark [ @e max_size ]
+ *
+ * Compare the running time of sptk::Matrix::operator* with the naive triple
+ * loop for square matrices of size 64, 128, ..., @e max_size (default 1024).
+ * The products are also checked to be bit-identical.
+ *
+ * The program is built only if the CMake option @c SPTK_BUILD_BENCHMARKS is
+ * enabled:
+ *
+ * @code{.sh}
+ *   cmake -DSPTK_BUILD_BENCHMARKS=ON .. && make matrix_benchmark
+ *   ./matrix_benchmark 512
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  const int max_size(1 < argc ? std::atoi(argv[1]) : kDefaultMaxSize);
+  if (max_size < 1) {
+    std::cerr << "usage: matrix_benchmark [max_size]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::mt19937 engine(1);
+  std::cout << std::setw(6) << "size" << std::setw(14) << "naive [ms]"
+            << std::setw(14) << "blocked [ms]" << std::setw(10) << "speedup"
+            << std::endl;
+
+  for (int size(64); size <= max_size; size *= 2) {
+    sptk::Matrix a(size, size);
+    sptk::Matrix b(size, size);
+    sptk::Matrix naive(size, size);
+    sptk::Matrix blocked;
+    FillRandom(&engine, &a);
+    FillRandom(&engine, &b);
+
+    const double naive_time(
+        MeasureMilliseconds([&]() { MultiplyNaive(a, b, &naive); }));
+    const double blocked_time(
+        MeasureMilliseconds([&]() { blocked = a * b; }));
+
+    for (int i(0); i < size; ++i) {
+      for (int j(0); j < size; ++j) {
+        if (naive[i][j] != blocked[i][j]) {
+          std::cerr << "Products differ at (" << i << ", " << j << ")"
+                    << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+
+    std::cout << std::setw(6) << size << std::fixed << std::setprecision(2)
+              << std::setw(14) << naive_time << std::setw(14) << blocked_time
+              << std::setw(10) << naive_time / blocked_time << std::endl;
+  }
+
+  return EXIT_SUCCESS;
+}
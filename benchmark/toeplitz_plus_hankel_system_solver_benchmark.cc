@@ -0,0 +1,269 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include <chrono>    // std::chrono
+#include <cmath>     // std::fabs
+#include <cstdlib>   // EXIT_SUCCESS, EXIT_FAILURE, std::atoi
+#include <iomanip>   // std::setprecision, std::setw
+#include <iostream>  // std::cerr, std::cout, std::endl
+#include <random>    // std::mt19937, std::uniform_real_distribution
+#include <vector>    // std::vector
+
+#include "SPTK/math/matrix2d.h"
+#include "SPTK/math/toeplitz_plus_hankel_system_solver.h"
+
+namespace {
+
+const int kDefaultMaxNumOrder(1024);
+const double kTolerance(1e-9);
+
+void PutBar(int i, const std::vector<double>& x, std::vector<double>* y) {
+  (*y)[0] = x[i];
+  (*y)[1] = x[x.size() - 1 - i];
+}
+
+// Reference implementation: the solver before the inner loops were flattened.
+// Each 2x2 block operation is an out-of-line sptk::Matrix2D call.
+bool SolveWithMatrix2D(int num_order, bool coefficients_modification,
+                       const std::vector<double>& toeplitz_coefficient_vector,
+                       const std::vector<double>& hankel_coefficient_vector,
+                       const std::vector<double>& constant_vector,
+                       std::vector<double>* solution_vector) {
+  const int length(num_order + 1);
+  std::vector<sptk::Matrix2D> r(length);
+  std::vector<sptk::Matrix2D> x(length);
+  std::vector<sptk::Matrix2D> prev_x(length);
+  std::vector<std::vector<double> > p(length, std::vector<double>(2));
+  std::vector<double> ep(2);
+  std::vector<double> g(2);
+  std::vector<double> bar(2);
+  std::vector<double> tmp_vector(2);
+  sptk::Matrix2D vx;
+  sptk::Matrix2D ex;
+  sptk::Matrix2D bx;
+  sptk::Matrix2D inv;
+  sptk::Matrix2D tau;
+  sptk::Matrix2D tmp_matrix;
+
+  // Step 0)
+  const double* t(&(toeplitz_coefficient_vector[0]));
+  const double* h(&(hankel_coefficient_vector[0]));
+  for (int i(0); i < length; ++i) {
+    r[i][0][0] = t[num_order + i];
+    r[i][1][1] = t[num_order - i];
+    r[i][0][1] = h[num_order + i];
+    r[i][1][0] = h[num_order - i];
+  }
+  if (coefficients_modification) {
+    const double d0(t[num_order]);
+    for (int i(0); i < length; i += 2) {
+      r[i][0][0] += d0;
+      r[i][1][1] += d0;
+    }
+    for (int i((0 == num_order % 2) ? 0 : 1); i < length; i += 2) {
+      r[i][0][1] -= d0;
+      r[i][1][0] -= d0;
+    }
+  }
+
+  // Step 1)
+  x[0].FillDiagonal(1.0);
+  PutBar(0, constant_vector, &bar);
+  if (!r[0].Invert(&inv) || !sptk::Matrix2D::Multiply(inv, bar, &p[0])) {
+    return false;
+  }
+  vx = r[0];
+
+  // Step 2)
+  for (int i(1); i < length; ++i) {
+    ex.Fill(0.0);
+    for (int j(0); j < i; ++j) {
+      if (!sptk::Matrix2D::Multiply(r[i - j], x[j], &tmp_matrix) ||
+          !sptk::Matrix2D::Add(tmp_matrix, &ex)) {
+        return false;
+      }
+    }
+
+    ep[0] = 0.0;
+    ep[1] = 0.0;
+    for (int j(0); j < i; ++j) {
+      if (!sptk::Matrix2D::Multiply(r[i - j], p[j], &tmp_vector)) {
+        return false;
+      }
+      ep[0] += tmp_vector[0];
+      ep[1] += tmp_vector[1];
+    }
+
+    if (!vx.CrossTranspose(&tau) || !tau.Invert(&inv) ||
+        !sptk::Matrix2D::Multiply(inv, ex, &bx)) {
+      return false;
+    }
+
+    for (int j(1); j < i; ++j) {
+      if (!prev_x[i - j].CrossTranspose(&tau) ||
+          !sptk::Matrix2D::Multiply(tau, bx, &tmp_matrix) ||
+          !sptk::Matrix2D::Subtract(tmp_matrix, &x[j])) {
+        return false;
+      }
+    }
+    x[i].Negate(bx);
+    for (int j(1); j <= i; ++j) {
+      prev_x[j] = x[j];
+    }
+
+    if (!ex.CrossTranspose(&tau) ||
+        !sptk::Matrix2D::Multiply(tau, bx, &tmp_matrix) ||
+        !sptk::Matrix2D::Subtract(tmp_matrix, &vx)) {
+      return false;
+    }
+
+    if (!vx.CrossTranspose(&tau) || !tau.Invert(&inv)) {
+      return false;
+    }
+    PutBar(i, constant_vector, &bar);
+    tmp_vector[0] = bar[0] - ep[0];
+    tmp_vector[1] = bar[1] - ep[1];
+    if (!sptk::Matrix2D::Multiply(inv, tmp_vector, &g)) {
+      return false;
+    }
+
+    for (int j(0); j < i; ++j) {
+      if (!x[i - j].CrossTranspose(&tau) ||
+          !sptk::Matrix2D::Multiply(tau, g, &tmp_vector)) {
+        return false;
+      }
+      p[j][0] += tmp_vector[0];
+      p[j][1] += tmp_vector[1];
+    }
+    p[i] = g;
+  }
+
+  // Step 3)
+  solution_vector->resize(length);
+  for (int i(0); i < length; ++i) {
+    (*solution_vector)[i] = p[i][0];
+  }
+  return true;
+}
+
+template <typename Function>
+double MeasureMilliseconds(Function function) {
+  // Repeat small problems so that each measurement lasts long enough.
+  int num_repetition(1);
+  for (;;) {
+    const auto begin(std::chrono::steady_clock::now());
+    for (int i(0); i < num_repetition; ++i) {
+      function();
+    }
+    const std::chrono::duration<double, std::milli> elapsed(
+        std::chrono::steady_clock::now() - begin);
+    if (100.0 <= elapsed.count() || 1024 <= num_repetition) {
+      return elapsed.count() / num_repetition;
+    }
+    num_repetition *= 2;
+  }
+}
+
+}  // namespace
+
+/**
+ * @a toeplitz_plus_hankel_system_solver_benchmark [ @e max_order ]
+ *
+ * Compare the running time of sptk::ToeplitzPlusHankelSystemSolver with the
+ * implementation based on sptk::Matrix2D for the orders 16, 32, ...,
+ * @e max_order (default 1024). The solutions are also checked to agree.
+ *
+ * The program is built only if the CMake option @c SPTK_BUILD_BENCHMARKS is
+ * enabled:
+ *
+ * @code{.sh}
+ *   cmake -DSPTK_BUILD_BENCHMARKS=ON .. && \
+ *     make toeplitz_plus_hankel_system_solver_benchmark
+ *   ./toeplitz_plus_hankel_system_solver_benchmark 512
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  const int max_num_order(1 < argc ? std::atoi(argv[1]) : kDefaultMaxNumOrder);
+  if (max_num_order < 1) {
+    std::cerr << "usage: toeplitz_plus_hankel_system_solver_benchmark "
+              << "[max_order]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::mt19937 engine(1);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  std::cout << std::setw(6) << "order" << std::setw(16) << "Matrix2D [ms]"
+            << std::setw(14) << "solver [ms]" << std::setw(10) << "speedup"
+            << std::endl;
+
+  for (int num_order(16); num_order <= max_num_order; num_order *= 2) {
+    // Make the system diagonally dominant so that it is well-conditioned.
+    const int length(num_order + 1);
+    std::vector<double> toeplitz_coefficient_vector(2 * length - 1);
+    std::vector<double> hankel_coefficient_vector(2 * length - 1);
+    std::vector<double> constant_vector(length);
+    for (int i(0); i < 2 * length - 1; ++i) {
+      toeplitz_coefficient_vector[i] = distribution(engine) / length;
+      hankel_coefficient_vector[i] = distribution(engine) / length;
+    }
+    toeplitz_coefficient_vector[num_order] = 4.0;
+    for (int i(0); i < length; ++i) {
+      constant_vector[i] = distribution(engine);
+    }
+
+    sptk::ToeplitzPlusHankelSystemSolver solver(num_order);
+    sptk::ToeplitzPlusHankelSystemSolver::Buffer buffer;
+    std::vector<double> reference;
+    std::vector<double> solution;
+    bool is_succeeded(true);
+
+    const double reference_time(MeasureMilliseconds([&]() {
+      is_succeeded &= SolveWithMatrix2D(
+          num_order, solver.GetCoefficientsModificationFlag(),
+          toeplitz_coefficient_vector, hankel_coefficient_vector,
+          constant_vector, &reference);
+    }));
+    const double solver_time(MeasureMilliseconds([&]() {
+      is_succeeded &=
+          solver.Run(toeplitz_coefficient_vector, hankel_coefficient_vector,
+                     constant_vector, &solution, &buffer);
+    }));
+    if (!is_succeeded) {
+      std::cerr << "Failed to solve the system of order " << num_order
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    for (int i(0); i < length; ++i) {
+      if (kTolerance < std::fabs(reference[i] - solution[i])) {
+        std::cerr << "Solutions differ at " << i << " of order " << num_order
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    std::cout << std::setw(6) << num_order << std::fixed
+              << std::setprecision(3) << std::setw(16) << reference_time
+              << std::setw(14) << solver_time << std::setw(10)
+              << reference_time / solver_time << std::endl;
+  }
+
+  return EXIT_SUCCESS;
+}
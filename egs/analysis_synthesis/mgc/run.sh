@@ -41,9 +41,8 @@ $sptk4/x2x +sd $data |
     $sptk4/pitch -s $sr -p $fp -o 0 > $dump/data.pit
 
 # Synthesis from extracted features.
-$sptk4/excite -p $fp $dump/data.pit |
-    $sptk4/mglsadf -p $fp -m $order -a $alpha -P 7 $dump/data.mgc |
-    $sptk4/x2x +ds -r > $dump/data.syn.raw
+$sptk4/vocoder -p $fp -m $order -a $alpha -P 7 -o 1 \
+    $dump/data.mgc $dump/data.pit > $dump/data.syn.raw
 
 # Fast-speaking voice.
 $sptk4/excite -p $((fp/2)) $dump/data.pit |
@@ -79,6 +79,12 @@ namespace sptk {
  * +-------------------+-------+
  * @endrst
  *
+ * If the warm start is enabled, the correction made by the iteration in the
+ * previous frame, which is kept in the buffer, is added to the initial guess.
+ * Since the spectra of successive frames are similar, the number of iterations
+ * can be reduced. If the iteration does not converge, it is performed again
+ * from the usual initial guess.
+ *
  * Note that the implemenation is based on an unpublished paper.
  */
 class MelCepstralAnalysis {
@@ -105,6 +111,8 @@ class MelCepstralAnalysis {
     std::vector<double> rr_;
     std::vector<double> ra_;
     std::vector<double> gradient_;
+    std::vector<double> initial_mel_cepstrum_;
+    std::vector<double> correction_;
 
     RealValuedFastFourierTransform::Buffer buffer_for_fourier_transform_;
     RealValuedInverseFastFourierTransform::Buffer
@@ -123,9 +131,12 @@ class MelCepstralAnalysis {
    * @param[in] alpha All-pass constant, @f$\alpha@f$.
    * @param[in] num_iteration Number of iterations of Newton method, @f$J@f$.
    * @param[in] convergence_threshold Convergence threshold, @f$\epsilon@f$.
+   * @param[in] warm_start If true, the initial guess is corrected by using
+   *            the result of the previous frame stored in the buffer.
    */
   MelCepstralAnalysis(int fft_length, int num_order, double alpha,
-                      int num_iteration, double convergence_threshold);
+                      int num_iteration, double convergence_threshold,
+                      bool warm_start = false);
 
   virtual ~MelCepstralAnalysis() {
   }
@@ -165,6 +176,13 @@ class MelCepstralAnalysis {
     return convergence_threshold_;
   }
 
+  /**
+   * @return True if warm start is enabled.
+   */
+  bool GetWarmStartFlag() const {
+    return warm_start_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -182,12 +200,30 @@ class MelCepstralAnalysis {
            std::vector<double>* mel_cepstrum,
            MelCepstralAnalysis::Buffer* buffer) const;
 
+  /**
+   * @param[in] periodogram @f$(N/2+1)@f$-length periodogram.
+   * @param[out] mel_cepstrum @f$M@f$-th order mel-cepstral coefficients.
+   * @param[out] num_iteration Number of performed iterations (optional). If
+   *             the warm start fails to converge, the iterations from both
+   *             initial guesses are counted.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& periodogram,
+           std::vector<double>* mel_cepstrum, int* num_iteration,
+           MelCepstralAnalysis::Buffer* buffer) const;
+
  private:
+  bool NewtonRaphsonMethod(std::vector<double>* mel_cepstrum,
+                           int* num_iteration, bool* is_converged,
+                           MelCepstralAnalysis::Buffer* buffer) const;
+
   const int fft_length_;
   const int num_order_;
   const double alpha_;
   const int num_iteration_;
   const double convergence_threshold_;
+  const bool warm_start_;
 
   const RealValuedFastFourierTransform fourier_transform_;
   const RealValuedInverseFastFourierTransform inverse_fourier_transform_;
@@ -17,8 +17,10 @@
 #ifndef SPTK_ANALYSIS_MEL_FILTER_BANK_ANALYSIS_H_
 #define SPTK_ANALYSIS_MEL_FILTER_BANK_ANALYSIS_H_
 
+#include <mutex>   // std::call_once, std::once_flag
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -48,6 +50,12 @@ namespace sptk {
  * @f]
  * where HTK use @f$1127@f$ instead of @f$1127.01048@f$.
  *
+ * The filter banks are held as a sparse matrix in which each channel stores
+ * the weights of the contiguous frequency bins it covers. Multiple frames can
+ * be analyzed at once by giving a matrix of power spectra. A single frame can
+ * also be analyzed in single precision, in which case the single-precision
+ * weights are built at the first call.
+ *
  * [1] S. Young et al., &quot;The HTK book,&quot; Cambridge University
  *     Engineering Department, 2006.
  */
@@ -113,7 +121,31 @@ class MelFilterBankAnalysis {
   bool Run(const std::vector<double>& power_spectrum,
            std::vector<double>* filter_bank_output, double* energy) const;
 
+  /**
+   * @param[in] power_spectrum @f$(N/2+1)@f$-length power spectrum.
+   * @param[out] filter_bank_output @f$C@f$-channel filter-bank outputs.
+   * @param[out] energy Signal energy @f$E@f$ (optional).
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<float>& power_spectrum,
+           std::vector<float>* filter_bank_output, float* energy) const;
+
+  /**
+   * @param[in] power_spectra @f$(N/2+1)@f$-length power spectra.
+   *            The shape is @f$[T, N/2+1]@f$.
+   * @param[out] filter_bank_outputs @f$C@f$-channel filter-bank outputs.
+   *             The shape is @f$[T, C]@f$.
+   * @param[out] energies @f$T@f$ signal energies (optional).
+   * @return True on success, false on failure.
+   */
+  bool Run(const Matrix& power_spectra, Matrix* filter_bank_outputs,
+           std::vector<double>* energies) const;
+
  private:
+  template <typename T>
+  bool Apply(const std::vector<T>& power_spectrum, const T* weights,
+             std::vector<T>* filter_bank_output, T* energy) const;
+
   const int fft_length_;
   const int num_channel_;
   const double floor_;
@@ -123,8 +155,12 @@ class MelFilterBankAnalysis {
 
   int lower_bin_index_;
   int upper_bin_index_;
-  std::vector<int> channel_indices_;
-  std::vector<double> channel_weights_;
+  std::vector<int> first_bin_indices_;
+  std::vector<int> offsets_;
+  std::vector<double> weights_;
+
+  mutable std::once_flag float_weights_flag_;
+  mutable std::vector<float> float_weights_;
 
   DISALLOW_COPY_AND_ASSIGN(MelFilterBankAnalysis);
 };
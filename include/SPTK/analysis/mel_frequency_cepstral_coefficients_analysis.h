@@ -21,6 +21,7 @@
 
 #include "SPTK/analysis/mel_filter_bank_analysis.h"
 #include "SPTK/math/discrete_cosine_transform.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -76,6 +77,8 @@ class MelFrequencyCepstralCoefficientsAnalysis {
     std::vector<double> cepstrum_;
     std::vector<double> imag_part_input_;
     std::vector<double> imag_part_output_;
+    Matrix filter_bank_outputs_;
+    Matrix cepstra_;
 
     DiscreteCosineTransform::Buffer buffer_for_discrete_cosine_transform_;
 
@@ -147,6 +150,18 @@ class MelFrequencyCepstralCoefficientsAnalysis {
            double* energy,
            MelFrequencyCepstralCoefficientsAnalysis::Buffer* buffer) const;
 
+  /**
+   * @param[in] power_spectra @f$(N/2+1)@f$-length power spectra.
+   *            The shape is @f$[T, N/2+1]@f$.
+   * @param[out] mfcc @f$M@f$-th order MFCCs. The shape is @f$[T, M+1]@f$.
+   * @param[out] energies @f$T@f$ signal energies (optional).
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const Matrix& power_spectra, Matrix* mfcc,
+           std::vector<double>* energies,
+           MelFrequencyCepstralCoefficientsAnalysis::Buffer* buffer) const;
+
  private:
   const int num_order_;
   const int liftering_coefficient_;
@@ -68,6 +68,11 @@ namespace sptk {
  * @f[
  *   \tilde{z}^{-1} = \frac{z^{-1} - \alpha}{1 - \alpha z^{-1}}.
  * @f]
+ *
+ * If the warm start is enabled, the iteration of each frame starts from the
+ * coefficients of the previous frame kept in the buffer instead of the
+ * solution of @f$\gamma=-1@f$. If the iteration does not converge, it is
+ * performed again from the usual initial guess.
  */
 class MelGeneralizedCepstralAnalysis {
  public:
@@ -101,6 +106,7 @@ class MelGeneralizedCepstralAnalysis {
     std::vector<double> buffer_for_frequency_transform_;
     std::vector<double> periodogram_;
     std::vector<double> gradient_;
+    std::vector<double> previous_b_;
 
     RealValuedFastFourierTransform::Buffer buffer_for_fourier_transform_;
     RealValuedInverseFastFourierTransform::Buffer
@@ -121,10 +127,13 @@ class MelGeneralizedCepstralAnalysis {
    * @param[in] gamma Exponent parameter, @f$\gamma@f$.
    * @param[in] num_iteration Number of iterations of Newton method, @f$J@f$.
    * @param[in] convergence_threshold Convergence threshold, @f$\epsilon@f$.
+   * @param[in] warm_start If true, the iteration starts from the solution of
+   *            the previous frame stored in the buffer.
    */
   MelGeneralizedCepstralAnalysis(int fft_length, int num_order, double alpha,
                                  double gamma, int num_iteration,
-                                 double convergence_threshold);
+                                 double convergence_threshold,
+                                 bool warm_start = false);
 
   virtual ~MelGeneralizedCepstralAnalysis() {
     if (mel_cepstral_analysis_) delete mel_cepstral_analysis_;
@@ -172,6 +181,13 @@ class MelGeneralizedCepstralAnalysis {
     return convergence_threshold_;
   }
 
+  /**
+   * @return True if warm start is enabled.
+   */
+  bool GetWarmStartFlag() const {
+    return warm_start_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -190,7 +206,23 @@ class MelGeneralizedCepstralAnalysis {
            std::vector<double>* mel_generalized_cepstrum,
            MelGeneralizedCepstralAnalysis::Buffer* buffer) const;
 
+  /**
+   * @param[in] periodogram @f$(N/2+1)@f$-length periodogram.
+   * @param[out] mel_generalized_cepstrum @f$M@f$-th order mel-generalized
+   *             cepstral coefficients.
+   * @param[out] num_iteration Number of performed iterations (optional).
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& periodogram,
+           std::vector<double>* mel_generalized_cepstrum, int* num_iteration,
+           MelGeneralizedCepstralAnalysis::Buffer* buffer) const;
+
  private:
+  bool UpdateCoefficients(
+      double prev_epsilon, int* num_iteration, bool* is_converged,
+      MelGeneralizedCepstralAnalysis::Buffer* buffer) const;
+
   bool NewtonRaphsonMethod(
       double gamma, double* epsilon,
       MelGeneralizedCepstralAnalysis::Buffer* buffer) const;
@@ -201,6 +233,7 @@ class MelGeneralizedCepstralAnalysis {
   const double gamma_;
   const int num_iteration_;
   const double convergence_threshold_;
+  const bool warm_start_;
 
   const RealValuedFastFourierTransform fourier_transform_;
   const RealValuedInverseFastFourierTransform inverse_fourier_transform_;
@@ -20,6 +20,7 @@
 #include <vector>  // std::vector
 
 #include "SPTK/filter/all_zero_digital_filter.h"
+#include "SPTK/math/fast_fourier_transform.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -54,6 +55,12 @@ namespace sptk {
  * @f]
  * is the shifted impulse response of an ideal lowpass filter. The optimal
  * angular frequency @f$\omega@f$ is calculated based on a simple algorithm.
+ *
+ * The signal can also be reconstructed directly from decimated subband
+ * signals. In this case, @f$K@f$ output samples are obtained from a set of
+ * subband samples by overlap-adding the modulated prototype filter, where the
+ * cosine modulation is computed by @f$2K@f$-point FFT if @f$K@f$ is a power
+ * of two.
  */
 class InversePseudoQuadratureMirrorFilterBanks {
  public:
@@ -76,6 +83,12 @@ class InversePseudoQuadratureMirrorFilterBanks {
    private:
     std::vector<AllZeroDigitalFilter::Buffer*> buffer_for_all_zero_filter_;
 
+    std::vector<double> signal_;
+    std::vector<double> real_part_input_;
+    std::vector<double> imag_part_input_;
+    std::vector<double> real_part_output_;
+    std::vector<double> imag_part_output_;
+
     friend class InversePseudoQuadratureMirrorFilterBanks;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
   };
@@ -135,14 +148,35 @@ class InversePseudoQuadratureMirrorFilterBanks {
   bool Run(const std::vector<double>& input, double* output,
            InversePseudoQuadratureMirrorFilterBanks::Buffer* buffer) const;
 
+  /**
+   * Reconstruct signal from decimated subband signals. The outputs are the
+   * same as those of the above function given the input followed by
+   * @f$K-1@f$ zero vectors.
+   *
+   * @param[in] input Decimated subband signals.
+   * @param[out] output @f$K@f$ output samples.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& input, std::vector<double>* output,
+           InversePseudoQuadratureMirrorFilterBanks::Buffer* buffer) const;
+
  private:
   const int num_subband_;
   const AllZeroDigitalFilter all_zero_filter_;
+  const FastFourierTransform fast_fourier_transform_;
 
   bool is_valid_;
   bool is_converged_;
   std::vector<std::vector<double> > filter_banks_;
 
+  std::vector<double> prototype_filter_;
+  std::vector<double> pre_twiddle_real_part_;
+  std::vector<double> pre_twiddle_imag_part_;
+  std::vector<double> post_twiddle_real_part_;
+  std::vector<double> post_twiddle_imag_part_;
+  std::vector<std::vector<double> > modulation_matrix_;
+
   DISALLOW_COPY_AND_ASSIGN(InversePseudoQuadratureMirrorFilterBanks);
 };
 
@@ -17,7 +17,7 @@
 #ifndef SPTK_FILTER_MEDIAN_FILTER_H_
 #define SPTK_FILTER_MEDIAN_FILTER_H_
 
-#include <deque>   // std::deque
+#include <set>     // std::multiset
 #include <vector>  // std::vector
 
 #include "SPTK/input/input_source_interface.h"
@@ -27,6 +27,13 @@ namespace sptk {
 
 /**
  * Apply a median filter to signals.
+ *
+ * The median of each window is tracked incrementally by splitting the valid
+ * samples in the window into a lower half and an upper half. When the window
+ * slides, the incoming samples are inserted and the outgoing samples are
+ * removed in @f$O(\log K)@f$ time, so that the median can be obtained without
+ * sorting the whole window for every output. The frames in the window are held
+ * in a ring buffer allocated at construction.
  */
 class MedianFilter : public InputSourceInterface {
  public:
@@ -87,7 +94,72 @@ class MedianFilter : public InputSourceInterface {
   virtual bool Get(std::vector<double>* output);
 
  private:
+  /**
+   * Sliding window median of valid samples.
+   */
+  class SlidingMedian {
+   public:
+    SlidingMedian() : num_magic_numbers_(0) {
+    }
+
+    virtual ~SlidingMedian() {
+    }
+
+    /**
+     * @param[in] x Input sample.
+     */
+    void Insert(double x);
+
+    /**
+     * @param[in] x Sample to be removed.
+     */
+    void Remove(double x);
+
+    /**
+     * Count up magic number.
+     */
+    void InsertMagicNumber() {
+      ++num_magic_numbers_;
+    }
+
+    /**
+     * Count down magic number.
+     */
+    void RemoveMagicNumber() {
+      --num_magic_numbers_;
+    }
+
+    /**
+     * @return Number of valid samples.
+     */
+    int GetNumValidNumbers() const {
+      return static_cast<int>(lower_.size() + upper_.size());
+    }
+
+    /**
+     * @return Number of magic numbers.
+     */
+    int GetNumMagicNumbers() const {
+      return num_magic_numbers_;
+    }
+
+    /**
+     * @return Median of valid samples.
+     */
+    double GetMedian() const;
+
+   private:
+    void Balance();
+
+    // Lower half of valid samples. It can hold one more sample than upper half.
+    std::multiset<double> lower_;
+    // Upper half of valid samples.
+    std::multiset<double> upper_;
+    int num_magic_numbers_;
+  };
+
   bool Forward();
+  void Update(const std::vector<double>& input_vector, bool is_insertion);
 
   const int num_input_order_;
   const int num_filter_order_;
@@ -98,9 +170,10 @@ class MedianFilter : public InputSourceInterface {
 
   bool is_valid_;
 
-  std::vector<double> buffer_;
-  std::vector<double> flat_;
-  std::deque<std::vector<double> > queue_;
+  std::vector<SlidingMedian> medians_;
+  std::vector<std::vector<double> > queue_;
+  int queue_head_;
+  int queue_size_;
   int count_down_;
 
   DISALLOW_COPY_AND_ASSIGN(MedianFilter);
@@ -20,6 +20,7 @@
 #include <vector>  // std::vector
 
 #include "SPTK/filter/all_zero_digital_filter.h"
+#include "SPTK/math/fast_fourier_transform.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -54,6 +55,14 @@ namespace sptk {
  * @f]
  * is the shifted impulse response of an ideal lowpass filter. The optimal
  * angular frequency @f$\omega@f$ is calculated based on a simple algorithm.
+ *
+ * The subband signals can also be computed only at every @f$K@f$-th sample,
+ * i.e., decimated subband signals are directly obtained from @f$K@f$ input
+ * samples. In this case, the input signal multiplied by the prototype filter
+ * is folded into @f$2K@f$ samples using the periodicity of the cosine
+ * modulation, and the modulation is computed by @f$2K@f$-point FFT if
+ * @f$K@f$ is a power of two. The computational cost per input sample is
+ * reduced from @f$O(KM)@f$ to @f$O(M/K + \log K)@f$.
  */
 class PseudoQuadratureMirrorFilterBanks {
  public:
@@ -76,6 +85,13 @@ class PseudoQuadratureMirrorFilterBanks {
    private:
     std::vector<AllZeroDigitalFilter::Buffer*> buffer_for_all_zero_filter_;
 
+    std::vector<double> signal_;
+    std::vector<double> folded_signal_;
+    std::vector<double> real_part_input_;
+    std::vector<double> imag_part_input_;
+    std::vector<double> real_part_output_;
+    std::vector<double> imag_part_output_;
+
     friend class PseudoQuadratureMirrorFilterBanks;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
   };
@@ -133,14 +149,34 @@ class PseudoQuadratureMirrorFilterBanks {
   bool Run(double input, std::vector<double>* output,
            PseudoQuadratureMirrorFilterBanks::Buffer* buffer) const;
 
+  /**
+   * Compute decimated subband signals. The output is the same as that of the
+   * @f$K@f$-th call of the above function.
+   *
+   * @param[in] input @f$K@f$ input samples.
+   * @param[out] output Output subband signals.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& input, std::vector<double>* output,
+           PseudoQuadratureMirrorFilterBanks::Buffer* buffer) const;
+
  private:
   const int num_subband_;
   const AllZeroDigitalFilter all_zero_filter_;
+  const FastFourierTransform fast_fourier_transform_;
 
   bool is_valid_;
   bool is_converged_;
   std::vector<std::vector<double> > filter_banks_;
 
+  std::vector<double> prototype_filter_;
+  std::vector<double> pre_twiddle_real_part_;
+  std::vector<double> pre_twiddle_imag_part_;
+  std::vector<double> post_twiddle_real_part_;
+  std::vector<double> post_twiddle_imag_part_;
+  std::vector<std::vector<double> > modulation_matrix_;
+
   DISALLOW_COPY_AND_ASSIGN(PseudoQuadratureMirrorFilterBanks);
 };
 
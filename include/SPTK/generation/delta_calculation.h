@@ -20,6 +20,7 @@
 #include <vector>  // std::vector
 
 #include "SPTK/input/input_source_interface.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -48,6 +49,10 @@ namespace sptk {
  * @f]
  * where @f$w^{(d)}@f$ is the @f$d@f$-th window coefficients and @f$L^{(d)}@f$
  * is half the width of the window.
+ *
+ * The static components are stored in a ring buffer whose length is the width
+ * of the widest window. When all static components are available in advance,
+ * @c Run can be used to compute the derivatives of the whole sequence at once.
  */
 class DeltaCalculation : public InputSourceInterface {
  public:
@@ -55,7 +60,8 @@ class DeltaCalculation : public InputSourceInterface {
    * @param[in] num_order Order of coefficients, @f$M@f$.
    * @param[in] window_coefficients Window coefficients.
    *            e.g.) { {1.0}, {-0.5, 0.0, 0.5} }
-   * @param[in] input_source Static components sequence.
+   * @param[in] input_source Static components sequence. This can be NULL if
+   *            only @c Run is used.
    * @param[in] use_magic_number Whether to use a magic number.
    * @param[in] magic_number A magic number.
    */
@@ -101,9 +107,28 @@ class DeltaCalculation : public InputSourceInterface {
    */
   virtual bool Get(std::vector<double>* delta);
 
+  /**
+   * @return True if the input source failed.
+   */
+  virtual bool IsFailed() const {
+    return NULL != input_source_ && input_source_->IsFailed();
+  }
+
+  /**
+   * Calculate derivatives of a whole sequence. The unobserved past and future
+   * static components are assumed to be the same as the first and the last
+   * ones, respectively.
+   *
+   * @param[in] statics @f$T \times (M+1)@f$ static components.
+   * @param[out] delta @f$T \times D(M+1)@f$ delta components.
+   * @return True on success, false on failure.
+   */
+  bool Run(const Matrix& statics, Matrix* delta) const;
+
  private:
   struct Buffer {
     std::vector<std::vector<double> > statics;
+    std::vector<const double*> pointers;
     int pointer;
     int count_down;
     bool first;
@@ -113,6 +138,8 @@ class DeltaCalculation : public InputSourceInterface {
 
   int GetPointerIndex(int move);
 
+  void CalculateDelta(const double* const* statics, double* delta) const;
+
   const int num_order_;
   const int num_delta_;
   const std::vector<std::vector<double> > window_coefficients_;
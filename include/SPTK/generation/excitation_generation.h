@@ -17,6 +17,8 @@
 #ifndef SPTK_GENERATION_EXCITATION_GENERATION_H_
 #define SPTK_GENERATION_EXCITATION_GENERATION_H_
 
+#include <vector>  // std::vector
+
 #include "SPTK/generation/random_generation_interface.h"
 #include "SPTK/input/input_source_interpolation_with_magic_number.h"
 #include "SPTK/utils/sptk_utils.h"
@@ -60,15 +62,43 @@ class ExcitationGeneration {
    */
   bool Get(double* excitation, double* pulse, double* noise, double* pitch);
 
+  /**
+   * Get excitation signal of multiple samples. The signal is the same as that
+   * given by calling the above function repeatedly, but the pitch contour and
+   * the noise are prepared for a whole block before the pulses are placed.
+   *
+   * @param[in] num_sample Number of samples to get, @f$N@f$.
+   * @param[out] excitation Excitation (optional).
+   * @param[out] pulse Pulse (optional).
+   * @param[out] noise Noise (optional).
+   * @param[out] pitch Pitch (optional).
+   * @return True if at least one sample is got, false otherwise. The length of
+   *         the outputs is less than @f$N@f$ at the end of input. Once the
+   *         end of input, i.e., a negative pitch or a failure of the input
+   *         source, is reached, all subsequent calls return false.
+   */
+  bool Get(int num_sample, std::vector<double>* excitation,
+           std::vector<double>* pulse, std::vector<double>* noise,
+           std::vector<double>* pitch);
+
  private:
   InputSourceInterpolationWithMagicNumber* input_source_;
   RandomGenerationInterface* random_generation_;
 
   bool is_valid_;
 
+  // True if the end of input has been reached.
+  bool is_end_;
+
   // Phase value ranging from 0.0 to 1.0.
   double phase_;
 
+  // Work space used when the corresponding output is not requested.
+  std::vector<double> point_;
+  std::vector<double> pulse_;
+  std::vector<double> noise_;
+  std::vector<double> pitch_;
+
   DISALLOW_COPY_AND_ASSIGN(ExcitationGeneration);
 };
 
@@ -17,6 +17,8 @@
 #ifndef SPTK_GENERATION_M_SEQUENCE_GENERATION_H_
 #define SPTK_GENERATION_M_SEQUENCE_GENERATION_H_
 
+#include <vector>  // std::vector
+
 #include "SPTK/generation/random_generation_interface.h"
 #include "SPTK/utils/sptk_utils.h"
 
@@ -48,6 +50,15 @@ class MSequenceGeneration : public RandomGenerationInterface {
    */
   virtual bool Get(double* output);
 
+  /**
+   * Get random numbers at once.
+   *
+   * @param[out] outputs Random numbers. The number of random numbers is given
+   *             by the size of the vector.
+   * @return True on success, false on failure.
+   */
+  virtual bool Get(std::vector<double>* outputs);
+
  private:
   int x_;
 
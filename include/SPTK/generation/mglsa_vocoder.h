@@ -0,0 +1,111 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_GENERATION_MGLSA_VOCODER_H_
+#define SPTK_GENERATION_MGLSA_VOCODER_H_
+
+#include <vector>  // std::vector
+
+#include "SPTK/filter/mglsa_digital_filter.h"
+#include "SPTK/generation/excitation_generation.h"
+#include "SPTK/generation/random_generation_interface.h"
+#include "SPTK/input/input_source_interface.h"
+#include "SPTK/input/input_source_interpolation.h"
+#include "SPTK/input/input_source_interpolation_with_magic_number.h"
+#include "SPTK/input/input_source_preprocessing_for_mel_cepstrum.h"
+#include "SPTK/postfilter/mel_cepstrum_postfilter.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Synthesize speech waveform from pitch and mel-generalized cepstrum.
+ *
+ * The inputs are frame-wise pitch and mel-generalized cepstral coefficients.
+ * The excitation signal is generated by ExcitationGeneration and it is passed
+ * through the MGLSA digital filter whose coefficients are interpolated sample
+ * by sample. The mel-cepstrum can be postfiltered by MelCepstrumPostfilter
+ * before filtering. The output is the same as that of the pipeline
+ * @c excite | @c mglsadf, where the mel-cepstrum is given via @c mcpf.
+ */
+class MglsaVocoder {
+ public:
+  /**
+   * @param[in] num_filter_order Order of filter coefficients, @f$M@f$.
+   * @param[in] alpha All-pass constant, @f$\alpha@f$.
+   * @param[in] num_stage Number of stages, @f$C@f$. If zero, MLSA filter is
+   *            used.
+   * @param[in] num_pade_order Order of Pade approximation.
+   * @param[in] transposition If true, use transposed form filter.
+   * @param[in] gain_flag If false, filtering without gain.
+   * @param[in] frame_period Frame period.
+   * @param[in] interpolation_period Interpolation period.
+   * @param[in] pitch_source Input source of pitch in samples. Unvoiced frames
+   *            are represented by zero.
+   * @param[in] mel_generalized_cepstrum_source Input source of
+   *            @f$M@f$-th order mel-generalized cepstrum.
+   * @param[in] random_generation Random value generator.
+   * @param[in] postfilter Postfilter for mel-cepstrum (optional). This is
+   *            available only if @f$C=0@f$.
+   */
+  MglsaVocoder(int num_filter_order, double alpha, int num_stage,
+               int num_pade_order, bool transposition, bool gain_flag,
+               int frame_period, int interpolation_period,
+               InputSourceInterface* pitch_source,
+               InputSourceInterface* mel_generalized_cepstrum_source,
+               RandomGenerationInterface* random_generation,
+               const MelCepstrumPostfilter* postfilter = NULL);
+
+  virtual ~MglsaVocoder() {
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * Get speech waveform of multiple samples.
+   *
+   * @param[in] num_sample Number of samples to get, @f$N@f$.
+   * @param[out] waveform Speech waveform.
+   * @return True if at least one sample is got, false otherwise. The length of
+   *         the output is less than @f$N@f$ at the end of input.
+   */
+  bool Get(int num_sample, std::vector<double>* waveform);
+
+ private:
+  InputSourceInterpolationWithMagicNumber pitch_interpolation_;
+  ExcitationGeneration excitation_generation_;
+
+  InputSourcePreprocessingForMelCepstrum preprocessing_;
+  InputSourceInterpolation filter_coefficients_interpolation_;
+
+  const MglsaDigitalFilter filter_;
+
+  bool is_valid_;
+
+  std::vector<double> filter_coefficients_;
+  MglsaDigitalFilter::Buffer buffer_for_filter_;
+
+  DISALLOW_COPY_AND_ASSIGN(MglsaVocoder);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_GENERATION_MGLSA_VOCODER_H_
@@ -18,6 +18,7 @@
 #define SPTK_GENERATION_NORMAL_DISTRIBUTED_RANDOM_VALUE_GENERATION_H_
 
 #include <cstdint>  // std::uint64_t
+#include <vector>   // std::vector
 
 #include "SPTK/generation/random_generation_interface.h"
 #include "SPTK/utils/sptk_utils.h"
@@ -51,6 +52,15 @@ class NormalDistributedRandomValueGeneration
    */
   virtual bool Get(double* output);
 
+  /**
+   * Get random numbers at once.
+   *
+   * @param[out] outputs Random numbers. The number of random numbers is given
+   *             by the size of the vector.
+   * @return True on success, false on failure.
+   */
+  virtual bool Get(std::vector<double>* outputs);
+
   /**
    * @return Random seed.
    */
@@ -17,6 +17,9 @@
 #ifndef SPTK_GENERATION_RANDOM_GENERATION_INTERFACE_H_
 #define SPTK_GENERATION_RANDOM_GENERATION_INTERFACE_H_
 
+#include <cstddef>  // NULL
+#include <vector>   // std::vector
+
 namespace sptk {
 
 /**
@@ -39,6 +42,27 @@ class RandomGenerationInterface {
    * @return True on success, false on failure.
    */
   virtual bool Get(double* output) = 0;
+
+  /**
+   * Get random numbers. They are the same as those given by calling the above
+   * function repeatedly.
+   *
+   * @param[out] outputs Random numbers. The number of random numbers is given
+   *             by the size of the vector.
+   * @return True on success, false on failure.
+   */
+  virtual bool Get(std::vector<double>* outputs) {
+    if (NULL == outputs) {
+      return false;
+    }
+    for (std::vector<double>::iterator itr(outputs->begin());
+         itr != outputs->end(); ++itr) {
+      if (!Get(&(*itr))) {
+        return false;
+      }
+    }
+    return true;
+  }
 };
 
 }  // namespace sptk
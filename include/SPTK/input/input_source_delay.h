@@ -17,7 +17,6 @@
 #ifndef SPTK_INPUT_INPUT_SOURCE_DELAY_H_
 #define SPTK_INPUT_INPUT_SOURCE_DELAY_H_
 
-#include <queue>   // std::queue
 #include <vector>  // std::vector
 
 #include "SPTK/input/input_source_interface.h"
@@ -27,6 +26,10 @@ namespace sptk {
 
 /**
  * Delay input source.
+ *
+ * The delayed data are kept in a ring buffer allocated at construction, and
+ * are exchanged with the output buffer by swapping, so no memory is allocated
+ * while reading data.
  */
 class InputSourceDelay : public InputSourceInterface {
  public:
@@ -82,7 +85,9 @@ class InputSourceDelay : public InputSourceInterface {
   InputSourceInterface* source_;
   bool is_valid_;
 
-  std::queue<std::vector<double> > queue_;
+  std::vector<std::vector<double> > queue_;
+  int queue_head_;
+  int queue_size_;
   int num_zeros_;
 
   DISALLOW_COPY_AND_ASSIGN(InputSourceDelay);
@@ -76,6 +76,7 @@ class InputSourceFillingMagicNumber : public InputSourceInterface {
   bool is_valid_;
 
   std::deque<std::vector<double> > queue_;
+  std::vector<std::vector<double> > pool_;
   std::vector<double> final_output_;
   std::vector<int> magic_number_region_;
 
@@ -0,0 +1,108 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_INPUT_INPUT_SOURCE_FRAMING_H_
+#define SPTK_INPUT_INPUT_SOURCE_FRAMING_H_
+
+#include <vector>  // std::vector
+
+#include "SPTK/input/input_source_interface.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Extract frames from a sequence of samples.
+ *
+ * The samples given by the source are regarded as one sequence regardless of
+ * the size of the source. The @f$t@f$-th frame starts at the
+ * @f$(tP - S)@f$-th sample, where @f$P@f$ is the frame period and @f$S@f$ is
+ * @f$\lfloor L/2 \rfloor@f$ if the beginning of data is the center of the
+ * first frame, otherwise zero. Frames are extracted while @f$tP@f$ does not
+ * exceed the last sample. Samples out of the sequence are filled with zeros.
+ * The output is the same as that of @c frame.
+ */
+class InputSourceFraming : public InputSourceInterface {
+ public:
+  /**
+   * @param[in] frame_length Frame length, @f$L@f$.
+   * @param[in] frame_period Frame period, @f$P@f$.
+   * @param[in] center If true, the beginning of data is the center of the
+   *            first frame.
+   * @param[in] source Input source of samples.
+   */
+  InputSourceFraming(int frame_length, int frame_period, bool center,
+                     InputSourceInterface* source);
+
+  virtual ~InputSourceFraming() {
+  }
+
+  /**
+   * @return Frame period.
+   */
+  int GetFramePeriod() const {
+    return frame_period_;
+  }
+
+  /**
+   * @return Size of data.
+   */
+  virtual int GetSize() const {
+    return frame_length_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  virtual bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[out] buffer Frame.
+   * @return True on success, false on failure.
+   */
+  virtual bool Get(std::vector<double>* buffer);
+
+  /**
+   * @return True if the input source failed.
+   */
+  virtual bool IsFailed() const {
+    return NULL != source_ && source_->IsFailed();
+  }
+
+ private:
+  const int frame_length_;
+  const int frame_period_;
+  const int offset_;
+
+  InputSourceInterface* source_;
+  bool is_valid_;
+
+  // The i-th sample is stored in the (i mod R)-th element, where R is the size
+  // of the ring.
+  std::vector<double> ring_;
+  std::vector<double> samples_;
+  int num_read_samples_;
+  int next_frame_position_;
+  bool is_eof_;
+
+  DISALLOW_COPY_AND_ASSIGN(InputSourceFraming);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_INPUT_INPUT_SOURCE_FRAMING_H_
@@ -44,6 +44,14 @@ class InputSourceInterface {
    * @return True on success, false on failure.
    */
   virtual bool Get(std::vector<double>* buffer) = 0;
+
+  /**
+   * @return True if @c Get returned false because of an error rather than the
+   *         end of data. Sources which cannot fail always return false.
+   */
+  virtual bool IsFailed() const {
+    return false;
+  }
 };
 
 }  // namespace sptk
@@ -0,0 +1,108 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_INPUT_INPUT_SOURCE_PREFETCHING_H_
+#define SPTK_INPUT_INPUT_SOURCE_PREFETCHING_H_
+
+#include <condition_variable>  // std::condition_variable
+#include <mutex>               // std::mutex
+#include <thread>              // std::thread
+#include <vector>              // std::vector
+
+#include "SPTK/input/input_source_interface.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Read data of input source in a separate thread.
+ *
+ * The data are read ahead into a ring buffer allocated at construction, so
+ * that the source and the reader of this object run concurrently. A chain of
+ * input sources with this object between the stages runs as a thread
+ * pipeline. The data are exchanged with the output buffer by swapping, so no
+ * memory is allocated while reading data. The thread starts at the first call
+ * of @c Get and the source must not be used by others after that.
+ */
+class InputSourcePrefetching : public InputSourceInterface {
+ public:
+  /**
+   * @param[in] queue_length Maximum number of data read ahead.
+   * @param[in] source Input source.
+   */
+  InputSourcePrefetching(int queue_length, InputSourceInterface* source);
+
+  virtual ~InputSourcePrefetching();
+
+  /**
+   * @return Maximum number of data read ahead.
+   */
+  int GetQueueLength() const {
+    return queue_length_;
+  }
+
+  /**
+   * @return Size of data.
+   */
+  virtual int GetSize() const {
+    return source_ ? source_->GetSize() : 0;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  virtual bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[out] buffer Read data.
+   * @return True on success, false on failure.
+   */
+  virtual bool Get(std::vector<double>* buffer);
+
+  /**
+   * @return True if the input source failed. The failure is passed to the
+   *         reader after the data read before it.
+   */
+  virtual bool IsFailed() const;
+
+ private:
+  void Prefetch();
+
+  const int queue_length_;
+
+  InputSourceInterface* source_;
+  bool is_valid_;
+
+  std::vector<std::vector<double> > queue_;
+  int queue_head_;
+  int queue_size_;
+  bool is_end_;
+  bool is_failed_;
+  bool is_stopped_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::thread thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(InputSourcePrefetching);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_INPUT_INPUT_SOURCE_PREFETCHING_H_
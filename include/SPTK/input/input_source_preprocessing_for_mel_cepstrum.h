@@ -0,0 +1,101 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_INPUT_INPUT_SOURCE_PREPROCESSING_FOR_MEL_CEPSTRUM_H_
+#define SPTK_INPUT_INPUT_SOURCE_PREPROCESSING_FOR_MEL_CEPSTRUM_H_
+
+#include <vector>  // std::vector
+
+#include "SPTK/conversion/generalized_cepstrum_gain_normalization.h"
+#include "SPTK/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.h"
+#include "SPTK/input/input_source_interface.h"
+#include "SPTK/postfilter/mel_cepstrum_postfilter.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Convert mel-generalized cepstrum to coefficients of MGLSA digital filter.
+ *
+ * The mel-cepstrum can be optionally postfiltered before the conversion.
+ */
+class InputSourcePreprocessingForMelCepstrum : public InputSourceInterface {
+ public:
+  /**
+   * @param[in] alpha All-pass constant, @f$\alpha@f$.
+   * @param[in] gamma Exponent parameter, @f$\gamma@f$.
+   * @param[in] gain_flag If false, the gain of filter is set to one.
+   * @param[in] source Input source.
+   * @param[in] postfilter Postfilter applied to mel-cepstrum (optional). This
+   *            is available only if @f$\gamma=0@f$.
+   */
+  InputSourcePreprocessingForMelCepstrum(
+      double alpha, double gamma, bool gain_flag, InputSourceInterface* source,
+      const MelCepstrumPostfilter* postfilter = NULL);
+
+  virtual ~InputSourcePreprocessingForMelCepstrum() {
+  }
+
+  /**
+   * @return Gain flag.
+   */
+  bool GetGainFlag() const {
+    return gain_flag_;
+  }
+
+  /**
+   * @return Size of data.
+   */
+  virtual int GetSize() const {
+    return source_ ? source_->GetSize() : 0;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  virtual bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[out] mlsa_digital_filter_coefficients Filter coefficients.
+   * @return True on success, false on failure.
+   */
+  virtual bool Get(std::vector<double>* mlsa_digital_filter_coefficients);
+
+ private:
+  const double gamma_;
+  const bool gain_flag_;
+
+  InputSourceInterface* source_;
+  const MelCepstrumPostfilter* postfilter_;
+
+  const MelCepstrumToMlsaDigitalFilterCoefficients
+      mel_cepstrum_to_mlsa_digital_filter_coefficients_;
+  const GeneralizedCepstrumGainNormalization
+      generalized_cepstrum_gain_normalization_;
+
+  bool is_valid_;
+
+  std::vector<double> mel_cepstrum_;
+  MelCepstrumPostfilter::Buffer buffer_for_postfilter_;
+
+  DISALLOW_COPY_AND_ASSIGN(InputSourcePreprocessingForMelCepstrum);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_INPUT_INPUT_SOURCE_PREPROCESSING_FOR_MEL_CEPSTRUM_H_
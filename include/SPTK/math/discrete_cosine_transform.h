@@ -20,6 +20,7 @@
 #include <vector>  // std::vector
 
 #include "SPTK/math/fourier_transform.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -53,6 +54,13 @@ namespace sptk {
  *     1. & 1 \le k < L
  *   \end{array} \right.
  * @f]
+ *
+ * The transform is computed by an @f$L@f$-point DFT of the reordered input
+ * sequence @f$x(0), x(2), \ldots, x(3), x(1)@f$ followed by the
+ * multiplication of twiddle factors. Since the transform is linear and its
+ * kernel is real, the real and imaginary parts of the output are separated by
+ * using the symmetry of the DFT. This also allows two real-valued sequences to
+ * be transformed by one DFT.
  */
 class DiscreteCosineTransform {
  public:
@@ -70,6 +78,7 @@ class DiscreteCosineTransform {
    private:
     std::vector<double> fourier_transform_real_part_;
     std::vector<double> fourier_transform_imag_part_;
+    std::vector<double> imag_part_output_;
 
     friend class DiscreteCosineTransform;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -120,7 +129,24 @@ class DiscreteCosineTransform {
   bool Run(std::vector<double>* real_part, std::vector<double>* imag_part,
            DiscreteCosineTransform::Buffer* buffer) const;
 
+  /**
+   * Transform real-valued sequences. Two sequences are transformed at once.
+   *
+   * @param[in] input_sequences @f$L@f$-length real-valued input sequences.
+   *            The shape is @f$[T, L]@f$.
+   * @param[out] output_sequences @f$L@f$-length output sequences.
+   *             The shape is @f$[T, L]@f$.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const Matrix& input_sequences, Matrix* output_sequences,
+           DiscreteCosineTransform::Buffer* buffer) const;
+
  private:
+  bool Transform(const double* real_part_input, const double* imag_part_input,
+                 double* real_part_output, double* imag_part_output,
+                 DiscreteCosineTransform::Buffer* buffer) const;
+
   const int dct_length_;
 
   const FourierTransform fourier_transform_;
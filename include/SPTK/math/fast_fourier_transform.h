@@ -17,6 +17,7 @@
 #ifndef SPTK_MATH_FAST_FOURIER_TRANSFORM_H_
 #define SPTK_MATH_FAST_FOURIER_TRANSFORM_H_
 
+#include <mutex>   // std::call_once, std::once_flag
 #include <vector>  // std::vector
 
 #include "SPTK/utils/sptk_utils.h"
@@ -41,6 +42,10 @@ namespace sptk {
  *   \end{array}
  * @f]
  * where @f$L@f$ is the FFT length and must be a power of two.
+ *
+ * The transform can also be computed in single precision, which halves the
+ * memory traffic when double precision is unnecessary. The single-precision
+ * sine table is built at the first call of the single-precision transform.
  */
 class FastFourierTransform {
  public:
@@ -99,7 +104,33 @@ class FastFourierTransform {
   bool Run(std::vector<double>* real_part,
            std::vector<double>* imag_part) const;
 
+  /**
+   * @param[in] real_part_input @f$M@f$-th order real part of input.
+   * @param[in] imag_part_input @f$M@f$-th order imaginary part of input.
+   * @param[out] real_part_output @f$L@f$-length real part of output.
+   * @param[out] imag_part_output @f$L@f$-length imaginary part of output.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<float>& real_part_input,
+           const std::vector<float>& imag_part_input,
+           std::vector<float>* real_part_output,
+           std::vector<float>* imag_part_output) const;
+
+  /**
+   * @param[in,out] real_part Real part.
+   * @param[in,out] imag_part Imaginary part.
+   * @return True on success, false on failure.
+   */
+  bool Run(std::vector<float>* real_part, std::vector<float>* imag_part) const;
+
  private:
+  template <typename T>
+  bool Transform(const std::vector<T>& real_part_input,
+                 const std::vector<T>& imag_part_input,
+                 const std::vector<T>& sine_table,
+                 std::vector<T>* real_part_output,
+                 std::vector<T>* imag_part_output) const;
+
   const int num_order_;
   const int fft_length_;
   const int half_fft_length_;
@@ -108,6 +139,9 @@ class FastFourierTransform {
 
   std::vector<double> sine_table_;
 
+  mutable std::once_flag float_sine_table_flag_;
+  mutable std::vector<float> float_sine_table_;
+
   DISALLOW_COPY_AND_ASSIGN(FastFourierTransform);
 };
 
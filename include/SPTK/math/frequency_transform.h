@@ -19,6 +19,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -58,7 +59,10 @@ namespace sptk {
  *
  * The transformation is based on the cascade of all-pass networks. For more
  * detail, see [1]. Note that the above recursion can be represented as a linear
- * transformation, i.e., matrix multiplication.
+ * transformation, i.e., matrix multiplication. The conversion matrix is made
+ * once in the constructor by applying the recursion to unit impulses, so that
+ * each frame is transformed by a vector-matrix product. A batch of frames can
+ * be transformed by a single matrix multiplication.
  *
  * [1] A. Oppenheim and D. Johnson, &quot;Discrete representation of
  *     signals,&quot; Proc. of the IEEE, vol. 60, no. 6, pp. 681-691, 1972.
@@ -81,8 +85,6 @@ class FrequencyTransform {
     }
 
    private:
-    std::vector<double> d_;
-
     friend class FrequencyTransform;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
   };
@@ -135,6 +137,16 @@ class FrequencyTransform {
            std::vector<double>* warped_sequence,
            FrequencyTransform::Buffer* buffer) const;
 
+  /**
+   * @param[in] minimum_phase_sequences @f$M_1@f$-th order input sequences.
+   *            The shape is @f$[T, M_1+1]@f$.
+   * @param[out] warped_sequences @f$M_2@f$-th order output sequences.
+   *             The shape is @f$[T, M_2+1]@f$.
+   * @return True on success, false on failure.
+   */
+  bool Run(const Matrix& minimum_phase_sequences,
+           Matrix* warped_sequences) const;
+
  private:
   const int num_input_order_;
   const int num_output_order_;
@@ -142,6 +154,9 @@ class FrequencyTransform {
 
   bool is_valid_;
 
+  // The shape is [M_1+1, M_2+1].
+  Matrix conversion_matrix_;
+
   DISALLOW_COPY_AND_ASSIGN(FrequencyTransform);
 };
 
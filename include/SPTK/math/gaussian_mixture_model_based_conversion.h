@@ -114,6 +114,13 @@ namespace sptk {
  * constraint between static and dynamic components is obtained by the maximum
  * likelihood parameter generation algorithm.
  *
+ * The source vectors are processed block by block. The quadratic forms of all
+ * the mixtures are computed by a single matrix product of the source vectors
+ * and the stacked whitening matrices @f$\boldsymbol{W}_m@f$ satisfying
+ * @f$\boldsymbol{W}_m^{\mathsf{T}} \boldsymbol{W}_m =
+ * \boldsymbol{\varSigma}_m^{(XX)^{-1}}@f$, and the conditional mean vectors
+ * of the frames sharing the same mixture are computed by a matrix product.
+ *
  * [1] T. Toda, A. W. Black, and K. Tokuda, &quot;Voice conversion based on
  *     maximum-likelihood estimation of spectral parameter trajectory,&quot;
  *     IEEE Transactions on Audio, Speech, and Language Processing, vol. 15,
@@ -191,8 +198,9 @@ class GaussianMixtureModelBasedConversion {
 
   bool is_valid_;
 
-  std::vector<std::vector<double> > source_mean_vectors_;
-  std::vector<SymmetricMatrix> source_covariance_matrices_;
+  Matrix whitening_matrix_;
+  std::vector<double> whitened_mean_vector_;
+  std::vector<double> log_constants_;
   std::vector<Matrix> e_slope_;
   std::vector<std::vector<double> > e_bias_;
   std::vector<SymmetricMatrix> d_;
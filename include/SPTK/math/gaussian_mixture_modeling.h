@@ -19,6 +19,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
 #include "SPTK/math/symmetric_matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
@@ -128,7 +129,8 @@ class GaussianMixtureModeling {
    */
   class Buffer {
    public:
-    Buffer() : precomputed_(false) {
+    Buffer()
+        : precomputed_(false), factorized_(false), float_factorized_(false) {
     }
 
     virtual ~Buffer() {
@@ -140,6 +142,18 @@ class GaussianMixtureModeling {
     std::vector<SymmetricMatrix> precisions_;
     bool precomputed_;
 
+    Matrix whitening_matrix_;
+    Matrix whitened_vectors_;
+    std::vector<double> whitened_mean_vectors_;
+    std::vector<double> log_weights_;
+    std::vector<double> components_;
+    bool factorized_;
+
+    std::vector<float> float_whitening_matrices_;
+    std::vector<float> float_whitened_mean_vectors_;
+    std::vector<float> float_components_;
+    bool float_factorized_;
+
     friend class GaussianMixtureModeling;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
   };
@@ -290,7 +304,69 @@ class GaussianMixtureModeling {
       std::vector<double>* components_of_log_probability,
       double* log_probability, GaussianMixtureModeling::Buffer* buffer);
 
+  /**
+   * Calculate log-probablities of a block of data.
+   *
+   * The precision matrix of each mixture is factorized once as
+   * @f$\boldsymbol{W}_k^{\mathsf{T}} \boldsymbol{W}_k@f$ and the whitening
+   * matrices of all the mixtures are applied to the input vectors by a single
+   * matrix product.
+   *
+   * @param[in] num_order Order of input vector.
+   * @param[in] num_mixture Number of mixture components.
+   * @param[in] is_diagonal If true, diagonal covariance is assumed.
+   * @param[in] check_size If true, check sanity of input GMM parameters.
+   * @param[in] input_vectors @f$M@f$-th order input vectors.
+   *            The shape is @f$[T, M+1]@f$.
+   * @param[in] weights @f$K@f$ mixture weights.
+   * @param[in] mean_vectors @f$K@f$ mean vectors.
+   * @param[in] covariance_matrices @f$K@f$ covariance matrices.
+   * @param[out] log_probabilities @f$T@f$ log-probabilities of input vectors.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  static bool CalculateLogProbability(
+      int num_order, int num_mixture, bool is_diagonal, bool check_size,
+      const Matrix& input_vectors, const std::vector<double>& weights,
+      const std::vector<std::vector<double> >& mean_vectors,
+      const std::vector<SymmetricMatrix>& covariance_matrices,
+      std::vector<double>* log_probabilities,
+      GaussianMixtureModeling::Buffer* buffer);
+
+  /**
+   * Calculate log-probablity of data in single precision.
+   *
+   * The GMM parameters are factorized in the same way as in the case of a
+   * block of data and converted to single precision at the first call.
+   *
+   * @param[in] num_order Order of input vector.
+   * @param[in] num_mixture Number of mixture components.
+   * @param[in] is_diagonal If true, diagonal covariance is assumed.
+   * @param[in] check_size If true, check sanity of input GMM parameters.
+   * @param[in] input_vector @f$M@f$-th order input vector.
+   * @param[in] weights @f$K@f$ mixture weights.
+   * @param[in] mean_vectors @f$K@f$ mean vectors.
+   * @param[in] covariance_matrices @f$K@f$ covariance matrices.
+   * @param[out] components_of_log_probability Components of log-probability.
+   * @param[out] log_probability Log-probability of input vector.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  static bool CalculateLogProbability(
+      int num_order, int num_mixture, bool is_diagonal, bool check_size,
+      const std::vector<float>& input_vector,
+      const std::vector<double>& weights,
+      const std::vector<std::vector<double> >& mean_vectors,
+      const std::vector<SymmetricMatrix>& covariance_matrices,
+      std::vector<float>* components_of_log_probability,
+      float* log_probability, GaussianMixtureModeling::Buffer* buffer);
+
  private:
+  static bool Factorize(int num_order, int num_mixture, bool is_diagonal,
+                        const std::vector<std::vector<double> >& mean_vectors,
+                        const std::vector<SymmetricMatrix>& covariance_matrices,
+                        GaussianMixtureModeling::Buffer* buffer);
+
   void FloorWeight(std::vector<double>* weights) const;
 
   void FloorVariance(std::vector<SymmetricMatrix>* covariance_matrices) const;
@@ -20,6 +20,7 @@
 #include <vector>  // std::vector
 
 #include "SPTK/math/fourier_transform.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -53,6 +54,11 @@ namespace sptk {
  *     1. & 1 \le k < L
  *   \end{array} \right.
  * @f]
+ *
+ * The transform is computed by the multiplication of twiddle factors followed
+ * by an @f$L@f$-point inverse DFT, whose output is reordered as
+ * @f$x(0), x(2), \ldots, x(3), x(1)@f$. Two real-valued sequences can be
+ * transformed by one DFT in the same way as DiscreteCosineTransform.
  */
 class InverseDiscreteCosineTransform {
  public:
@@ -70,6 +76,7 @@ class InverseDiscreteCosineTransform {
    private:
     std::vector<double> fourier_transform_real_part_;
     std::vector<double> fourier_transform_imag_part_;
+    std::vector<double> imag_part_output_;
 
     friend class InverseDiscreteCosineTransform;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -120,7 +127,24 @@ class InverseDiscreteCosineTransform {
   bool Run(std::vector<double>* real_part, std::vector<double>* imag_part,
            InverseDiscreteCosineTransform::Buffer* buffer) const;
 
+  /**
+   * Transform real-valued sequences. Two sequences are transformed at once.
+   *
+   * @param[in] input_sequences @f$L@f$-length real-valued input sequences.
+   *            The shape is @f$[T, L]@f$.
+   * @param[out] output_sequences @f$L@f$-length output sequences.
+   *             The shape is @f$[T, L]@f$.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const Matrix& input_sequences, Matrix* output_sequences,
+           InverseDiscreteCosineTransform::Buffer* buffer) const;
+
  private:
+  bool Transform(const double* real_part_input, const double* imag_part_input,
+                 double* real_part_output, double* imag_part_output,
+                 InverseDiscreteCosineTransform::Buffer* buffer) const;
+
   const int dct_length_;
 
   const FourierTransform fourier_transform_;
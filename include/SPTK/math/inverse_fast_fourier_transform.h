@@ -100,7 +100,32 @@ class InverseFastFourierTransform {
   bool Run(std::vector<double>* real_part,
            std::vector<double>* imag_part) const;
 
+  /**
+   * @param[in] real_part_input @f$M@f$-th order real part of input.
+   * @param[in] imag_part_input @f$M@f$-th order imaginary part of input.
+   * @param[out] real_part_output @f$L@f$-length real part of output.
+   * @param[out] imag_part_output @f$L@f$-length imaginary part of output.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<float>& real_part_input,
+           const std::vector<float>& imag_part_input,
+           std::vector<float>* real_part_output,
+           std::vector<float>* imag_part_output) const;
+
+  /**
+   * @param[in,out] real_part Real part.
+   * @param[in,out] imag_part Imaginary part.
+   * @return True on success, false on failure.
+   */
+  bool Run(std::vector<float>* real_part, std::vector<float>* imag_part) const;
+
  private:
+  template <typename T>
+  bool Transform(const std::vector<T>& real_part_input,
+                 const std::vector<T>& imag_part_input,
+                 std::vector<T>* real_part_output,
+                 std::vector<T>* imag_part_output) const;
+
   const FastFourierTransform fast_fourier_transform_;
 
   DISALLOW_COPY_AND_ASSIGN(InverseFastFourierTransform);
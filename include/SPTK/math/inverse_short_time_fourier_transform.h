@@ -0,0 +1,176 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_MATH_INVERSE_SHORT_TIME_FOURIER_TRANSFORM_H_
+#define SPTK_MATH_INVERSE_SHORT_TIME_FOURIER_TRANSFORM_H_
+
+#include <vector>  // std::vector
+
+#include "SPTK/math/real_valued_inverse_fast_fourier_transform.h"
+#include "SPTK/utils/sptk_utils.h"
+#include "SPTK/window/data_windowing.h"
+#include "SPTK/window/window_interface.h"
+
+namespace sptk {
+
+/**
+ * Reconstruct waveform from short-time spectra by weighted overlap-add.
+ *
+ * The input is the @f$(N/2+1)@f$-length real and imaginary parts of the
+ * spectrum of the @f$t@f$-th frame, @f$X_t(k)@f$, where @f$N@f$ is the FFT
+ * length. The frame is computed by the inverse FFT and multiplied by the
+ * synthesis window @f$w(n)@f$:
+ * @f[
+ *   y_t(n) = w(n) \, \mathrm{Re} \left\{ \frac{1}{N} \sum_{k=0}^{N-1}
+ *     X_t(k) e^{j2\pi kn/N} \right\}, \quad 0 \le n < L,
+ * @f]
+ * where @f$L@f$ is the frame length and @f$X_t(N-k) = X_t^*(k)@f$. The
+ * output waveform is given by the weighted overlap-add:
+ * @f[
+ *   x(n) = \frac{\sum_t y_t(n-tP)}{\sum_t w^2(n-tP)},
+ * @f]
+ * where @f$P@f$ is the frame period. If the same window is used in the
+ * analysis, the waveform is perfectly reconstructed from the unmodified
+ * spectra. The samples whose denominators are nearly zero are set to zero.
+ *
+ * The frames are given one by one, and the @f$P@f$ samples which are not
+ * affected by the following frames are returned for each frame. The remaining
+ * samples can be obtained by @c Flush after the last frame. No memory is
+ * allocated after the first frame.
+ */
+class InverseShortTimeFourierTransform {
+ public:
+  /**
+   * Buffer for InverseShortTimeFourierTransform class.
+   */
+  class Buffer {
+   public:
+    Buffer() : position_(0) {
+    }
+
+    virtual ~Buffer() {
+    }
+
+   private:
+    std::vector<double> weighted_signal_;
+    std::vector<double> weight_;
+    int position_;
+
+    std::vector<double> real_part_input_;
+    std::vector<double> imag_part_input_;
+    std::vector<double> real_part_output_for_real_part_input_;
+    std::vector<double> imag_part_output_for_real_part_input_;
+    std::vector<double> real_part_output_for_imag_part_input_;
+    std::vector<double> imag_part_output_for_imag_part_input_;
+    RealValuedInverseFastFourierTransform::Buffer
+        inverse_fast_fourier_transform_buffer_;
+
+    friend class InverseShortTimeFourierTransform;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
+  /**
+   * @param[in] window @f$L@f$-length window.
+   * @param[in] frame_period Frame period, @f$P@f$.
+   * @param[in] fft_length FFT length, @f$N@f$.
+   * @param[in] normalization_type Type of window normalization.
+   */
+  InverseShortTimeFourierTransform(
+      WindowInterface* window, int frame_period, int fft_length,
+      DataWindowing::NormalizationType normalization_type);
+
+  virtual ~InverseShortTimeFourierTransform() {
+  }
+
+  /**
+   * @return Frame length.
+   */
+  int GetFrameLength() const {
+    return frame_length_;
+  }
+
+  /**
+   * @return Frame period.
+   */
+  int GetFramePeriod() const {
+    return frame_period_;
+  }
+
+  /**
+   * @return FFT length.
+   */
+  int GetFftLength() const {
+    return fft_length_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * Clear overlap-added signals stored in buffer.
+   *
+   * @param[out] buffer Buffer.
+   */
+  void Clear(InverseShortTimeFourierTransform::Buffer* buffer) const;
+
+  /**
+   * @param[in] real_part @f$(N/2+1)@f$-length real part of spectrum.
+   * @param[in] imag_part @f$(N/2+1)@f$-length imaginary part of spectrum.
+   * @param[out] waveform @f$P@f$ samples of reconstructed waveform.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& real_part,
+           const std::vector<double>& imag_part,
+           std::vector<double>* waveform,
+           InverseShortTimeFourierTransform::Buffer* buffer) const;
+
+  /**
+   * Get the remaining samples of the last frame and clear buffer.
+   *
+   * @param[out] waveform @f$\max(L-P,0)@f$ samples of reconstructed waveform.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Flush(std::vector<double>* waveform,
+             InverseShortTimeFourierTransform::Buffer* buffer) const;
+
+ private:
+  void Output(int num_sample, double* waveform,
+              InverseShortTimeFourierTransform::Buffer* buffer) const;
+
+  const int frame_length_;
+  const int frame_period_;
+  const int fft_length_;
+  const int ring_buffer_length_;
+
+  const RealValuedInverseFastFourierTransform inverse_fast_fourier_transform_;
+
+  bool is_valid_;
+
+  std::vector<double> window_;
+  double minimum_weight_;
+
+  DISALLOW_COPY_AND_ASSIGN(InverseShortTimeFourierTransform);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_MATH_INVERSE_SHORT_TIME_FOURIER_TRANSFORM_H_
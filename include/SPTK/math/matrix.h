@@ -142,6 +142,16 @@ class Matrix {
    */
   Matrix operator*(const Matrix& matrix) const;
 
+  /**
+   * Multiply matrix by column vector.
+   *
+   * @param[in] vector Column vector.
+   * @param[out] product Product.
+   * @return True on success, false on failure.
+   */
+  bool Multiply(const std::vector<double>& vector,
+                std::vector<double>* product) const;
+
   /**
    * Negate.
    *
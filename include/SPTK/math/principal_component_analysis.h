@@ -51,7 +51,20 @@ namespace sptk {
  *     \lambda(0), & \lambda(1), & \ldots, & \lambda(M).
  *   \end{array}
  * @f]
- * The eigenvalue problem is solved by the Jacobi iterative method.
+ * The eigenvalue problem is solved by one of the following methods:
+ * - the Jacobi iterative method,
+ * - the Householder tridiagonalization followed by the implicit QL method,
+ * - the randomized subspace iteration that finds only the @f$K@f$ largest
+ *   eigenvalues.
+ *
+ * The second one is much faster than the first one for high-dimensional
+ * vectors. The last one is fastest if @f$K \ll M@f$. In this case, the
+ * remaining @f$M+1-K@f$ eigenvalues are approximated by the average of the
+ * residual variance and the corresponding eigenvectors are filled with zeros.
+ *
+ * The input vectors can be given one by one via @c Accumulate, so that all of
+ * them need not be held in memory. The statistics accumulated separately can
+ * be merged by @c Merge.
  */
 class PrincipalComponentAnalysis {
  public:
@@ -65,6 +78,16 @@ class PrincipalComponentAnalysis {
     kNumCovarianceTypes,
   };
 
+  /**
+   * Type of eigenvalue decomposition.
+   */
+  enum EigensolverType {
+    kJacobi = 0,
+    kHouseholderQl,
+    kRandomized,
+    kNumEigensolverTypes,
+  };
+
   /**
    * Buffer for PrincipalComponentAnalysis class.
    */
@@ -81,6 +104,13 @@ class PrincipalComponentAnalysis {
     SymmetricMatrix a_;
     std::vector<int> order_of_eigenvalue_;
 
+    Matrix full_a_;
+    Matrix v_;
+    Matrix q_;
+    Matrix z_;
+    std::vector<double> d_;
+    std::vector<double> e_;
+
     friend class PrincipalComponentAnalysis;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
   };
@@ -90,10 +120,15 @@ class PrincipalComponentAnalysis {
    * @param[in] num_iteration Number of iterations.
    * @param[in] convergence_threshold Convergence threshold.
    * @param[in] covariance_type Type of covariance.
+   * @param[in] eigensolver_type Type of eigenvalue decomposition.
+   * @param[in] num_principal_component Number of principal components,
+   *            @f$K@f$. This is used only in the randomized method.
    */
   PrincipalComponentAnalysis(int num_order, int num_iteration,
                              double convergence_threshold,
-                             CovarianceType covariance_type);
+                             CovarianceType covariance_type,
+                             EigensolverType eigensolver_type = kJacobi,
+                             int num_principal_component = 0);
 
   virtual ~PrincipalComponentAnalysis() {
   }
@@ -126,6 +161,20 @@ class PrincipalComponentAnalysis {
     return covariance_type_;
   }
 
+  /**
+   * @return Type of eigenvalue decomposition.
+   */
+  EigensolverType GetEigensolverType() const {
+    return eigensolver_type_;
+  }
+
+  /**
+   * @return Number of principal components.
+   */
+  int GetNumPrincipalComponent() const {
+    return num_principal_component_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -133,6 +182,47 @@ class PrincipalComponentAnalysis {
     return is_valid_;
   }
 
+  /**
+   * Clear accumulated statistics.
+   *
+   * @param[in,out] buffer Buffer.
+   */
+  void Clear(PrincipalComponentAnalysis::Buffer* buffer) const;
+
+  /**
+   * Accumulate statistics of an input vector.
+   *
+   * @param[in] input_vector @f$M@f$-th order input vector.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Accumulate(const std::vector<double>& input_vector,
+                  PrincipalComponentAnalysis::Buffer* buffer) const;
+
+  /**
+   * Merge accumulated statistics.
+   *
+   * @param[in] other Buffer to be merged.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Merge(const PrincipalComponentAnalysis::Buffer& other,
+             PrincipalComponentAnalysis::Buffer* buffer) const;
+
+  /**
+   * Perform PCA using accumulated statistics.
+   *
+   * @param[out] mean_vector @f$M@f$-th order mean vector.
+   * @param[out] eigenvalues @f$M+1@f$ eigenvalues.
+   * @param[out] eigenvectors @f$M@f$-th order eigenvectors.
+   *             The shape is @f$[M+1, M+1]@f$.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(std::vector<double>* mean_vector, std::vector<double>* eigenvalues,
+           Matrix* eigenvectors,
+           PrincipalComponentAnalysis::Buffer* buffer) const;
+
   /**
    * @param[in] input_vectors @f$M@f$-th order input vectors.
    *            The shape is @f$[T, M+1]@f$.
@@ -149,10 +239,21 @@ class PrincipalComponentAnalysis {
            PrincipalComponentAnalysis::Buffer* buffer) const;
 
  private:
+  bool RunJacobi(std::vector<double>* eigenvalues, Matrix* eigenvectors,
+                 PrincipalComponentAnalysis::Buffer* buffer) const;
+
+  bool RunHouseholderQl(std::vector<double>* eigenvalues, Matrix* eigenvectors,
+                        PrincipalComponentAnalysis::Buffer* buffer) const;
+
+  bool RunRandomized(std::vector<double>* eigenvalues, Matrix* eigenvectors,
+                     PrincipalComponentAnalysis::Buffer* buffer) const;
+
   const int num_order_;
   const int num_iteration_;
   const double convergence_threshold_;
   const CovarianceType covariance_type_;
+  const EigensolverType eigensolver_type_;
+  const int num_principal_component_;
 
   const StatisticsAccumulation accumulation_;
 
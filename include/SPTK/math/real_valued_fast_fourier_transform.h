@@ -17,6 +17,7 @@
 #ifndef SPTK_MATH_REAL_VALUED_FAST_FOURIER_TRANSFORM_H_
 #define SPTK_MATH_REAL_VALUED_FAST_FOURIER_TRANSFORM_H_
 
+#include <mutex>   // std::call_once, std::once_flag
 #include <vector>  // std::vector
 
 #include "SPTK/math/fast_fourier_transform.h"
@@ -40,7 +41,9 @@ namespace sptk {
  *   \mathrm{Im}(X(0)), & \mathrm{Im}(X(1)), & \ldots, & \mathrm{Im}(X(L-1)),
  *   \end{array}
  * @f]
- * where @f$L@f$ is the FFT length and must be a power of two.
+ * where @f$L@f$ is the FFT length and must be a power of two. The transform
+ * can also be computed in single precision. The single-precision sine table is
+ * built at the first call of the single-precision transform.
  */
 class RealValuedFastFourierTransform {
  public:
@@ -58,6 +61,8 @@ class RealValuedFastFourierTransform {
    private:
     std::vector<double> real_part_input_;
     std::vector<double> imag_part_input_;
+    std::vector<float> float_real_part_input_;
+    std::vector<float> float_imag_part_input_;
 
     friend class RealValuedFastFourierTransform;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -119,7 +124,36 @@ class RealValuedFastFourierTransform {
   bool Run(std::vector<double>* real_part, std::vector<double>* imag_part,
            RealValuedFastFourierTransform::Buffer* buffer) const;
 
+  /**
+   * @param[in] real_part_input @f$M@f$-th order real part of input.
+   * @param[out] real_part_output @f$L@f$-length real part of output.
+   * @param[out] imag_part_output @f$L@f$-length imaginary part of output.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<float>& real_part_input,
+           std::vector<float>* real_part_output,
+           std::vector<float>* imag_part_output,
+           RealValuedFastFourierTransform::Buffer* buffer) const;
+
+  /**
+   * @param[in,out] real_part Real part.
+   * @param[out] imag_part Imaginary part.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(std::vector<float>* real_part, std::vector<float>* imag_part,
+           RealValuedFastFourierTransform::Buffer* buffer) const;
+
  private:
+  template <typename T>
+  bool Transform(const std::vector<T>& real_part_input,
+                 const std::vector<T>& sine_table,
+                 std::vector<T>* real_part_output,
+                 std::vector<T>* imag_part_output,
+                 std::vector<T>* real_part_buffer,
+                 std::vector<T>* imag_part_buffer) const;
+
   const int num_order_;
   const int fft_length_;
   const int half_fft_length_;
@@ -130,6 +164,9 @@ class RealValuedFastFourierTransform {
 
   std::vector<double> sine_table_;
 
+  mutable std::once_flag float_sine_table_flag_;
+  mutable std::vector<float> float_sine_table_;
+
   DISALLOW_COPY_AND_ASSIGN(RealValuedFastFourierTransform);
 };
 
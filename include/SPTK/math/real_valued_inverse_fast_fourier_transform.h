@@ -106,7 +106,34 @@ class RealValuedInverseFastFourierTransform {
   bool Run(std::vector<double>* real_part, std::vector<double>* imag_part,
            RealValuedInverseFastFourierTransform::Buffer* buffer) const;
 
+  /**
+   * @param[in] real_part_input @f$M@f$-th order real part of input.
+   * @param[out] real_part_output @f$L@f$-length real part of output.
+   * @param[out] imag_part_output @f$L@f$-length imaginary part of output.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<float>& real_part_input,
+           std::vector<float>* real_part_output,
+           std::vector<float>* imag_part_output,
+           RealValuedInverseFastFourierTransform::Buffer* buffer) const;
+
+  /**
+   * @param[in,out] real_part Real part.
+   * @param[out] imag_part Imaginary part.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(std::vector<float>* real_part, std::vector<float>* imag_part,
+           RealValuedInverseFastFourierTransform::Buffer* buffer) const;
+
  private:
+  template <typename T>
+  bool Transform(const std::vector<T>& real_part_input,
+                 std::vector<T>* real_part_output,
+                 std::vector<T>* imag_part_output,
+                 RealValuedInverseFastFourierTransform::Buffer* buffer) const;
+
   const RealValuedFastFourierTransform fast_fourier_transform_;
 
   DISALLOW_COPY_AND_ASSIGN(RealValuedInverseFastFourierTransform);
@@ -41,6 +41,23 @@ class ScalarOperation {
      * @param[in,out] is_magic_number True if output is magic number.
      */
     virtual bool Run(double* number, bool* is_magic_number) const = 0;
+
+    /**
+     * @param[in,out] numbers Input/output numbers.
+     * @param[in,out] is_magic_numbers True if output is magic number.
+     */
+    virtual bool Run(std::vector<double>* numbers,
+                     std::vector<bool>* is_magic_numbers) const {
+      const int size(static_cast<int>(numbers->size()));
+      for (int i(0); i < size; ++i) {
+        bool is_magic_number((*is_magic_numbers)[i]);
+        if (!Run(&((*numbers)[i]), &is_magic_number)) {
+          return false;
+        }
+        (*is_magic_numbers)[i] = is_magic_number;
+      }
+      return true;
+    }
   };
 
   ScalarOperation() : use_magic_number_(false) {
@@ -149,9 +166,11 @@ class ScalarOperation {
   /**
    * @f$\ln{x}@f$
    *
+   * @param[in] use_approximation If true, the approximation of sptk::Log is
+   *            used.
    * @return True on success, false on failure.
    */
-  bool AddNaturalLogarithmOperation();
+  bool AddNaturalLogarithmOperation(bool use_approximation = false);
 
   /**
    * @f$\log_b{x}@f$
@@ -164,9 +183,11 @@ class ScalarOperation {
   /**
    * @f$\exp{x}@f$
    *
+   * @param[in] use_approximation If true, the approximation of sptk::Exp is
+   *            used.
    * @return True on success, false on failure.
    */
-  bool AddNaturalExponentialOperation();
+  bool AddNaturalExponentialOperation(bool use_approximation = false);
 
   /**
    * @f$b^x@f$
@@ -290,6 +311,14 @@ class ScalarOperation {
    */
   bool Run(double* number, bool* is_magic_number) const;
 
+  /**
+   * @param[in,out] numbers Input/output numbers.
+   * @param[out] is_magic_numbers True if output is magic number.
+   * @return True on success, false on failure.
+   */
+  bool Run(std::vector<double>* numbers,
+           std::vector<bool>* is_magic_numbers) const;
+
  private:
   bool use_magic_number_;
 
@@ -19,6 +19,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -86,6 +87,16 @@ class SecondOrderAllPassInverseFrequencyTransform {
   bool Run(const std::vector<double>& warped_sequence,
            std::vector<double>* minimum_phase_sequence) const;
 
+  /**
+   * @param[in] warped_sequences @f$M_1@f$-th order input sequences.
+   *            The shape is @f$[T, M_1+1]@f$.
+   * @param[out] minimum_phase_sequences @f$M_2@f$-th order output sequences.
+   *             The shape is @f$[T, M_2+1]@f$.
+   * @return True on success, false on failure.
+   */
+  bool Run(const Matrix& warped_sequences,
+           Matrix* minimum_phase_sequences) const;
+
  private:
   const int num_input_order_;
   const int num_output_order_;
@@ -94,7 +105,8 @@ class SecondOrderAllPassInverseFrequencyTransform {
 
   bool is_valid_;
 
-  std::vector<std::vector<double> > conversion_matrix_;
+  // The shape is [M_1+1, M_2+1].
+  Matrix conversion_matrix_;
 
   DISALLOW_COPY_AND_ASSIGN(SecondOrderAllPassInverseFrequencyTransform);
 };
@@ -0,0 +1,174 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_MATH_SHORT_TIME_FOURIER_TRANSFORM_H_
+#define SPTK_MATH_SHORT_TIME_FOURIER_TRANSFORM_H_
+
+#include <mutex>   // std::call_once, std::once_flag
+#include <vector>  // std::vector
+
+#include "SPTK/conversion/spectrum_to_spectrum.h"
+#include "SPTK/math/real_valued_fast_fourier_transform.h"
+#include "SPTK/utils/sptk_utils.h"
+#include "SPTK/window/data_windowing.h"
+#include "SPTK/window/window_interface.h"
+
+namespace sptk {
+
+/**
+ * Compute short-time spectrum of streaming waveform.
+ *
+ * This class is equivalent to DataWindowing followed by WaveformToSpectrum,
+ * but the frames are not extracted explicitly. The waveform signals are given
+ * in arbitrary-length chunks and stored in a ring buffer of the frame length
+ * @f$L@f$. For each chunk, the latest @f$L@f$ signals are multiplied by the
+ * normalized window and directly transformed by the real-valued FFT. Thus each
+ * signal is copied only once even if the frames overlap. The signals before
+ * the first chunk are regarded as zeros.
+ *
+ * The output is the @f$(N/2+1)@f$-length spectrum of the latest frame and its
+ * format is the same as that of WaveformToSpectrum, where @f$N@f$ is the FFT
+ * length.
+ *
+ * The windowing and the FFT can also be computed in single precision. Only the
+ * final conversion of the spectrum is computed in double precision. A buffer
+ * should be used with only one precision.
+ */
+class ShortTimeFourierTransform {
+ public:
+  /**
+   * Buffer for ShortTimeFourierTransform class.
+   */
+  class Buffer {
+   public:
+    Buffer() : position_(0) {
+    }
+
+    virtual ~Buffer() {
+    }
+
+   private:
+    std::vector<double> ring_buffer_;
+    int position_;
+
+    std::vector<double> windowed_frame_;
+    std::vector<double> fast_fourier_transform_real_output_;
+    std::vector<double> fast_fourier_transform_imag_output_;
+    RealValuedFastFourierTransform::Buffer fast_fourier_transform_buffer_;
+
+    std::vector<float> float_ring_buffer_;
+    std::vector<float> float_windowed_frame_;
+    std::vector<float> float_fast_fourier_transform_real_output_;
+    std::vector<float> float_fast_fourier_transform_imag_output_;
+    std::vector<double> spectrum_;
+
+    friend class ShortTimeFourierTransform;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
+  /**
+   * @param[in] window @f$L@f$-length window.
+   * @param[in] fft_length FFT length, @f$N@f$.
+   * @param[in] normalization_type Type of window normalization.
+   * @param[in] output_format Output format.
+   * @param[in] epsilon Small value added to power spectrum.
+   * @param[in] relative_floor_in_decibels Relative floor in decibels.
+   */
+  ShortTimeFourierTransform(
+      WindowInterface* window, int fft_length,
+      DataWindowing::NormalizationType normalization_type,
+      SpectrumToSpectrum::InputOutputFormats output_format, double epsilon,
+      double relative_floor_in_decibels);
+
+  virtual ~ShortTimeFourierTransform() {
+  }
+
+  /**
+   * @return Frame length.
+   */
+  int GetFrameLength() const {
+    return frame_length_;
+  }
+
+  /**
+   * @return FFT length.
+   */
+  int GetFftLength() const {
+    return fft_length_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * Clear waveform signals stored in buffer.
+   *
+   * @param[out] buffer Buffer.
+   */
+  void Clear(ShortTimeFourierTransform::Buffer* buffer) const;
+
+  /**
+   * @param[in] waveform New waveform signals.
+   * @param[out] spectrum @f$(N/2+1)@f$-length spectrum of latest frame.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& waveform, std::vector<double>* spectrum,
+           ShortTimeFourierTransform::Buffer* buffer) const;
+
+  /**
+   * @param[in] waveform New waveform signals.
+   * @param[out] spectrum @f$(N/2+1)@f$-length spectrum of latest frame.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<float>& waveform, std::vector<float>* spectrum,
+           ShortTimeFourierTransform::Buffer* buffer) const;
+
+ private:
+  template <typename T>
+  bool ComputePowerSpectrum(const std::vector<T>& waveform,
+                            const std::vector<T>& window,
+                            std::vector<T>* power_spectrum,
+                            std::vector<T>* ring_buffer,
+                            std::vector<T>* windowed_frame,
+                            std::vector<T>* real_part,
+                            std::vector<T>* imag_part,
+                            ShortTimeFourierTransform::Buffer* buffer) const;
+
+  const int frame_length_;
+  const int fft_length_;
+
+  const RealValuedFastFourierTransform fast_fourier_transform_;
+  const SpectrumToSpectrum spectrum_to_spectrum_;
+
+  bool is_valid_;
+
+  std::vector<double> window_;
+
+  mutable std::once_flag float_window_flag_;
+  mutable std::vector<float> float_window_;
+
+  DISALLOW_COPY_AND_ASSIGN(ShortTimeFourierTransform);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_MATH_SHORT_TIME_FOURIER_TRANSFORM_H_
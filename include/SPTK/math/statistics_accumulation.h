@@ -42,6 +42,15 @@ namespace sptk {
  * @f}
  * Then, the moments, e.g., mean and covariance, of the input data can be
  * computed from the accumulated statistics @f$\{S_k\}_{k=0}^K@f$.
+ *
+ * To avoid the cancellation in computing covariance, the second order
+ * statistics are actually accumulated around the running mean by Welford's
+ * algorithm:
+ * @f[
+ *   \bar{S}_2(m,n) = \sum_{t=0}^{T-1} (x_t(m) - \mu(m)) (x_t(n) - \mu(n)),
+ * @f]
+ * where @f$\mu(m) = S_1(m) / S_0@f$. Two sets of statistics accumulated
+ * separately, e.g., in different threads, can be merged by @c Merge.
  */
 class StatisticsAccumulation {
  public:
@@ -67,6 +76,7 @@ class StatisticsAccumulation {
     int zeroth_order_statistics_;
     std::vector<double> first_order_statistics_;
     SymmetricMatrix second_order_statistics_;
+    std::vector<double> delta_;
 
     friend class StatisticsAccumulation;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -183,6 +193,30 @@ class StatisticsAccumulation {
   bool Run(const std::vector<double>& data,
            StatisticsAccumulation::Buffer* buffer) const;
 
+  /**
+   * Merge statistics.
+   *
+   * @param[in] num_data Number of data.
+   * @param[in] mean Mean of data.
+   * @param[in] full_covariance Full covariance of data. This is not used if
+   *            the order of statistics is less than two.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Merge(int num_data, const std::vector<double>& mean,
+             const SymmetricMatrix& full_covariance,
+             StatisticsAccumulation::Buffer* buffer) const;
+
+  /**
+   * Merge statistics.
+   *
+   * @param[in] other Buffer to be merged.
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Merge(const StatisticsAccumulation::Buffer& other,
+             StatisticsAccumulation::Buffer* buffer) const;
+
  private:
   const int num_order_;
   const int num_statistics_order_;
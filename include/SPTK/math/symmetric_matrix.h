@@ -27,7 +27,7 @@ namespace sptk {
 class SymmetricMatrix {
  public:
   /**
-   * A row of symmetric matrix.a
+   * A row of symmetric matrix.
    */
   class Row {
    public:
@@ -45,13 +45,19 @@ class SymmetricMatrix {
      * @param[in] column Column index.
      * @return Element.
      */
-    double& operator[](int column);
+    double& operator[](int column) {
+      return (row_ < column) ? matrix_.index_[column][row_]
+                             : matrix_.index_[row_][column];
+    }
 
     /**
      * @param[in] column Column index.
      * @return Element.
      */
-    const double& operator[](int column) const;
+    const double& operator[](int column) const {
+      return (row_ < column) ? matrix_.index_[column][row_]
+                             : matrix_.index_[row_][column];
+    }
 
    private:
     const SymmetricMatrix& matrix_;
@@ -159,6 +165,15 @@ class SymmetricMatrix {
   bool CholeskyDecomposition(SymmetricMatrix* lower_triangular_matrix,
                              std::vector<double>* diagonal_elements) const;
 
+  /**
+   * Perform in-place Cholesky decomposition. The matrix is overwritten by the
+   * unit lower triangular matrix.
+   *
+   * @param[out] diagonal_elements Diagonal elements.
+   * @return True on success, false on failure.
+   */
+  bool CholeskyDecomposition(std::vector<double>* diagonal_elements);
+
   /**
    * Compute inverse matrix.
    *
@@ -19,6 +19,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/math/matrix.h"
 #include "SPTK/math/symmetric_matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
@@ -43,6 +44,8 @@ namespace sptk {
  *     x(0), & x(1), & \ldots, & x(M).
  *   \end{array}
  * @f]
+ * The system is solved via the Cholesky decomposition
+ * @f$\boldsymbol{A} = \boldsymbol{L}\boldsymbol{D}\boldsymbol{L}^{\mathsf{T}}@f$.
  */
 class SymmetricSystemSolver {
  public:
@@ -58,7 +61,8 @@ class SymmetricSystemSolver {
     }
 
    private:
-    SymmetricMatrix inverse_matrix_;
+    SymmetricMatrix lower_triangular_matrix_;
+    std::vector<double> diagonal_elements_;
 
     friend class SymmetricSystemSolver;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -57,12 +57,12 @@ class TwoDimensionalFastFourierTransform {
     }
 
    private:
-    std::vector<double> real_part_input_;
-    std::vector<double> imag_part_input_;
-    std::vector<std::vector<double> > first_real_part_outputs_;
-    std::vector<std::vector<double> > first_imag_part_outputs_;
-    std::vector<std::vector<double> > second_real_part_outputs_;
-    std::vector<std::vector<double> > second_imag_part_outputs_;
+    Matrix first_real_part_inputs_;
+    Matrix first_imag_part_inputs_;
+    Matrix first_real_part_outputs_;
+    Matrix first_imag_part_outputs_;
+    Matrix second_real_part_inputs_;
+    Matrix second_imag_part_inputs_;
 
     friend class TwoDimensionalFastFourierTransform;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
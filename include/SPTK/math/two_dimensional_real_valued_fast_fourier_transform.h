@@ -41,7 +41,9 @@ namespace sptk {
  *     \mathrm{Re}(\boldsymbol{X}), & \mathrm{Im}(\boldsymbol{X}),
  *   \end{array}
  * @f]
- * where @f$L@f$ is the FFT length and must be a power of two.
+ * where @f$L@f$ is the FFT length and must be a power of two. Since the
+ * outputs are conjugate symmetric, only the first @f$L/2+1@f$ rows are
+ * computed by FFT and the others are copied from them.
  */
 class TwoDimensionalRealValuedFastFourierTransform {
  public:
@@ -57,13 +59,11 @@ class TwoDimensionalRealValuedFastFourierTransform {
     }
 
    private:
-    std::vector<double> real_part_input_;
-    std::vector<double> imag_part_input_;
-    std::vector<std::vector<double> > first_real_part_outputs_;
-    std::vector<std::vector<double> > first_imag_part_outputs_;
-    std::vector<std::vector<double> > second_real_part_outputs_;
-    std::vector<std::vector<double> > second_imag_part_outputs_;
-    RealValuedFastFourierTransform::Buffer fast_fourier_transform_buffer_;
+    Matrix first_real_part_inputs_;
+    Matrix first_real_part_outputs_;
+    Matrix first_imag_part_outputs_;
+    Matrix second_real_part_inputs_;
+    Matrix second_imag_part_inputs_;
 
     friend class TwoDimensionalRealValuedFastFourierTransform;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -89,12 +89,15 @@ bool ComputePercentagePointOfTDistribution(double probability,
  * @param[in] initial_step_size Initial step size.
  * @param[out] filter_banks Filter banks.
  * @param[out] is_converged True if convergence is reached (optional).
+ * @param[out] impulse_response Impulse response of prototype filter
+ *             (optional).
  * @return True on success, false on failure.
  */
 bool MakePseudoQuadratureMirrorFilterBanks(
     bool inverse, int num_subband, int num_order, double attenuation,
     int num_iteration, double convergence_threshold, double initial_step_size,
-    std::vector<std::vector<double> >* filter_banks, bool* is_converged);
+    std::vector<std::vector<double> >* filter_banks, bool* is_converged,
+    std::vector<double>* impulse_response);
 
 /**
  * Perform 1D convolution.
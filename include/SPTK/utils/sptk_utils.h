@@ -244,6 +244,60 @@ double FloorLog10(double num);
  */
 double AddInLogSpace(double log_x, double log_y);
 
+/**
+ * Compute log-sum-exp of values.
+ *
+ * If @p use_approximation is true, the exponential function is replaced with
+ * the polynomial approximation used in sptk::Exp.
+ *
+ * @param[in] log_x @f$\ln(x_0), \ldots, \ln(x_{N-1})@f$.
+ * @param[in] size @f$N@f$.
+ * @param[in] use_approximation Whether to use approximation.
+ * @return @f$\ln(x_0 + \cdots + x_{N-1})@f$, or
+ *         @f$-1 \times 10^{10}@f$ if @f$N \le 0@f$.
+ */
+double LogSumExp(const double* log_x, int size, bool use_approximation = false);
+
+/**
+ * Compute exponential function of values.
+ *
+ * If @p use_approximation is false, @c std::exp is used. Otherwise, a
+ * branch-free polynomial approximation that the compiler can vectorize is
+ * used. Its error is within 1 ULP. The values whose results are not normalized
+ * numbers are computed by @c std::exp.
+ *
+ * @param[in] x @f$x_0, \ldots, x_{N-1}@f$.
+ * @param[in] size @f$N@f$.
+ * @param[out] y @f$e^{x_0}, \ldots, e^{x_{N-1}}@f$. It can be @p x.
+ * @param[in] use_approximation Whether to use approximation.
+ */
+void Exp(const double* x, int size, double* y, bool use_approximation = false);
+
+/**
+ * Compute natural logarithm of values.
+ *
+ * If @p use_approximation is false, @c std::log is used. Otherwise, a
+ * branch-free polynomial approximation that the compiler can vectorize is
+ * used. Its error is within 2 ULP. Zero, negative, denormalized, and
+ * non-finite values are computed by @c std::log.
+ *
+ * @param[in] x @f$x_0, \ldots, x_{N-1}@f$.
+ * @param[in] size @f$N@f$.
+ * @param[out] y @f$\ln(x_0), \ldots, \ln(x_{N-1})@f$. It can be @p x.
+ * @param[in] use_approximation Whether to use approximation.
+ */
+void Log(const double* x, int size, double* y, bool use_approximation = false);
+
+/**
+ * Compute power function of values by @c std::pow.
+ *
+ * @param[in] x @f$x_0, \ldots, x_{N-1}@f$.
+ * @param[in] exponent @f$a@f$.
+ * @param[in] size @f$N@f$.
+ * @param[out] y @f$x_0^a, \ldots, x_{N-1}^a@f$. It can be @p x.
+ */
+void Pow(const double* x, double exponent, int size, double* y);
+
 /**
  * @param[in] omega Angle, @f$\omega@f$.
  * @param[in] alpha Frequency warping factor, @f$\alpha@f$.
@@ -0,0 +1,147 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#ifndef SPTK_UTILS_THREAD_UTILS_H_
+#define SPTK_UTILS_THREAD_UTILS_H_
+
+#include <algorithm>  // std::copy, std::find, std::min
+#include <thread>     // std::thread
+#include <vector>     // std::vector
+
+#include "SPTK/math/matrix.h"
+
+namespace sptk {
+
+/**
+ * Get the number of threads to run a job.
+ *
+ * @param[in] num_operation Number of operations of the job.
+ * @param[in] min_num_operation Minimum number of operations to use multiple
+ *            threads.
+ * @param[in] max_num_thread Maximum number of threads.
+ * @return Number of threads.
+ */
+inline int GetNumThread(double num_operation, double min_num_operation,
+                        int max_num_thread) {
+  return (min_num_operation <= num_operation
+              ? std::min(static_cast<int>(std::thread::hardware_concurrency()),
+                         max_num_thread)
+              : 1);
+}
+
+/**
+ * Split rows into threads and process them.
+ *
+ * @param[in] num_row Number of rows.
+ * @param[in] num_thread Number of threads.
+ * @param[in] row_alignment The number of rows given to each thread is a
+ *            multiple of this value except for the last thread.
+ * @param[in] process_rows Function called as @c process_rows(begin, @c end) to
+ *            process rows [begin, end). It returns true on success.
+ * @return True if all the calls succeed.
+ */
+template <typename Function>
+bool ProcessRowsInParallel(int num_row, int num_thread, int row_alignment,
+                           Function process_rows) {
+  if (num_thread <= 1) {
+    return process_rows(0, num_row);
+  }
+
+  const int num_row_per_thread(
+      ((num_row + num_thread - 1) / num_thread + row_alignment - 1) /
+      row_alignment * row_alignment);
+  std::vector<int> is_succeeded(
+      (num_row + num_row_per_thread - 1) / num_row_per_thread, 0);
+  std::vector<std::thread> threads;
+  for (int i(0); i < static_cast<int>(is_succeeded.size()); ++i) {
+    const int begin(i * num_row_per_thread);
+    const int end(std::min(begin + num_row_per_thread, num_row));
+    int* result(&is_succeeded[i]);
+    threads.push_back(std::thread([&process_rows, begin, end, result]() {
+      *result = process_rows(begin, end) ? 1 : 0;
+    }));
+  }
+  for (std::vector<std::thread>::iterator itr(threads.begin());
+       itr != threads.end(); ++itr) {
+    itr->join();
+  }
+  return std::find(is_succeeded.begin(), is_succeeded.end(), 0) ==
+         is_succeeded.end();
+}
+
+/**
+ * Get the number of threads to transform rows of a matrix.
+ *
+ * @param[in] num_row Number of rows.
+ * @param[in] fft_length FFT length.
+ * @return Number of threads.
+ */
+inline int GetNumThreadToTransformRows(int num_row, int fft_length) {
+  const double kMinNumElementForMultithreading(65536.0);
+  return GetNumThread(static_cast<double>(num_row) * fft_length,
+                      kMinNumElementForMultithreading, num_row);
+}
+
+/**
+ * Apply a complex-valued transform to each row of matrices. Each row is padded
+ * with zeros to the transform length. The rows are split into threads if the
+ * number of elements is large enough.
+ *
+ * @param[in] fourier_transform Transform having @c GetFftLength() and
+ *            @c Run(x, @c y, @c real_part, @c imag_part), e.g.,
+ *            FastFourierTransform or InverseFastFourierTransform.
+ * @param[in] real_part_input Real part of input.
+ * @param[in] imag_part_input Imaginary part of input.
+ * @param[out] real_part_output Real part of output.
+ * @param[out] imag_part_output Imaginary part of output.
+ * @return True on success, false on failure.
+ */
+template <typename T>
+bool TransformRowsInParallel(const T& fourier_transform,
+                             const Matrix& real_part_input,
+                             const Matrix& imag_part_input,
+                             Matrix* real_part_output,
+                             Matrix* imag_part_output) {
+  const int num_row(real_part_input.GetNumRow());
+  const int fft_length(fourier_transform.GetFftLength());
+  const int num_column(real_part_input.GetNumColumn());
+  return ProcessRowsInParallel(
+      num_row, GetNumThreadToTransformRows(num_row, fft_length), 1,
+      [&](int begin, int end) {
+        std::vector<double> x(fft_length, 0.0);
+        std::vector<double> y(fft_length, 0.0);
+        std::vector<double> real_part(fft_length);
+        std::vector<double> imag_part(fft_length);
+        for (int i(begin); i < end; ++i) {
+          std::copy(real_part_input[i], real_part_input[i] + num_column,
+                    x.begin());
+          std::copy(imag_part_input[i], imag_part_input[i] + num_column,
+                    y.begin());
+          if (!fourier_transform.Run(x, y, &real_part, &imag_part)) {
+            return false;
+          }
+          std::copy(real_part.begin(), real_part.end(),
+                    (*real_part_output)[i]);
+          std::copy(imag_part.begin(), imag_part.end(),
+                    (*imag_part_output)[i]);
+        }
+        return true;
+      });
+}
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_THREAD_UTILS_H_
@@ -17,6 +17,7 @@
 #ifndef SPTK_WINDOW_DATA_WINDOWING_H_
 #define SPTK_WINDOW_DATA_WINDOWING_H_
 
+#include <mutex>   // std::call_once, std::once_flag
 #include <vector>  // std::vector
 
 #include "SPTK/utils/sptk_utils.h"
@@ -109,7 +110,18 @@ class DataWindowing {
   bool Run(const std::vector<double>& data,
            std::vector<double>* windowed_data) const;
 
+  /**
+   * @param[in] data @f$L_1@f$-length input data.
+   * @param[out] windowed_data @f$L_2@f$-length output data.
+   */
+  bool Run(const std::vector<float>& data,
+           std::vector<float>* windowed_data) const;
+
  private:
+  template <typename T>
+  bool Apply(const std::vector<T>& window, const std::vector<T>& data,
+             std::vector<T>* windowed_data) const;
+
   const int input_length_;
   const int output_length_;
 
@@ -117,6 +129,9 @@ class DataWindowing {
 
   std::vector<double> window_;
 
+  mutable std::once_flag float_window_flag_;
+  mutable std::vector<float> float_window_;
+
   DISALLOW_COPY_AND_ASSIGN(DataWindowing);
 };
 
@@ -68,12 +68,14 @@ namespace sptk {
 
 MelCepstralAnalysis::MelCepstralAnalysis(int fft_length, int num_order,
                                          double alpha, int num_iteration,
-                                         double convergence_threshold)
+                                         double convergence_threshold,
+                                         bool warm_start)
     : fft_length_(fft_length),
       num_order_(num_order),
       alpha_(alpha),
       num_iteration_(num_iteration),
       convergence_threshold_(convergence_threshold),
+      warm_start_(warm_start),
       fourier_transform_(fft_length_),
       inverse_fourier_transform_(fft_length_),
       frequency_transform_(fft_length_ / 2, num_order_, alpha_),
@@ -100,6 +102,13 @@ MelCepstralAnalysis::MelCepstralAnalysis(int fft_length, int num_order,
 bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
                               std::vector<double>* mel_cepstrum,
                               MelCepstralAnalysis::Buffer* buffer) const {
+  return Run(periodogram, mel_cepstrum, NULL, buffer);
+}
+
+bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
+                              std::vector<double>* mel_cepstrum,
+                              int* num_iteration,
+                              MelCepstralAnalysis::Buffer* buffer) const {
   // Check inputs.
   const int half_fft_length(fft_length_ / 2);
   if (!is_valid_ ||
@@ -117,9 +126,6 @@ bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
       static_cast<std::size_t>(half_fft_length + 1)) {
     buffer->log_periodogram_.resize(half_fft_length + 1);
   }
-  if (buffer->cepstrum_.size() != static_cast<std::size_t>(fft_length_)) {
-    buffer->cepstrum_.resize(fft_length_);
-  }
   if (buffer->rt_.size() != static_cast<std::size_t>(2 * length - 1)) {
     buffer->rt_.resize(2 * length - 1);
   }
@@ -133,13 +139,14 @@ bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
     buffer->gradient_.resize(length);
   }
 
+  std::transform(periodogram.begin(), periodogram.end(),
+                 buffer->log_periodogram_.begin(),
+                 [](double p) { return std::log(p); });
+
   // Make an initial guess.
   {
-    std::transform(periodogram.begin(), periodogram.end(),
-                   buffer->log_periodogram_.begin(),
-                   [](double p) { return std::log(p); });
-
     // \log I_N -> c
+    buffer->cepstrum_.resize(fft_length_);
     std::copy(buffer->log_periodogram_.begin(), buffer->log_periodogram_.end(),
               buffer->cepstrum_.begin());
     std::reverse_copy(buffer->log_periodogram_.begin() + 1,
@@ -161,7 +168,62 @@ bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
     }
   }
 
+  int num_performed_iteration(0);
+  bool is_converged(false);
+  if (NULL != num_iteration) {
+    *num_iteration = 0;
+  }
+
+  // Add the correction made in the previous frame to the initial guess. If
+  // the iteration does not converge, start over from the initial guess.
+  if (warm_start_) {
+    buffer->initial_mel_cepstrum_ = *mel_cepstrum;
+    if (buffer->correction_.size() == static_cast<std::size_t>(length)) {
+      std::transform(mel_cepstrum->begin(), mel_cepstrum->end(),
+                     buffer->correction_.begin(), mel_cepstrum->begin(),
+                     std::plus<double>());
+      const bool is_succeeded(NewtonRaphsonMethod(
+          mel_cepstrum, &num_performed_iteration, &is_converged, buffer));
+      if (NULL != num_iteration) {
+        *num_iteration = num_performed_iteration;
+      }
+      if (!is_succeeded || !is_converged) {
+        *mel_cepstrum = buffer->initial_mel_cepstrum_;
+      }
+    }
+  }
+
   // Perform Newton-Raphson method.
+  if (!is_converged) {
+    if (!NewtonRaphsonMethod(mel_cepstrum, &num_performed_iteration,
+                             &is_converged, buffer)) {
+      return false;
+    }
+    if (NULL != num_iteration) {
+      *num_iteration += num_performed_iteration;
+    }
+  }
+
+  // Keep the correction for the next frame.
+  if (warm_start_) {
+    buffer->correction_.resize(length);
+    std::transform(mel_cepstrum->begin(), mel_cepstrum->end(),
+                   buffer->initial_mel_cepstrum_.begin(),
+                   buffer->correction_.begin(), std::minus<double>());
+  }
+
+  return true;
+}
+
+bool MelCepstralAnalysis::NewtonRaphsonMethod(
+    std::vector<double>* mel_cepstrum, int* num_iteration, bool* is_converged,
+    MelCepstralAnalysis::Buffer* buffer) const {
+  const int half_fft_length(fft_length_ / 2);
+  const int length(num_order_ + 1);
+
+  *num_iteration = 0;
+  *is_converged = false;
+
   double prev_epsilon(DBL_MAX);
   for (int n(0); n < num_iteration_; ++n) {
     // \tilde{c} -> c
@@ -208,6 +270,7 @@ bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
       const double epsilon(buffer->rt_[0]);
       const double relative_change((epsilon - prev_epsilon) / epsilon);
       if (std::fabs(relative_change) < convergence_threshold_) {
+        *is_converged = true;
         break;
       }
       prev_epsilon = epsilon;
@@ -235,6 +298,7 @@ bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
     std::transform(mel_cepstrum->begin(), mel_cepstrum->end(),
                    buffer->gradient_.begin(), mel_cepstrum->begin(),
                    std::plus<double>());
+    *num_iteration = n + 1;
   }
 
   return true;
@@ -34,6 +34,31 @@ double SampleMel(int index, int fft_length, double sampling_rate) {
   return HzToMel(hz);
 }
 
+// Apply the filter banks to four frames at once. Each sum is accumulated in
+// the same order as in the case of a single frame.
+void ApplyFilterBanks(int num_channel, const int* first_bin_indices,
+                      const int* offsets, const double* weights,
+                      const double* x0, const double* x1, const double* x2,
+                      const double* x3, double* y0, double* y1, double* y2,
+                      double* y3) {
+  for (int m(0); m < num_channel; ++m) {
+    const int k(first_bin_indices[m]);
+    const double* w(weights + offsets[m]);
+    const int num_bin(offsets[m + 1] - offsets[m]);
+    double sum0(0.0), sum1(0.0), sum2(0.0), sum3(0.0);
+    for (int i(0); i < num_bin; ++i) {
+      sum0 += x0[k + i] * w[i];
+      sum1 += x1[k + i] * w[i];
+      sum2 += x2[k + i] * w[i];
+      sum3 += x3[k + i] * w[i];
+    }
+    y0[m] = sum0;
+    y1[m] = sum1;
+    y2[m] = sum2;
+    y3[m] = sum3;
+  }
+}
+
 }  // namespace
 
 namespace sptk {
@@ -84,8 +109,9 @@ MelFilterBankAnalysis::MelFilterBankAnalysis(int fft_length, int num_channel,
   }
 
   // Create lower channel map.
-  channel_indices_.resize(fft_length_ / 2, -1);
-  int* map(&(channel_indices_[0]));
+  const int half_fft_length(fft_length_ / 2);
+  std::vector<int> channel_indices(half_fft_length, -1);
+  int* map(&(channel_indices[0]));
   {
     for (int k(lower_bin_index_), m(0); k < upper_bin_index_; ++k) {
       const double mel_k(SampleMel(k, fft_length_, sampling_rate));
@@ -95,8 +121,8 @@ MelFilterBankAnalysis::MelFilterBankAnalysis(int fft_length, int num_channel,
   }
 
   // Create vector of lower channel weights.
-  channel_weights_.resize(fft_length_ / 2);
-  double* w(&(channel_weights_[0]));
+  std::vector<double> channel_weights(half_fft_length);
+  double* w(&(channel_weights[0]));
   for (int k(lower_bin_index_); k < upper_bin_index_; ++k) {
     const double mel_k(SampleMel(k, fft_length_, sampling_rate));
     const int m(map[k]);
@@ -106,11 +132,34 @@ MelFilterBankAnalysis::MelFilterBankAnalysis(int fft_length, int num_channel,
       w[k] = (cf[0] - mel_k) / (cf[0] - mel_low);
     }
   }
+
+  // Store the filter banks as a sparse matrix. Since the lower channel map is
+  // monotonic, the bins covered by each channel are contiguous. The m-th
+  // channel consists of the bins mapped to m (rising edge) followed by those
+  // mapped to m+1 (falling edge).
+  first_bin_indices_.resize(num_channel_);
+  offsets_.resize(num_channel_ + 1);
+  weights_.clear();
+  weights_.reserve(2 * (upper_bin_index_ - lower_bin_index_));
+  {
+    int k(lower_bin_index_);
+    for (int m(0); m < num_channel_; ++m) {
+      while (k < upper_bin_index_ && map[k] < m) ++k;
+      first_bin_indices_[m] = k;
+      offsets_[m] = static_cast<int>(weights_.size());
+      for (int j(k); j < upper_bin_index_ && map[j] <= m + 1; ++j) {
+        weights_.push_back(map[j] == m ? 1.0 - w[j] : w[j]);
+      }
+    }
+    offsets_[num_channel_] = static_cast<int>(weights_.size());
+  }
 }
 
-bool MelFilterBankAnalysis::Run(const std::vector<double>& power_spectrum,
-                                std::vector<double>* filter_bank_output,
-                                double* energy) const {
+template <typename T>
+bool MelFilterBankAnalysis::Apply(const std::vector<T>& power_spectrum,
+                                  const T* weights,
+                                  std::vector<T>* filter_bank_output,
+                                  T* energy) const {
   // Check inputs.
   if (!is_valid_ ||
       power_spectrum.size() != static_cast<std::size_t>(fft_length_ / 2 + 1) ||
@@ -123,39 +172,140 @@ bool MelFilterBankAnalysis::Run(const std::vector<double>& power_spectrum,
     filter_bank_output->resize(num_channel_);
   }
 
-  std::fill(filter_bank_output->begin(), filter_bank_output->end(), 0.0);
-
-  // Apply mel-filter-banks.
-  const int* map(&(channel_indices_[0]));
-  const double* w(&(channel_weights_[0]));
-  const double* input(&(power_spectrum[0]));
-  double* output(&((*filter_bank_output)[0]));
-  for (int k(lower_bin_index_); k < upper_bin_index_; ++k) {
-    const int m(map[k]);
-    const double x(use_power_ ? input[k] : std::sqrt(input[k]));
-    if (0 < m) {
-      output[m - 1] += x * w[k];
-    }
-    if (m < num_channel_) {
-      output[m] += x * (1.0 - w[k]);
+  // Apply mel-filter-banks. In the case of amplitude, the square root is
+  // taken inline; each bin is used by at most two channels, which is cheaper
+  // than storing the amplitude spectrum in a temporary vector.
+  const int* first_bin_indices(&(first_bin_indices_[0]));
+  const int* offsets(&(offsets_[0]));
+  const T* input(&(power_spectrum[0]));
+  T* output(&((*filter_bank_output)[0]));
+  for (int m(0); m < num_channel_; ++m) {
+    const T* x(input + first_bin_indices[m]);
+    const T* w(weights + offsets[m]);
+    const int num_bin(offsets[m + 1] - offsets[m]);
+    T sum(0);
+    if (use_power_) {
+      for (int i(0); i < num_bin; ++i) {
+        sum += x[i] * w[i];
+      }
+    } else {
+      for (int i(0); i < num_bin; ++i) {
+        sum += std::sqrt(x[i]) * w[i];
+      }
     }
+    output[m] = sum;
   }
 
   // Apply logarithm function.
+  const T floor(static_cast<T>(floor_));
   for (int m(0); m < num_channel_; ++m) {
-    if (output[m] < floor_) output[m] = floor_;
+    if (output[m] < floor) output[m] = floor;
     output[m] = std::log(output[m]);
   }
 
   if (NULL != energy) {
-    const double sum(
+    const T sum(
         std::accumulate(power_spectrum.begin() + 1, power_spectrum.end() - 1,
                         power_spectrum.front() + power_spectrum.back(),
-                        [](double a, double x) { return a + 2.0 * x; }));
+                        [](T a, T x) { return a + T(2) * x; }));
     *energy = std::log(sum / fft_length_);
   }
 
   return true;
 }
 
+bool MelFilterBankAnalysis::Run(const std::vector<double>& power_spectrum,
+                                std::vector<double>* filter_bank_output,
+                                double* energy) const {
+  return Apply(power_spectrum, weights_.empty() ? NULL : &(weights_[0]),
+               filter_bank_output, energy);
+}
+
+bool MelFilterBankAnalysis::Run(const std::vector<float>& power_spectrum,
+                                std::vector<float>* filter_bank_output,
+                                float* energy) const {
+  std::call_once(float_weights_flag_, [this]() {
+    float_weights_.assign(weights_.begin(), weights_.end());
+  });
+  return Apply(power_spectrum,
+               float_weights_.empty() ? NULL : &(float_weights_[0]),
+               filter_bank_output, energy);
+}
+
+bool MelFilterBankAnalysis::Run(const Matrix& power_spectra,
+                                Matrix* filter_bank_outputs,
+                                std::vector<double>* energies) const {
+  // Check inputs.
+  const int num_frame(power_spectra.GetNumRow());
+  const int length(fft_length_ / 2 + 1);
+  if (!is_valid_ || power_spectra.GetNumColumn() != length ||
+      NULL == filter_bank_outputs) {
+    return false;
+  }
+
+  // Prepare memories.
+  if (filter_bank_outputs->GetNumRow() != num_frame ||
+      filter_bank_outputs->GetNumColumn() != num_channel_) {
+    filter_bank_outputs->Resize(num_frame, num_channel_);
+  }
+  if (NULL != energies &&
+      energies->size() != static_cast<std::size_t>(num_frame)) {
+    energies->resize(num_frame);
+  }
+  if (0 == num_frame) {
+    return true;
+  }
+
+  // Apply mel-filter-banks to four frames at a time. In the case of amplitude,
+  // the square roots of the four frames are stored in a small buffer.
+  const int* first_bin_indices(&(first_bin_indices_[0]));
+  const int* offsets(&(offsets_[0]));
+  const double* weights(weights_.empty() ? NULL : &(weights_[0]));
+  Matrix amplitude_spectra(use_power_ ? 0 : 4, use_power_ ? 0 : length);
+  for (int t(0); t < num_frame; t += 4) {
+    const double* x[4];
+    double* y[4];
+    for (int i(0); i < 4; ++i) {
+      // The last frame is repeated if the number of frames is not a multiple
+      // of four.
+      const int s(t + i < num_frame ? t + i : num_frame - 1);
+      y[i] = (*filter_bank_outputs)[s];
+      if (use_power_) {
+        x[i] = power_spectra[s];
+      } else {
+        const double* input(power_spectra[s]);
+        double* amplitude(amplitude_spectra[i]);
+        for (int k(lower_bin_index_); k < upper_bin_index_; ++k) {
+          amplitude[k] = std::sqrt(input[k]);
+        }
+        x[i] = amplitude;
+      }
+    }
+    ApplyFilterBanks(num_channel_, first_bin_indices, offsets, weights, x[0],
+                     x[1], x[2], x[3], y[0], y[1], y[2], y[3]);
+  }
+
+  // Apply logarithm function.
+  for (int t(0); t < num_frame; ++t) {
+    double* output((*filter_bank_outputs)[t]);
+    for (int m(0); m < num_channel_; ++m) {
+      if (output[m] < floor_) output[m] = floor_;
+      output[m] = std::log(output[m]);
+    }
+  }
+
+  if (NULL != energies) {
+    for (int t(0); t < num_frame; ++t) {
+      const double* x(power_spectra[t]);
+      double sum(x[0] + x[length - 1]);
+      for (int k(1); k < length - 1; ++k) {
+        sum = sum + 2.0 * x[k];
+      }
+      (*energies)[t] = std::log(sum / fft_length_);
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
@@ -96,4 +96,42 @@ bool MelFrequencyCepstralCoefficientsAnalysis::Run(
   return true;
 }
 
+bool MelFrequencyCepstralCoefficientsAnalysis::Run(
+    const Matrix& power_spectra, Matrix* mfcc, std::vector<double>* energies,
+    MelFrequencyCepstralCoefficientsAnalysis::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || NULL == mfcc || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int num_frame(power_spectra.GetNumRow());
+  if (mfcc->GetNumRow() != num_frame ||
+      mfcc->GetNumColumn() != num_order_ + 1) {
+    mfcc->Resize(num_frame, num_order_ + 1);
+  }
+
+  if (!mel_filter_bank_analysis_.Run(
+          power_spectra, &buffer->filter_bank_outputs_, energies)) {
+    return false;
+  }
+
+  if (!discrete_cosine_transform_.Run(
+          buffer->filter_bank_outputs_, &buffer->cepstra_,
+          &buffer->buffer_for_discrete_cosine_transform_)) {
+    return false;
+  }
+
+  for (int t(0); t < num_frame; ++t) {
+    const double* cepstrum(buffer->cepstra_[t]);
+    double* c((*mfcc)[t]);
+    c[0] = cepstrum[0] * std::sqrt(2.0);
+    for (int m(0); m < num_order_; ++m) {
+      c[m + 1] = cepstrum[m + 1] * cepstal_weights_[m];
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
@@ -17,6 +17,7 @@
 #include "SPTK/analysis/mel_generalized_cepstral_analysis.h"
 
 #include <algorithm>   // std::copy, std::fill, std::transform, etc.
+#include <cfloat>      // DBL_MAX
 #include <cmath>       // std::exp, std::fabs, std::pow, std::sqrt
 #include <cstddef>     // std::size_t
 #include <functional>  // std::plus
@@ -104,13 +105,14 @@ namespace sptk {
 
 MelGeneralizedCepstralAnalysis::MelGeneralizedCepstralAnalysis(
     int fft_length, int num_order, double alpha, double gamma,
-    int num_iteration, double convergence_threshold)
+    int num_iteration, double convergence_threshold, bool warm_start)
     : fft_length_(fft_length),
       num_order_(num_order),
       alpha_(alpha),
       gamma_(gamma),
       num_iteration_(num_iteration),
       convergence_threshold_(convergence_threshold),
+      warm_start_(warm_start),
       fourier_transform_(fft_length_),
       inverse_fourier_transform_(fft_length_),
       complex_valued_inverse_fourier_transform_(fft_length_),
@@ -141,8 +143,9 @@ MelGeneralizedCepstralAnalysis::MelGeneralizedCepstralAnalysis(
   }
 
   if (0.0 == gamma_) {
-    mel_cepstral_analysis_ = new MelCepstralAnalysis(
-        fft_length_, num_order_, alpha_, num_iteration_, convergence_threshold);
+    mel_cepstral_analysis_ =
+        new MelCepstralAnalysis(fft_length_, num_order_, alpha_, num_iteration_,
+                                convergence_threshold_, warm_start_);
   }
 }
 
@@ -150,9 +153,16 @@ bool MelGeneralizedCepstralAnalysis::Run(
     const std::vector<double>& periodogram,
     std::vector<double>* mel_generalized_cepstrum,
     MelGeneralizedCepstralAnalysis::Buffer* buffer) const {
+  return Run(periodogram, mel_generalized_cepstrum, NULL, buffer);
+}
+
+bool MelGeneralizedCepstralAnalysis::Run(
+    const std::vector<double>& periodogram,
+    std::vector<double>* mel_generalized_cepstrum, int* num_iteration,
+    MelGeneralizedCepstralAnalysis::Buffer* buffer) const {
   if (0.0 == gamma_) {
     return mel_cepstral_analysis_->Run(
-        periodogram, mel_generalized_cepstrum,
+        periodogram, mel_generalized_cepstrum, num_iteration,
         &buffer->buffer_for_mel_cepstral_analysis_);
   }
 
@@ -212,56 +222,78 @@ bool MelGeneralizedCepstralAnalysis::Run(
   std::reverse_copy(periodogram.begin() + 1, periodogram.end() - 1,
                     buffer->periodogram_.begin() + half_fft_length + 1);
 
-  // Make an initial guess.
-  double prev_epsilon;
-  std::fill(buffer->b_.begin(), buffer->b_.end(), 0.0);
-  if (!NewtonRaphsonMethod(-1.0, &prev_epsilon, buffer)) {
-    return false;
-  }
-  if (-1.0 != gamma_) {
-    // K, b'r -> br
-    if (!generalized_cepstrum_inverse_gain_normalization_gamma_minus_one_.Run(
-            &buffer->b_)) {
-      return false;
-    }
-    // br -> cr
-    if (!mlsa_digital_filter_coefficients_to_mel_cepstrum_.Run(buffer->b_,
-                                                               &buffer->c_)) {
-      return false;
-    }
-    // cr -> cr'
-    if (!mel_generalized_cepstrum_transform_.Run(
-            buffer->c_, &buffer->c_,
-            &buffer->buffer_for_mel_generalized_cepstrum_transform_)) {
-      return false;
-    }
-    // cr' -> br'
-    if (!mel_cepstrum_to_mlsa_digital_filter_coefficients_.Run(buffer->c_,
-                                                               &buffer->b_)) {
-      return false;
-    }
-    // br' -> K, b'r'
-    if (!generalized_cepstrum_gain_normalization_.Run(&buffer->b_)) {
-      return false;
+  int num_performed_iteration(0);
+  bool is_converged(false);
+  if (NULL != num_iteration) {
+    *num_iteration = 0;
+  }
+
+  // Start from the solution of the previous frame if available. If it does
+  // not converge, start over from the usual initial guess.
+  bool is_warm_started(false);
+  if (warm_start_ && -1.0 != gamma_ &&
+      buffer->previous_b_.size() == static_cast<std::size_t>(length)) {
+    std::copy(buffer->previous_b_.begin(), buffer->previous_b_.end(),
+              buffer->b_.begin());
+    is_warm_started =
+        (UpdateCoefficients(DBL_MAX, &num_performed_iteration, &is_converged,
+                            buffer) &&
+         is_converged);
+    if (NULL != num_iteration) {
+      *num_iteration = num_performed_iteration;
     }
   }
 
-  // Update coefficients using gradient method.
-  if (-1.0 != gamma_) {
-    for (int n(1); n <= num_iteration_; ++n) {
-      double epsilon;
-      if (!NewtonRaphsonMethod(gamma_, &epsilon, buffer)) {
+  if (!is_warm_started) {
+    // Make an initial guess.
+    double prev_epsilon;
+    std::fill(buffer->b_.begin(), buffer->b_.end(), 0.0);
+    if (!NewtonRaphsonMethod(-1.0, &prev_epsilon, buffer)) {
+      return false;
+    }
+    if (-1.0 != gamma_) {
+      // K, b'r -> br
+      if (!generalized_cepstrum_inverse_gain_normalization_gamma_minus_one_
+               .Run(&buffer->b_)) {
         return false;
       }
+      // br -> cr
+      if (!mlsa_digital_filter_coefficients_to_mel_cepstrum_.Run(
+              buffer->b_, &buffer->c_)) {
+        return false;
+      }
+      // cr -> cr'
+      if (!mel_generalized_cepstrum_transform_.Run(
+              buffer->c_, &buffer->c_,
+              &buffer->buffer_for_mel_generalized_cepstrum_transform_)) {
+        return false;
+      }
+      // cr' -> br'
+      if (!mel_cepstrum_to_mlsa_digital_filter_coefficients_.Run(
+              buffer->c_, &buffer->b_)) {
+        return false;
+      }
+      // br' -> K, b'r'
+      if (!generalized_cepstrum_gain_normalization_.Run(&buffer->b_)) {
+        return false;
+      }
+    }
 
-      // Check convergence.
-      const double relative_change((epsilon - prev_epsilon) / epsilon);
-      if (std::fabs(relative_change) < convergence_threshold_) {
-        break;
+    // Update coefficients using gradient method.
+    num_performed_iteration = 0;
+    if (-1.0 != gamma_) {
+      if (!UpdateCoefficients(prev_epsilon, &num_performed_iteration,
+                              &is_converged, buffer)) {
+        return false;
       }
-      prev_epsilon = epsilon;
+    }
+    if (NULL != num_iteration) {
+      *num_iteration += 1 + num_performed_iteration;
     }
   }
+  if (warm_start_) {
+    buffer->previous_b_ = buffer->b_;
+  }
 
   // K, b'r' -> br
   if (!generalized_cepstrum_inverse_gain_normalization_.Run(&buffer->b_)) {
@@ -276,6 +308,31 @@ bool MelGeneralizedCepstralAnalysis::Run(
   return true;
 }
 
+bool MelGeneralizedCepstralAnalysis::UpdateCoefficients(
+    double prev_epsilon, int* num_iteration, bool* is_converged,
+    MelGeneralizedCepstralAnalysis::Buffer* buffer) const {
+  *num_iteration = 0;
+  *is_converged = false;
+
+  for (int n(1); n <= num_iteration_; ++n) {
+    double epsilon;
+    if (!NewtonRaphsonMethod(gamma_, &epsilon, buffer)) {
+      return false;
+    }
+    *num_iteration = n;
+
+    // Check convergence.
+    const double relative_change((epsilon - prev_epsilon) / epsilon);
+    if (std::fabs(relative_change) < convergence_threshold_) {
+      *is_converged = true;
+      break;
+    }
+    prev_epsilon = epsilon;
+  }
+
+  return true;
+}
+
 bool MelGeneralizedCepstralAnalysis::NewtonRaphsonMethod(
     double gamma, double* epsilon,
     MelGeneralizedCepstralAnalysis::Buffer* buffer) const {
@@ -16,7 +16,9 @@
 
 #include "SPTK/filter/inverse_pseudo_quadrature_mirror_filter_banks.h"
 
-#include <cstddef>  // std::size_t
+#include <algorithm>  // std::copy, std::fill, std::max, std::min
+#include <cmath>      // std::cos, std::sin
+#include <cstddef>    // std::size_t
 
 #include "SPTK/utils/misc_utils.h"
 
@@ -31,6 +33,7 @@ InversePseudoQuadratureMirrorFilterBanks::
                                              double initial_step_size)
     : num_subband_(num_subband),
       all_zero_filter_(num_filter_order, false),
+      fast_fourier_transform_(2 * num_subband),
       is_valid_(true) {
   if (!all_zero_filter_.IsValid()) {
     is_valid_ = false;
@@ -40,10 +43,42 @@ InversePseudoQuadratureMirrorFilterBanks::
   if (!MakePseudoQuadratureMirrorFilterBanks(
           true, num_subband_, num_filter_order, attenuation, num_iteration,
           convergence_threshold, initial_step_size, &filter_banks_,
-          &is_converged_)) {
+          &is_converged_, &prototype_filter_)) {
     is_valid_ = false;
     return;
   }
+
+  // Prepare cosine modulation for decimated subband signals.
+  const int fft_length(2 * num_subband_);
+  if (fast_fourier_transform_.IsValid()) {
+    pre_twiddle_real_part_.resize(num_subband_);
+    pre_twiddle_imag_part_.resize(num_subband_);
+    for (int k(0), sign(-1); k < num_subband_; ++k, sign *= -1) {
+      const double a(sign * 0.25 * sptk::kPi -
+                     (2 * k + 1) * sptk::kPi / fft_length *
+                         (0.5 * num_filter_order));
+      pre_twiddle_real_part_[k] = 2.0 * std::cos(a);
+      pre_twiddle_imag_part_[k] = 2.0 * std::sin(a);
+    }
+    post_twiddle_real_part_.resize(fft_length);
+    post_twiddle_imag_part_.resize(fft_length);
+    for (int r(0); r < fft_length; ++r) {
+      const double a(sptk::kPi * r / fft_length);
+      post_twiddle_real_part_[r] = std::cos(a);
+      post_twiddle_imag_part_[r] = std::sin(a);
+    }
+  } else {
+    modulation_matrix_.resize(fft_length);
+    for (int r(0); r < fft_length; ++r) {
+      modulation_matrix_[r].resize(num_subband_);
+      for (int k(0), sign(-1); k < num_subband_; ++k, sign *= -1) {
+        const double a((2 * k + 1) * sptk::kPi / fft_length *
+                       (r - 0.5 * num_filter_order));
+        const double b(sign * 0.25 * sptk::kPi);
+        modulation_matrix_[r][k] = 2.0 * std::cos(a + b);
+      }
+    }
+  }
 }
 
 bool InversePseudoQuadratureMirrorFilterBanks::Run(
@@ -51,8 +86,9 @@ bool InversePseudoQuadratureMirrorFilterBanks::Run(
     InversePseudoQuadratureMirrorFilterBanks::Buffer* buffer) const {
   // Check inputs.
   if (!is_valid_ || input.size() != static_cast<std::size_t>(num_subband_) ||
-      output == nullptr || buffer == nullptr)
+      NULL == output || NULL == buffer) {
     return false;
+  }
 
   // Prepare memories.
   if (buffer->buffer_for_all_zero_filter_.size() !=
@@ -86,4 +122,88 @@ bool InversePseudoQuadratureMirrorFilterBanks::Run(
   return true;
 }
 
+bool InversePseudoQuadratureMirrorFilterBanks::Run(
+    const std::vector<double>& input, std::vector<double>* output,
+    InversePseudoQuadratureMirrorFilterBanks::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || input.size() != static_cast<std::size_t>(num_subband_) ||
+      NULL == output || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int filter_size(GetNumFilterOrder() + 1);
+  const int fft_length(2 * num_subband_);
+  const int signal_length(std::max(filter_size, num_subband_));
+  if (output->size() != static_cast<std::size_t>(num_subband_)) {
+    output->resize(num_subband_);
+  }
+  if (buffer->signal_.size() != static_cast<std::size_t>(signal_length)) {
+    buffer->signal_.resize(signal_length);
+    std::fill(buffer->signal_.begin(), buffer->signal_.end(), 0.0);
+  }
+  if (buffer->real_part_output_.size() !=
+      static_cast<std::size_t>(fft_length)) {
+    buffer->real_part_output_.resize(fft_length);
+    buffer->imag_part_output_.resize(fft_length);
+  }
+
+  // Perform cosine modulation. The result is stored in real_part_output_.
+  double* c(&(buffer->real_part_output_[0]));
+  const double* y(&(input[0]));
+  if (fast_fourier_transform_.IsValid()) {
+    if (buffer->real_part_input_.size() !=
+        static_cast<std::size_t>(fft_length)) {
+      buffer->real_part_input_.resize(fft_length);
+      buffer->imag_part_input_.resize(fft_length);
+      std::fill(buffer->real_part_input_.begin() + num_subband_,
+                buffer->real_part_input_.end(), 0.0);
+      std::fill(buffer->imag_part_input_.begin() + num_subband_,
+                buffer->imag_part_input_.end(), 0.0);
+    }
+    for (int k(0); k < num_subband_; ++k) {
+      buffer->real_part_input_[k] = y[k] * pre_twiddle_real_part_[k];
+      buffer->imag_part_input_[k] = y[k] * pre_twiddle_imag_part_[k];
+    }
+    // Swapping real and imaginary parts yields the inverse transform.
+    if (!fast_fourier_transform_.Run(
+            buffer->imag_part_input_, buffer->real_part_input_,
+            &buffer->imag_part_output_, &buffer->real_part_output_)) {
+      return false;
+    }
+    for (int r(0); r < fft_length; ++r) {
+      c[r] = (post_twiddle_real_part_[r] * buffer->real_part_output_[r] -
+              post_twiddle_imag_part_[r] * buffer->imag_part_output_[r]);
+    }
+  } else {
+    for (int r(0); r < fft_length; ++r) {
+      const double* d(&(modulation_matrix_[r][0]));
+      double sum(0.0);
+      for (int k(0); k < num_subband_; ++k) {
+        sum += d[k] * y[k];
+      }
+      c[r] = sum;
+    }
+  }
+
+  // Overlap-add the modulated prototype filter.
+  double* x(&(buffer->signal_[0]));
+  const double* h(&(prototype_filter_[0]));
+  for (int offset(0), sign(1); offset < filter_size;
+       offset += fft_length, sign *= -1) {
+    const int end(std::min(fft_length, filter_size - offset));
+    for (int r(0); r < end; ++r) {
+      x[offset + r] += sign * h[offset + r] * c[r];
+    }
+  }
+
+  std::copy(buffer->signal_.begin(), buffer->signal_.begin() + num_subband_,
+            output->begin());
+  std::copy(buffer->signal_.begin() + num_subband_, buffer->signal_.end(),
+            buffer->signal_.begin());
+  std::fill(buffer->signal_.end() - num_subband_, buffer->signal_.end(), 0.0);
+
+  return true;
+}
+
 }  // namespace sptk
@@ -16,8 +16,7 @@
 
 #include "SPTK/filter/median_filter.h"
 
-#include <algorithm>  // std::sort
-#include <cstddef>    // std::size_t
+#include <cstddef>  // std::size_t
 
 namespace sptk {
 
@@ -31,7 +30,9 @@ MedianFilter::MedianFilter(int num_input_order, int num_filter_order,
       apply_each_dimension_(apply_each_dimension),
       use_magic_number_(use_magic_number),
       magic_number_(magic_number),
-      is_valid_(true) {
+      is_valid_(true),
+      queue_head_(0),
+      queue_size_(0) {
   if (num_input_order_ < 0 || num_filter_order_ < 0 || NULL == input_source_ ||
       !input_source->IsValid() ||
       input_source->GetSize() != num_input_order_ + 1) {
@@ -40,10 +41,11 @@ MedianFilter::MedianFilter(int num_input_order, int num_filter_order,
   }
 
   // Prepare memories.
-  buffer_.resize(num_input_order_ + 1);
-  flat_.resize(apply_each_dimension_
-                   ? (num_filter_order_ + 1)
-                   : (num_filter_order_ + 1) * buffer_.size());
+  medians_.resize(GetSize());
+  queue_.resize(num_filter_order_ + 1);
+  for (std::vector<double>& frame : queue_) {
+    frame.resize(num_input_order_ + 1);
+  }
 
   // Look ahead.
   const int future(num_filter_order_ / 2);
@@ -71,44 +73,31 @@ bool MedianFilter::Get(std::vector<double>* output) {
   }
 
   for (int m(0); m < output_size; ++m) {
-    int num_magic_numbers(0);
-    int num_valid_numbers(0);
-    for (const std::vector<double>& input_vector : queue_) {
-      for (int n(apply_each_dimension_ ? m : 0);
-           n <= (apply_each_dimension_ ? m : num_input_order_); ++n) {
-        if (use_magic_number_ && magic_number_ == input_vector[n]) {
-          ++num_magic_numbers;
-        } else {
-          flat_[num_valid_numbers++] = input_vector[n];
-        }
-      }
-    }
-
-    if (num_valid_numbers < num_magic_numbers) {
+    const SlidingMedian& median(medians_[m]);
+    if (median.GetNumValidNumbers() < median.GetNumMagicNumbers()) {
       (*output)[m] = magic_number_;
-      continue;
-    }
-
-    std::sort(flat_.begin(), flat_.begin() + num_valid_numbers);
-    const int half_size(num_valid_numbers / 2);
-    if (IsEven(num_valid_numbers)) {
-      (*output)[m] = 0.5 * (flat_[half_size - 1] + flat_[half_size]);
     } else {
-      (*output)[m] = flat_[half_size];
+      (*output)[m] = median.GetMedian();
     }
   }
 
   if (count_down_ < num_filter_order_ / 2 ||
-      num_filter_order_ + 1 <= static_cast<int>(queue_.size())) {
-    queue_.pop_front();
+      num_filter_order_ + 1 <= queue_size_) {
+    Update(queue_[queue_head_], false);
+    queue_head_ = (queue_head_ + 1) % (num_filter_order_ + 1);
+    --queue_size_;
   }
 
   return true;
 }
 
 bool MedianFilter::Forward() {
-  if (input_source_->Get(&buffer_)) {
-    queue_.push_back(buffer_);
+  // The window never holds more than K frames here, so the tail slot is free.
+  std::vector<double>& tail(
+      queue_[(queue_head_ + queue_size_) % (num_filter_order_ + 1)]);
+  if (input_source_->Get(&tail)) {
+    Update(tail, true);
+    ++queue_size_;
   } else if (1 <= count_down_) {
     --count_down_;
   } else {
@@ -117,4 +106,71 @@ bool MedianFilter::Forward() {
   return true;
 }
 
+void MedianFilter::Update(const std::vector<double>& input_vector,
+                          bool is_insertion) {
+  const int output_size(GetSize());
+  for (int m(0); m < output_size; ++m) {
+    SlidingMedian& median(medians_[m]);
+    for (int n(apply_each_dimension_ ? m : 0);
+         n <= (apply_each_dimension_ ? m : num_input_order_); ++n) {
+      const double x(input_vector[n]);
+      if (use_magic_number_ && magic_number_ == x) {
+        if (is_insertion) {
+          median.InsertMagicNumber();
+        } else {
+          median.RemoveMagicNumber();
+        }
+      } else {
+        if (is_insertion) {
+          median.Insert(x);
+        } else {
+          median.Remove(x);
+        }
+      }
+    }
+  }
+}
+
+void MedianFilter::SlidingMedian::Insert(double x) {
+  if (lower_.empty() || x <= *lower_.rbegin()) {
+    lower_.insert(x);
+  } else {
+    upper_.insert(x);
+  }
+  Balance();
+}
+
+void MedianFilter::SlidingMedian::Remove(double x) {
+  if (!lower_.empty() && x <= *lower_.rbegin()) {
+    std::multiset<double>::iterator itr(lower_.find(x));
+    if (lower_.end() != itr) lower_.erase(itr);
+  } else {
+    std::multiset<double>::iterator itr(upper_.find(x));
+    if (upper_.end() != itr) upper_.erase(itr);
+  }
+  Balance();
+}
+
+double MedianFilter::SlidingMedian::GetMedian() const {
+  if (lower_.empty()) {
+    return 0.0;
+  }
+  if (lower_.size() == upper_.size()) {
+    return 0.5 * (*lower_.rbegin() + *upper_.begin());
+  }
+  return *lower_.rbegin();
+}
+
+void MedianFilter::SlidingMedian::Balance() {
+  if (upper_.size() + 1 < lower_.size()) {
+    std::multiset<double>::iterator itr(--lower_.end());
+    upper_.insert(*itr);
+    lower_.erase(itr);
+  } else if (lower_.size() < upper_.size()) {
+    std::multiset<double>::iterator itr(upper_.begin());
+    lower_.insert(*itr);
+    upper_.erase(itr);
+  }
+}
+
 }  // namespace sptk
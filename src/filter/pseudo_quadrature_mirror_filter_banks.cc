@@ -16,7 +16,9 @@
 
 #include "SPTK/filter/pseudo_quadrature_mirror_filter_banks.h"
 
-#include <cstddef>  // std::size_t
+#include <algorithm>  // std::copy_backward, std::fill, std::min
+#include <cmath>      // std::cos, std::sin
+#include <cstddef>    // std::size_t
 
 #include "SPTK/utils/misc_utils.h"
 
@@ -27,6 +29,7 @@ PseudoQuadratureMirrorFilterBanks::PseudoQuadratureMirrorFilterBanks(
     int num_iteration, double convergence_threshold, double initial_step_size)
     : num_subband_(num_subband),
       all_zero_filter_(num_filter_order, false),
+      fast_fourier_transform_(2 * num_subband),
       is_valid_(true) {
   if (!all_zero_filter_.IsValid()) {
     is_valid_ = false;
@@ -36,17 +39,51 @@ PseudoQuadratureMirrorFilterBanks::PseudoQuadratureMirrorFilterBanks(
   if (!MakePseudoQuadratureMirrorFilterBanks(
           false, num_subband_, num_filter_order, attenuation, num_iteration,
           convergence_threshold, initial_step_size, &filter_banks_,
-          &is_converged_)) {
+          &is_converged_, &prototype_filter_)) {
     is_valid_ = false;
     return;
   }
+
+  // Prepare cosine modulation for decimated subband signals.
+  const int fft_length(2 * num_subband_);
+  if (fast_fourier_transform_.IsValid()) {
+    pre_twiddle_real_part_.resize(fft_length);
+    pre_twiddle_imag_part_.resize(fft_length);
+    for (int r(0); r < fft_length; ++r) {
+      const double a(sptk::kPi * r / fft_length);
+      pre_twiddle_real_part_[r] = std::cos(a);
+      pre_twiddle_imag_part_[r] = std::sin(a);
+    }
+    post_twiddle_real_part_.resize(num_subband_);
+    post_twiddle_imag_part_.resize(num_subband_);
+    for (int k(0), sign(1); k < num_subband_; ++k, sign *= -1) {
+      const double a(sign * 0.25 * sptk::kPi -
+                     (2 * k + 1) * sptk::kPi / fft_length *
+                         (0.5 * num_filter_order));
+      post_twiddle_real_part_[k] = 2.0 * std::cos(a);
+      post_twiddle_imag_part_[k] = 2.0 * std::sin(a);
+    }
+  } else {
+    modulation_matrix_.resize(num_subband_);
+    for (int k(0), sign(1); k < num_subband_; ++k, sign *= -1) {
+      modulation_matrix_[k].resize(fft_length);
+      for (int r(0); r < fft_length; ++r) {
+        const double a((2 * k + 1) * sptk::kPi / fft_length *
+                       (r - 0.5 * num_filter_order));
+        const double b(sign * 0.25 * sptk::kPi);
+        modulation_matrix_[k][r] = 2.0 * std::cos(a + b);
+      }
+    }
+  }
 }
 
 bool PseudoQuadratureMirrorFilterBanks::Run(
     double input, std::vector<double>* output,
     PseudoQuadratureMirrorFilterBanks::Buffer* buffer) const {
   // Check inputs.
-  if (!is_valid_ || output == nullptr || buffer == nullptr) return false;
+  if (!is_valid_ || NULL == output || NULL == buffer) {
+    return false;
+  }
 
   // Prepare memories.
   if (output->size() != static_cast<std::size_t>(num_subband_)) {
@@ -79,4 +116,90 @@ bool PseudoQuadratureMirrorFilterBanks::Run(
   return true;
 }
 
+bool PseudoQuadratureMirrorFilterBanks::Run(
+    const std::vector<double>& input, std::vector<double>* output,
+    PseudoQuadratureMirrorFilterBanks::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || input.size() != static_cast<std::size_t>(num_subband_) ||
+      NULL == output || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int filter_size(GetNumFilterOrder() + 1);
+  const int fft_length(2 * num_subband_);
+  if (output->size() != static_cast<std::size_t>(num_subband_)) {
+    output->resize(num_subband_);
+  }
+  if (buffer->signal_.size() != static_cast<std::size_t>(filter_size)) {
+    buffer->signal_.resize(filter_size);
+    std::fill(buffer->signal_.begin(), buffer->signal_.end(), 0.0);
+  }
+  if (buffer->folded_signal_.size() != static_cast<std::size_t>(fft_length)) {
+    buffer->folded_signal_.resize(fft_length);
+  }
+
+  // Store input samples in reverse order, i.e., signal[n] = x(t-n).
+  double* x(&(buffer->signal_[0]));
+  if (num_subband_ < filter_size) {
+    std::copy_backward(buffer->signal_.begin(),
+                       buffer->signal_.end() - num_subband_,
+                       buffer->signal_.end());
+    for (int i(0); i < num_subband_; ++i) {
+      x[num_subband_ - 1 - i] = input[i];
+    }
+  } else {
+    for (int n(0); n < filter_size; ++n) {
+      x[n] = input[num_subband_ - 1 - n];
+    }
+  }
+
+  // Fold windowed signal using the anti-periodicity of cosine modulation.
+  double* z(&(buffer->folded_signal_[0]));
+  const double* h(&(prototype_filter_[0]));
+  std::fill(buffer->folded_signal_.begin(), buffer->folded_signal_.end(), 0.0);
+  for (int offset(0), sign(1); offset < filter_size;
+       offset += fft_length, sign *= -1) {
+    const int end(std::min(fft_length, filter_size - offset));
+    for (int r(0); r < end; ++r) {
+      z[r] += sign * h[offset + r] * x[offset + r];
+    }
+  }
+
+  // Perform cosine modulation.
+  double* y(&((*output)[0]));
+  if (fast_fourier_transform_.IsValid()) {
+    if (buffer->real_part_input_.size() !=
+        static_cast<std::size_t>(fft_length)) {
+      buffer->real_part_input_.resize(fft_length);
+      buffer->imag_part_input_.resize(fft_length);
+    }
+    for (int r(0); r < fft_length; ++r) {
+      buffer->real_part_input_[r] = z[r] * pre_twiddle_real_part_[r];
+      buffer->imag_part_input_[r] = z[r] * pre_twiddle_imag_part_[r];
+    }
+    // Swapping real and imaginary parts yields the inverse transform.
+    if (!fast_fourier_transform_.Run(
+            buffer->imag_part_input_, buffer->real_part_input_,
+            &buffer->imag_part_output_, &buffer->real_part_output_)) {
+      return false;
+    }
+    for (int k(0); k < num_subband_; ++k) {
+      y[k] = (post_twiddle_real_part_[k] * buffer->real_part_output_[k] -
+              post_twiddle_imag_part_[k] * buffer->imag_part_output_[k]);
+    }
+  } else {
+    for (int k(0); k < num_subband_; ++k) {
+      const double* c(&(modulation_matrix_[k][0]));
+      double sum(0.0);
+      for (int r(0); r < fft_length; ++r) {
+        sum += c[r] * z[r];
+      }
+      y[k] = sum;
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
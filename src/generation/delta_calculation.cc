@@ -16,7 +16,7 @@
 
 #include "SPTK/generation/delta_calculation.h"
 
-#include <algorithm>  // std::copy, std::fill
+#include <algorithm>  // std::copy, std::fill, std::max, std::min
 #include <cstddef>    // std::size_t
 
 namespace sptk {
@@ -32,8 +32,9 @@ DeltaCalculation::DeltaCalculation(
       use_magic_number_(use_magic_number),
       magic_number_(magic_number),
       is_valid_(true) {
-  if (num_order_ < 0 || num_delta_ <= 0 || NULL == input_source_ ||
-      !input_source->IsValid() || input_source->GetSize() != num_order_ + 1) {
+  if (num_order_ < 0 || num_delta_ <= 0 ||
+      (NULL != input_source_ && (!input_source_->IsValid() ||
+                                 input_source_->GetSize() != num_order_ + 1))) {
     is_valid_ = false;
     return;
   }
@@ -59,10 +60,15 @@ DeltaCalculation::DeltaCalculation(
     }
   }
 
+  if (NULL == input_source_) {
+    return;
+  }
+
   buffer_.statics.resize(max_window_width_);
   for (int j(0); j < max_window_width_; ++j) {
     buffer_.statics[j].resize(num_order_ + 1);
   }
+  buffer_.pointers.resize(max_window_width_);
   buffer_.pointer = 0;
   buffer_.first = true;
 
@@ -76,8 +82,8 @@ DeltaCalculation::DeltaCalculation(
   }
 }
 
-bool DeltaCalculation::Get(std::vector<double>* dynamics) {
-  if (!is_valid_ || NULL == dynamics) {
+bool DeltaCalculation::Get(std::vector<double>* delta) {
+  if (!is_valid_ || NULL == input_source_ || NULL == delta) {
     return false;
   }
 
@@ -86,33 +92,51 @@ bool DeltaCalculation::Get(std::vector<double>* dynamics) {
   }
 
   // Prepare memories.
-  const int input_length(num_order_ + 1);
   const int output_length(GetSize());
-  if (dynamics->size() != static_cast<std::size_t>(output_length)) {
-    dynamics->resize(output_length);
+  if (delta->size() != static_cast<std::size_t>(output_length)) {
+    delta->resize(output_length);
   }
 
-  std::fill(dynamics->begin(), dynamics->end(), 0.0);
+  // Arrange static components in the ring buffer in time order.
+  const int left_window_width(max_window_width_ / 2);
+  for (int j(0); j < max_window_width_; ++j) {
+    // The below line means GetPointerIndex(j - left - delay - 1).
+    const int k(GetPointerIndex(j - left_window_width -
+                                (max_window_width_ + 1) / 2));
+    buffer_.pointers[j] = &(buffer_.statics[k][0]);
+  }
 
-  // Calculate delta components.
-  double* output(&((*dynamics)[0]));
-  for (int d(0); d < num_delta_; ++d) {
-    for (int j(lefts_[d]), i(0); j <= rights_[d]; ++j, ++i) {
-      // The below line means GetPointerIndex(j - delay - 1).
-      const int k(GetPointerIndex(j - (max_window_width_ + 1) / 2));
-      for (int m(0); m <= num_order_; ++m) {
-        const int l(m + input_length * d);
-        if (use_magic_number_) {
-          if (magic_number_ == buffer_.statics[k][m]) {
-            output[l] = magic_number_;
-          } else if (magic_number_ != output[l]) {
-            output[l] += window_coefficients_[d][i] * buffer_.statics[k][m];
-          }
-        } else {
-          output[l] += window_coefficients_[d][i] * buffer_.statics[k][m];
-        }
-      }
+  CalculateDelta(&(buffer_.pointers[0]), &((*delta)[0]));
+
+  return true;
+}
+
+bool DeltaCalculation::Run(const Matrix& statics, Matrix* delta) const {
+  const int num_frame(statics.GetNumRow());
+  if (!is_valid_ || statics.GetNumColumn() != num_order_ + 1 ||
+      NULL == delta) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int output_length(GetSize());
+  if (delta->GetNumRow() != num_frame ||
+      delta->GetNumColumn() != output_length) {
+    delta->Resize(num_frame, output_length);
+  }
+  if (0 == num_frame) {
+    return true;
+  }
+
+  std::vector<const double*> pointers(max_window_width_);
+  const int left_window_width(max_window_width_ / 2);
+  for (int t(0); t < num_frame; ++t) {
+    for (int j(0); j < max_window_width_; ++j) {
+      const int s(std::min(std::max(t + j - left_window_width, 0),
+                           num_frame - 1));
+      pointers[j] = statics[s];
     }
+    CalculateDelta(&(pointers[0]), (*delta)[t]);
   }
 
   return true;
@@ -158,4 +182,33 @@ int DeltaCalculation::GetPointerIndex(int move) {
   return index;
 }
 
+void DeltaCalculation::CalculateDelta(const double* const* statics,
+                                      double* delta) const {
+  const int input_length(num_order_ + 1);
+  std::fill(delta, delta + GetSize(), 0.0);
+
+  // Accumulate weighted static components over all dimensions at once.
+  const int left_window_width(max_window_width_ / 2);
+  for (int d(0); d < num_delta_; ++d) {
+    double* y(delta + input_length * d);
+    for (int j(lefts_[d]), i(0); j <= rights_[d]; ++j, ++i) {
+      const double w(window_coefficients_[d][i]);
+      const double* x(statics[left_window_width + j]);
+      if (use_magic_number_) {
+        for (int m(0); m < input_length; ++m) {
+          if (magic_number_ == x[m]) {
+            y[m] = magic_number_;
+          } else if (magic_number_ != y[m]) {
+            y[m] += w * x[m];
+          }
+        }
+      } else {
+        for (int m(0); m < input_length; ++m) {
+          y[m] += w * x[m];
+        }
+      }
+    }
+  }
+}
+
 }  // namespace sptk
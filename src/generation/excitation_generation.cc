@@ -16,8 +16,9 @@
 
 #include "SPTK/generation/excitation_generation.h"
 
-#include <cmath>   // std::sqrt
-#include <vector>  // std::vector
+#include <cmath>    // std::sqrt
+#include <cstddef>  // std::size_t
+#include <vector>   // std::vector
 
 namespace sptk {
 
@@ -27,6 +28,7 @@ ExcitationGeneration::ExcitationGeneration(
     : input_source_(input_source),
       random_generation_(random_generation),
       is_valid_(true),
+      is_end_(false),
       phase_(1.0) {
   if (NULL == input_source_ || NULL == random_generation_ ||
       !input_source_->IsValid()) {
@@ -37,7 +39,7 @@ ExcitationGeneration::ExcitationGeneration(
 
 bool ExcitationGeneration::Get(double* excitation, double* pulse, double* noise,
                                double* pitch) {
-  if (!is_valid_) {
+  if (!is_valid_ || is_end_) {
     return false;
   }
 
@@ -46,6 +48,7 @@ bool ExcitationGeneration::Get(double* excitation, double* pulse, double* noise,
   {
     std::vector<double> tmp;
     if (!input_source_->Get(&tmp) || tmp[0] < 0.0) {
+      is_end_ = true;
       return false;
     }
     pitch_in_current_point = tmp[0];
@@ -98,4 +101,73 @@ bool ExcitationGeneration::Get(double* excitation, double* pulse, double* noise,
   return true;
 }
 
+bool ExcitationGeneration::Get(int num_sample,
+                               std::vector<double>* excitation,
+                               std::vector<double>* pulse,
+                               std::vector<double>* noise,
+                               std::vector<double>* pitch) {
+  if (!is_valid_ || is_end_ || num_sample <= 0) {
+    return false;
+  }
+
+  std::vector<double>& pitches(pitch ? *pitch : pitch_);
+  std::vector<double>& noises(noise ? *noise : noise_);
+  std::vector<double>& pulses(pulse ? *pulse : pulse_);
+
+  // Get pitch contour.
+  if (pitches.size() != static_cast<std::size_t>(num_sample)) {
+    pitches.resize(num_sample);
+  }
+  int num_valid_sample(0);
+  for (; num_valid_sample < num_sample; ++num_valid_sample) {
+    if (!input_source_->Get(&point_) || point_[0] < 0.0) {
+      is_end_ = true;
+      break;
+    }
+    pitches[num_valid_sample] = point_[0];
+  }
+  if (0 == num_valid_sample) {
+    return false;
+  }
+  pitches.resize(num_valid_sample);
+
+  // Get noise. It is drawn for all samples including voiced ones so that the
+  // random sequence is identical to that of the sample-by-sample generation.
+  noises.resize(num_valid_sample);
+  if (!random_generation_->Get(&noises)) {
+    return false;
+  }
+
+  // Place pulses. The phase of unvoiced points is reset to emit a pulse at the
+  // beginning of the next voiced segment.
+  pulses.resize(num_valid_sample);
+  const double magic_number(input_source_->GetMagicNumber());
+  double phase(phase_);
+  for (int t(0); t < num_valid_sample; ++t) {
+    const double f0(pitches[t]);
+    if (magic_number == f0) {
+      phase = 1.0;
+      pulses[t] = 0.0;
+      continue;
+    }
+    if (1.0 <= phase) {
+      phase -= 1.0;
+      pulses[t] = std::sqrt(f0);
+    } else {
+      pulses[t] = 0.0;
+    }
+    phase += 1.0 / f0;
+  }
+  phase_ = phase;
+
+  if (excitation) {
+    excitation->resize(num_valid_sample);
+    for (int t(0); t < num_valid_sample; ++t) {
+      (*excitation)[t] = (magic_number == pitches[t]) ? noises[t] : pulses[t];
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
@@ -16,6 +16,8 @@
 
 #include "SPTK/generation/m_sequence_generation.h"
 
+#include <cstdint>  // std::uint32_t
+
 namespace {
 
 const int kInitialValue(0x55555555);
@@ -68,4 +70,38 @@ bool MSequenceGeneration::Get(double* output) {
   return true;
 }
 
+bool MSequenceGeneration::Get(std::vector<double>* outputs) {
+  if (NULL == outputs) {
+    return false;
+  }
+
+  const int num_output(static_cast<int>(outputs->size()));
+  if (0 == num_output) {
+    return true;
+  }
+
+  // The k-th bit of the state is the output of the k-th step from now, and the
+  // feedback bit at step k is given by XOR of the k-th and the (k+28)-th bits.
+  // Since the feedback of step k+3 depends on that of step k, three steps are
+  // processed at once without branches.
+  double* y(&((*outputs)[0]));
+  std::uint32_t x(static_cast<std::uint32_t>(x_));
+  int i(0);
+  for (; i + 3 <= num_output; i += 3) {
+    y[i] = static_cast<double>(static_cast<int>(x & 0x2) - 1);
+    y[i + 1] = static_cast<double>(static_cast<int>((x >> 1) & 0x2) - 1);
+    y[i + 2] = static_cast<double>(static_cast<int>((x >> 2) & 0x2) - 1);
+    const std::uint32_t feedback(((x >> 1) ^ (x >> 29)) & 0x7);
+    x = (x >> 3) | (feedback << 29);
+  }
+  for (; i < num_output; ++i) {
+    y[i] = static_cast<double>(static_cast<int>(x & 0x2) - 1);
+    const std::uint32_t feedback(((x >> 1) ^ (x >> 29)) & 0x1);
+    x = (x >> 1) | (feedback << 31);
+  }
+  x_ = static_cast<int>(x);
+
+  return true;
+}
+
 }  // namespace sptk
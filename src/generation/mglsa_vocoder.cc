@@ -0,0 +1,75 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/generation/mglsa_vocoder.h"
+
+namespace {
+
+const double kMagicNumberForUnvoicedFrame(0.0);
+
+}  // namespace
+
+namespace sptk {
+
+MglsaVocoder::MglsaVocoder(
+    int num_filter_order, double alpha, int num_stage, int num_pade_order,
+    bool transposition, bool gain_flag, int frame_period,
+    int interpolation_period, InputSourceInterface* pitch_source,
+    InputSourceInterface* mel_generalized_cepstrum_source,
+    RandomGenerationInterface* random_generation,
+    const MelCepstrumPostfilter* postfilter)
+    : pitch_interpolation_(frame_period, interpolation_period, false,
+                           kMagicNumberForUnvoicedFrame, pitch_source),
+      excitation_generation_(&pitch_interpolation_, random_generation),
+      preprocessing_(alpha, (0 == num_stage) ? 0.0 : -1.0 / num_stage,
+                     gain_flag, mel_generalized_cepstrum_source, postfilter),
+      filter_coefficients_interpolation_(frame_period, interpolation_period,
+                                         true, &preprocessing_),
+      filter_(num_filter_order, num_pade_order, num_stage, alpha,
+              transposition),
+      is_valid_(true) {
+  if (NULL == pitch_source || NULL == mel_generalized_cepstrum_source ||
+      1 != pitch_source->GetSize() ||
+      num_filter_order + 1 != mel_generalized_cepstrum_source->GetSize() ||
+      !excitation_generation_.IsValid() ||
+      !filter_coefficients_interpolation_.IsValid() || !filter_.IsValid()) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+bool MglsaVocoder::Get(int num_sample, std::vector<double>* waveform) {
+  if (!is_valid_ || NULL == waveform) {
+    return false;
+  }
+
+  if (!excitation_generation_.Get(num_sample, waveform, NULL, NULL, NULL)) {
+    return false;
+  }
+
+  const int length(static_cast<int>(waveform->size()));
+  for (int t(0); t < length; ++t) {
+    if (!filter_coefficients_interpolation_.Get(&filter_coefficients_) ||
+        !filter_.Run(filter_coefficients_, &((*waveform)[t]),
+                     &buffer_for_filter_)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace sptk
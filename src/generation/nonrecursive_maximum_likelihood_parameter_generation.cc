@@ -166,10 +166,10 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
   }
 
   // Set mseq and vseq.
+  SymmetricMatrix precision(length);
   for (int absolute_t(0), t(0); absolute_t < sequence_length; ++absolute_t) {
     if (!is_continuous[absolute_t]) continue;
 
-    SymmetricMatrix precision;
     if (!covariance_matrices[absolute_t].Invert(&precision)) {
       return false;
     }
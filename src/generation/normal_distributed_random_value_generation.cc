@@ -32,6 +32,18 @@ double PseudoRandomGeneration(std::uint64_t* next) {
   return r / 32767.0;
 }
 
+// Generate a pair of uniform random numbers in the unit circle by the polar
+// method and return the scale to make them normally distributed.
+double GeneratePair(std::uint64_t* next, double* r1, double* r2) {
+  double s;
+  do {
+    *r1 = 2.0 * PseudoRandomGeneration(next) - 1.0;
+    *r2 = 2.0 * PseudoRandomGeneration(next) - 1.0;
+    s = (*r1) * (*r1) + (*r2) * (*r2);
+  } while (0.0 == s || 1.0 <= s);
+  return std::sqrt(-2.0 * std::log(s) / s);
+}
+
 }  // namespace
 
 namespace sptk {
@@ -54,12 +66,7 @@ bool NormalDistributedRandomValueGeneration::Get(double* output) {
 
   if (switch_) {
     switch_ = false;
-    do {
-      r1_ = 2.0 * PseudoRandomGeneration(&(next_)) - 1.0;
-      r2_ = 2.0 * PseudoRandomGeneration(&(next_)) - 1.0;
-      s_ = r1_ * r1_ + r2_ * r2_;
-    } while (0.0 == s_ || 1.0 <= s_);
-    s_ = std::sqrt(-2.0 * std::log(s_) / s_);
+    s_ = GeneratePair(&(next_), &(r1_), &(r2_));
     *output = r1_ * s_;
   } else {
     switch_ = true;
@@ -69,4 +76,43 @@ bool NormalDistributedRandomValueGeneration::Get(double* output) {
   return true;
 }
 
+bool NormalDistributedRandomValueGeneration::Get(
+    std::vector<double>* outputs) {
+  if (NULL == outputs) {
+    return false;
+  }
+
+  const int num_output(static_cast<int>(outputs->size()));
+  if (0 == num_output) {
+    return true;
+  }
+
+  double* y(&((*outputs)[0]));
+  int i(0);
+
+  // Output the remaining value of the last pair.
+  if (!switch_) {
+    switch_ = true;
+    y[i++] = r2_ * s_;
+  }
+
+  // Generate values in pairs while keeping the state in local variables.
+  std::uint64_t next(next_);
+  for (; i + 1 < num_output; i += 2) {
+    double r1, r2;
+    const double s(GeneratePair(&next, &r1, &r2));
+    y[i] = r1 * s;
+    y[i + 1] = r2 * s;
+  }
+  next_ = next;
+
+  if (i < num_output) {
+    switch_ = false;
+    s_ = GeneratePair(&(next_), &(r1_), &(r2_));
+    y[i] = r1_ * s_;
+  }
+
+  return true;
+}
+
 }  // namespace sptk
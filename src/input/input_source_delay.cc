@@ -26,7 +26,9 @@ InputSourceDelay::InputSourceDelay(int delay, bool keep_sequence_length,
     : delay_(delay),
       keep_sequence_length_(keep_sequence_length),
       source_(source),
-      is_valid_(true) {
+      is_valid_(true),
+      queue_head_(0),
+      queue_size_(0) {
   if (NULL == source_ || !source_->IsValid()) {
     is_valid_ = false;
     return;
@@ -42,11 +44,12 @@ InputSourceDelay::InputSourceDelay(int delay, bool keep_sequence_length,
     }
   } else {
     // Store data.
+    queue_.resize(delay_);
     for (num_zeros_ = 0; num_zeros_ < delay_; ++num_zeros_) {
-      if (!source_->Get(&data)) {
+      if (!source_->Get(&queue_[num_zeros_])) {
         break;
       }
-      queue_.push(data);
+      ++queue_size_;
     }
     if (!keep_sequence_length_) {
       num_zeros_ = delay_;
@@ -75,13 +78,20 @@ bool InputSourceDelay::Get(std::vector<double>* buffer) {
       std::fill(buffer->begin(), buffer->end(), 0.0);
       return true;
     } else if (source_->Get(buffer)) {
-      queue_.push(*buffer);
-      *buffer = queue_.front();
-      queue_.pop();
+      if (queue_size_ < delay_) {
+        // Store the newest data and output the oldest one.
+        queue_[(queue_head_ + queue_size_) % delay_] = *buffer;
+        buffer->swap(queue_[queue_head_]);
+      } else {
+        // Exchange the newest data with the oldest one.
+        buffer->swap(queue_[queue_head_]);
+      }
+      queue_head_ = (queue_head_ + 1) % delay_;
       return true;
-    } else if (!keep_sequence_length_ && !queue_.empty()) {
-      *buffer = queue_.front();
-      queue_.pop();
+    } else if (!keep_sequence_length_ && 0 < queue_size_) {
+      buffer->swap(queue_[queue_head_]);
+      queue_head_ = (queue_head_ + 1) % delay_;
+      --queue_size_;
       return true;
     }
   }
@@ -16,7 +16,7 @@
 
 #include "SPTK/input/input_source_filling_magic_number.h"
 
-#include <algorithm>  // std::find_if
+#include <algorithm>  // std::copy, std::find_if
 #include <cstddef>    // std::size_t
 #include <stdexcept>  // std::runtime_error
 
@@ -82,8 +82,11 @@ bool InputSourceFillingMagicNumber::Get(std::vector<double>* buffer) {
     }
   }
 
-  *buffer = queue_.front();
-  final_output_ = queue_.front();
+  // Return the memory of the output buffer to the pool for reuse.
+  buffer->swap(queue_.front());
+  std::copy(buffer->begin(), buffer->end(), final_output_.begin());
+  pool_.push_back(std::vector<double>());
+  pool_.back().swap(queue_.front());
   queue_.pop_front();
 
   return true;
@@ -103,7 +106,13 @@ int InputSourceFillingMagicNumber::Proceed() {
 
   // Load new data.
   std::vector<double> curr_data;
+  if (!pool_.empty()) {
+    curr_data.swap(pool_.back());
+    pool_.pop_back();
+  }
   if (!source_->Get(&curr_data)) {
+    pool_.push_back(std::vector<double>());
+    pool_.back().swap(curr_data);
     if (queue_.empty()) {
       return kExit;
     }
@@ -147,7 +156,8 @@ int InputSourceFillingMagicNumber::Proceed() {
       magic_number_region_[i] = 0;
     }
   }
-  queue_.push_back(curr_data);
+  queue_.push_back(std::vector<double>());
+  queue_.back().swap(curr_data);
 
   return kWait;
 }
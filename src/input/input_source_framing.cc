@@ -0,0 +1,81 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/input/input_source_framing.h"
+
+#include <cstddef>  // std::size_t
+
+namespace sptk {
+
+InputSourceFraming::InputSourceFraming(int frame_length, int frame_period,
+                                       bool center,
+                                       InputSourceInterface* source)
+    : frame_length_(frame_length),
+      frame_period_(frame_period),
+      offset_(center ? frame_length / 2 : 0),
+      source_(source),
+      is_valid_(true),
+      num_read_samples_(0),
+      next_frame_position_(0),
+      is_eof_(false) {
+  if (frame_length_ <= 0 || frame_period_ <= 0 || NULL == source_ ||
+      !source_->IsValid() || source_->GetSize() <= 0) {
+    is_valid_ = false;
+    return;
+  }
+  // The ring has room for the samples read beyond the end of a frame.
+  ring_.resize(frame_length_ + source_->GetSize() - 1);
+}
+
+bool InputSourceFraming::Get(std::vector<double>* buffer) {
+  if (NULL == buffer || !is_valid_) {
+    return false;
+  }
+
+  // Read samples until the end of the frame. Old samples are overwritten.
+  const int ring_size(static_cast<int>(ring_.size()));
+  const int begin(next_frame_position_ - offset_);
+  const int end(begin + frame_length_);
+  while (num_read_samples_ < end && !is_eof_) {
+    if (!source_->Get(&samples_)) {
+      is_eof_ = true;
+      break;
+    }
+    for (std::vector<double>::const_iterator itr(samples_.begin());
+         itr != samples_.end(); ++itr) {
+      ring_[num_read_samples_ % ring_size] = *itr;
+      ++num_read_samples_;
+    }
+  }
+
+  if (num_read_samples_ <= next_frame_position_) {
+    return false;
+  }
+
+  if (buffer->size() != static_cast<std::size_t>(frame_length_)) {
+    buffer->resize(frame_length_);
+  }
+  for (int i(begin), j(0); i < end; ++i, ++j) {
+    (*buffer)[j] =
+        (0 <= i && i < num_read_samples_) ? ring_[i % ring_size] : 0.0;
+  }
+
+  next_frame_position_ += frame_period_;
+
+  return true;
+}
+
+}  // namespace sptk
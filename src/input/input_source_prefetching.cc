@@ -0,0 +1,113 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/input/input_source_prefetching.h"
+
+namespace sptk {
+
+InputSourcePrefetching::InputSourcePrefetching(int queue_length,
+                                               InputSourceInterface* source)
+    : queue_length_(queue_length),
+      source_(source),
+      is_valid_(true),
+      queue_head_(0),
+      queue_size_(0),
+      is_end_(false),
+      is_failed_(false),
+      is_stopped_(false) {
+  if (queue_length_ <= 0 || NULL == source_ || !source_->IsValid()) {
+    is_valid_ = false;
+    return;
+  }
+  queue_.resize(queue_length_);
+}
+
+InputSourcePrefetching::~InputSourcePrefetching() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_ = true;
+  }
+  not_full_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void InputSourcePrefetching::Prefetch() {
+  for (;;) {
+    // The tail of the queue is not touched by the reader until it is filled.
+    int tail;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (queue_length_ == queue_size_ && !is_stopped_) {
+        not_full_.wait(lock);
+      }
+      if (is_stopped_) {
+        return;
+      }
+      tail = (queue_head_ + queue_size_) % queue_length_;
+    }
+
+    const bool is_read(source_->Get(&queue_[tail]));
+    const bool is_failed(!is_read && source_->IsFailed());
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (is_read) {
+        ++queue_size_;
+      } else {
+        is_end_ = true;
+        is_failed_ = is_failed;
+      }
+    }
+    not_empty_.notify_one();
+    if (!is_read) {
+      return;
+    }
+  }
+}
+
+bool InputSourcePrefetching::Get(std::vector<double>* buffer) {
+  if (NULL == buffer || !is_valid_) {
+    return false;
+  }
+
+  if (!thread_.joinable()) {
+    thread_ = std::thread(&InputSourcePrefetching::Prefetch, this);
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (0 == queue_size_ && !is_end_) {
+      not_empty_.wait(lock);
+    }
+    if (0 == queue_size_) {
+      return false;
+    }
+    buffer->swap(queue_[queue_head_]);
+    queue_head_ = (queue_head_ + 1) % queue_length_;
+    --queue_size_;
+  }
+  not_full_.notify_one();
+
+  return true;
+}
+
+bool InputSourcePrefetching::IsFailed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return is_failed_;
+}
+
+}  // namespace sptk
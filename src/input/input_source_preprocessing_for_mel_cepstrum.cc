@@ -0,0 +1,94 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/input/input_source_preprocessing_for_mel_cepstrum.h"
+
+#include <algorithm>  // std::transform
+#include <cmath>      // std::log
+
+namespace sptk {
+
+InputSourcePreprocessingForMelCepstrum::InputSourcePreprocessingForMelCepstrum(
+    double alpha, double gamma, bool gain_flag, InputSourceInterface* source,
+    const MelCepstrumPostfilter* postfilter)
+    : gamma_(gamma),
+      gain_flag_(gain_flag),
+      source_(source),
+      postfilter_(postfilter),
+      mel_cepstrum_to_mlsa_digital_filter_coefficients_(
+          source ? source->GetSize() - 1 : 0, alpha),
+      generalized_cepstrum_gain_normalization_(
+          source ? source->GetSize() - 1 : 0, gamma),
+      is_valid_(true) {
+  if (NULL == source_ || !source_->IsValid() ||
+      !mel_cepstrum_to_mlsa_digital_filter_coefficients_.IsValid() ||
+      !generalized_cepstrum_gain_normalization_.IsValid()) {
+    is_valid_ = false;
+    return;
+  }
+
+  if (NULL != postfilter_ &&
+      (0.0 != gamma_ || !postfilter_->IsValid() ||
+       postfilter_->GetNumOrder() != source_->GetSize() - 1 ||
+       postfilter_->GetAlpha() != alpha)) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+bool InputSourcePreprocessingForMelCepstrum::Get(
+    std::vector<double>* mlsa_digital_filter_coefficients) {
+  if (NULL == mlsa_digital_filter_coefficients || !is_valid_) {
+    return false;
+  }
+
+  if (!source_->Get(&mel_cepstrum_)) {
+    return false;
+  }
+
+  if (NULL != postfilter_ &&
+      !postfilter_->Run(&mel_cepstrum_, &buffer_for_postfilter_)) {
+    return false;
+  }
+
+  if (!mel_cepstrum_to_mlsa_digital_filter_coefficients_.Run(
+          mel_cepstrum_, mlsa_digital_filter_coefficients)) {
+    return false;
+  }
+
+  if (0.0 != gamma_) {
+    if (!generalized_cepstrum_gain_normalization_.Run(
+            mlsa_digital_filter_coefficients)) {
+      return false;
+    }
+    if (gain_flag_) {
+      (*mlsa_digital_filter_coefficients)[0] =
+          std::log((*mlsa_digital_filter_coefficients)[0]);
+    }
+    std::transform(mlsa_digital_filter_coefficients->begin() + 1,
+                   mlsa_digital_filter_coefficients->end(),
+                   mlsa_digital_filter_coefficients->begin() + 1,
+                   [this](double b) { return b * gamma_; });
+  }
+
+  if (!gain_flag_) {
+    (*mlsa_digital_filter_coefficients)[0] = 0.0;  // exp(0) = 1
+  }
+
+  return true;
+}
+
+}  // namespace sptk
@@ -14,15 +14,16 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <fstream>   // std::ifstream
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
+#include <algorithm>  // std::copy
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/generation/delta_calculation.h"
-#include "SPTK/input/input_source_from_stream.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/misc_utils.h"
 #include "SPTK/utils/sptk_utils.h"
 
@@ -34,6 +35,9 @@ enum LongOptions {
 
 const int kDefaultNumOrder(24);
 
+// Number of frames processed at once.
+const int kNumFrameInBlock(256);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -106,6 +110,11 @@ void PrintUsage(std::ostream* stream) {
  *   delta -l 15 -D delta.win -magic -1e+10 < data.lf0 > data.lf0.delta
  * @endcode
  *
+ * The derivatives are computed for a block of frames at once. The frames
+ * required by the window at the edges of a block are kept for the next block,
+ * so the result does not depend on the block size and the memory does not
+ * grow with the length of the input.
+ *
  * @b -r option specifies the width of regression coefficients, @f$L^{(1)}@f$
  * and @f$L^{(2)}@f$. The first and second derivatives are then calculated as
  * follows:
@@ -305,10 +314,9 @@ int main(int argc, char* argv[]) {
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
   const int input_length(num_order + 1);
-  sptk::InputSourceFromStream input_source(false, input_length, &input_stream);
-  sptk::DeltaCalculation delta_calculation(
-      num_order, window_coefficients, &input_source, is_magic_number_specified,
-      magic_number);
+  sptk::DeltaCalculation delta_calculation(num_order, window_coefficients, NULL,
+                                           is_magic_number_specified,
+                                           magic_number);
   if (!delta_calculation.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize DeltaCalculation";
@@ -316,16 +324,82 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  const int output_length(delta_calculation.GetSize());
-  std::vector<double> output(output_length);
+  // The rows of the block are the past frames required by the window, the
+  // frames to be output, and the future frames required by the window. The
+  // frames before the beginning and after the end of the input are the same
+  // as the first and last frames, respectively.
+  int max_window_width(0);
+  for (std::vector<std::vector<double> >::const_iterator itr(
+           window_coefficients.begin());
+       itr != window_coefficients.end(); ++itr) {
+    max_window_width =
+        std::max(max_window_width, static_cast<int>(itr->size()));
+  }
+  const int num_past_frame(max_window_width / 2);
+  const int num_future_frame((max_window_width - 1) / 2);
+  const int num_row(num_past_frame + kNumFrameInBlock + num_future_frame);
+  sptk::Matrix statics(num_row, input_length);
+  sptk::Matrix delta;
+  std::vector<double> static_components(input_length);
 
-  while (delta_calculation.Get(&output)) {
-    if (!sptk::WriteStream(0, output_length, output, &std::cout, NULL)) {
+  // Number of frames stored after the past frames.
+  int num_frame(0);
+  bool is_first(true);
+  for (bool is_end(false); !is_end || 0 < num_frame;) {
+    // Read frames.
+    while (!is_end && num_past_frame + num_frame < num_row) {
+      if (!sptk::ReadStream(false, 0, 0, input_length, &static_components,
+                            &input_stream, NULL)) {
+        is_end = true;
+        break;
+      }
+      std::copy(static_components.begin(), static_components.end(),
+                statics[num_past_frame + num_frame]);
+      ++num_frame;
+    }
+    if (0 == num_frame) {
+      break;
+    }
+    if (is_first) {
+      for (int t(0); t < num_past_frame; ++t) {
+        std::copy(statics[num_past_frame], statics[num_past_frame + 1],
+                  statics[t]);
+      }
+      is_first = false;
+    }
+    if (is_end) {
+      const int last(num_past_frame + num_frame - 1);
+      for (int t(last + 1); t < num_row; ++t) {
+        std::copy(statics[last], statics[last + 1], statics[t]);
+      }
+    }
+
+    if (!delta_calculation.Run(statics, &delta)) {
       std::ostringstream error_message;
-      error_message << "Failed to write delta";
+      error_message << "Failed to calculate delta";
       sptk::PrintErrorMessage("delta", error_message);
       return 1;
     }
+
+    const int num_output_frame(std::min(kNumFrameInBlock, num_frame));
+    const int output_length(delta_calculation.GetSize());
+    for (int t(0); t < num_output_frame; ++t) {
+      const double* output(delta[num_past_frame + t]);
+      if (!sptk::WriteStream(0, output_length,
+                             std::vector<double>(output, output + output_length),
+                             &std::cout, NULL)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write delta";
+        sptk::PrintErrorMessage("delta", error_message);
+        return 1;
+      }
+    }
+
+    // Keep the past frames and the frames not output yet.
+    double* top(statics[0]);
+    std::copy(top + num_output_frame * input_length,
+              top + (num_past_frame + num_frame) * input_length, top);
+    num_frame -= num_output_frame;
   }
 
   return 0;
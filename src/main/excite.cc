@@ -19,6 +19,7 @@
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/generation/excitation_generation.h"
@@ -36,6 +37,9 @@ const bool kDefaultFlagToUseNormalDistributedRandomValue(false);
 const int kDefaultSeed(1);
 const double kMagicNumberForUnvoicedFrame(0.0);
 
+// Number of samples generated at once.
+const int kBlockSize(4096);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -219,9 +223,11 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
-    double excitation;
-    while (excitation_generation.Get(&excitation, NULL, NULL, NULL)) {
-      if (!sptk::WriteStream(excitation, &std::cout)) {
+    std::vector<double> excitation(kBlockSize);
+    while (excitation_generation.Get(kBlockSize, &excitation, NULL, NULL,
+                                     NULL)) {
+      if (!sptk::WriteStream(0, static_cast<int>(excitation.size()),
+                             excitation, &std::cout, NULL)) {
         std::ostringstream error_message;
         error_message << "Failed to write excitation";
         sptk::PrintErrorMessage("excite", error_message);
@@ -14,17 +14,22 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <cfloat>    // DBL_MAX
-#include <fstream>   // std::ifstream
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
+#include <algorithm>  // std::copy
+#include <cfloat>     // DBL_MAX
+#include <cstring>    // std::strncmp
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <string>     // std::string
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/analysis/mel_filter_bank_analysis.h"
 #include "SPTK/conversion/spectrum_to_spectrum.h"
 #include "SPTK/conversion/waveform_to_spectrum.h"
+#include "SPTK/math/matrix.h"
+#include "SPTK/math/real_valued_fast_fourier_transform.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -47,6 +52,10 @@ const double kDefaultLowestFrequency(0.0);
 const InputFormats kDefaultInputFormat(kWaveform);
 const OutputFormats kDefaultOutputFormat(kFbank);
 const double kDefaultFloor(1.0);
+const char* kDefaultDataType("d");
+
+// Number of frames analyzed at once.
+const int kNumFrameInBlock(256);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -71,19 +80,97 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 0 (fbank)" << std::endl;
   *stream << "                 1 (fbank and energy)" << std::endl;
   *stream << "       -e e  : floor of raw filter-bank output (double)[" << std::setw(5) << std::right << kDefaultFloor           << "][ 0.0 <  e <=       ]" << std::endl;  // NOLINT
+  *stream << "       +type : data type                               [" << std::setw(5) << std::right << kDefaultDataType        << "]" << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("f", stream); sptk::PrintDataType("d", stream); *stream << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
-  *stream << "       windowed data sequence or spectrum      (double)[stdin]" << std::endl;  // NOLINT
+  *stream << "       windowed data sequence or spectrum      (  type)[stdin]" << std::endl;  // NOLINT
   *stream << "  stdout:" << std::endl;
-  *stream << "       mel-filter-bank output                  (double)" << std::endl;  // NOLINT
+  *stream << "       mel-filter-bank output                  (  type)" << std::endl;  // NOLINT
   *stream << "  notice:" << std::endl;
   *stream << "       value of l must be a power of 2" << std::endl;
+  *stream << "       if type is f, output is computed in single precision" << std::endl;  // NOLINT
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
   // clang-format on
 }
 
+// Analyze frames one by one in single precision. The input spectrum other
+// than power spectrum is converted in double precision.
+bool ProcessInSinglePrecision(
+    const sptk::SpectrumToSpectrum& spectrum_to_spectrum,
+    const sptk::RealValuedFastFourierTransform& fast_fourier_transform,
+    const sptk::MelFilterBankAnalysis& analysis, InputFormats input_format,
+    OutputFormats output_format, std::istream* input_stream) {
+  const int fft_length(analysis.GetFftLength());
+  const int input_length(kWaveform == input_format ? fft_length
+                                                   : fft_length / 2 + 1);
+  const int output_length(analysis.GetNumChannel());
+  std::vector<float> input(input_length);
+  std::vector<double> double_input(input_length);
+  std::vector<double> double_power_spectrum(fft_length / 2 + 1);
+  std::vector<float> power_spectrum(fft_length / 2 + 1);
+  std::vector<float> real_part;
+  std::vector<float> imag_part;
+  std::vector<float> output(output_length);
+  float energy;
+  sptk::RealValuedFastFourierTransform::Buffer buffer;
+
+  while (sptk::ReadStream(false, 0, 0, input_length, &input, input_stream,
+                          NULL)) {
+    if (kWaveform == input_format) {
+      if (!fast_fourier_transform.Run(input, &real_part, &imag_part,
+                                      &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to transform waveform to spectrum";
+        sptk::PrintErrorMessage("fbank", error_message);
+        return false;
+      }
+      for (int k(0); k <= fft_length / 2; ++k) {
+        power_spectrum[k] =
+            real_part[k] * real_part[k] + imag_part[k] * imag_part[k];
+      }
+    } else if (kPowerSpectrum == input_format) {
+      power_spectrum = input;
+    } else {
+      double_input.assign(input.begin(), input.end());
+      if (!spectrum_to_spectrum.Run(double_input, &double_power_spectrum)) {
+        std::ostringstream error_message;
+        error_message << "Failed to convert spectrum";
+        sptk::PrintErrorMessage("fbank", error_message);
+        return false;
+      }
+      power_spectrum.assign(double_power_spectrum.begin(),
+                            double_power_spectrum.end());
+    }
+
+    if (!analysis.Run(power_spectrum, &output,
+                      kFbankAndEnergy == output_format ? &energy : NULL)) {
+      std::ostringstream error_message;
+      error_message << "Failed to run mel-filter bank analysis";
+      sptk::PrintErrorMessage("fbank", error_message);
+      return false;
+    }
+
+    if (!sptk::WriteStream(0, output_length, output, &std::cout, NULL)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write filter-bank output";
+      sptk::PrintErrorMessage("fbank", error_message);
+      return false;
+    }
+    if (kFbankAndEnergy == output_format &&
+        !sptk::WriteStream(energy, &std::cout)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write energy";
+      sptk::PrintErrorMessage("fbank", error_message);
+      return false;
+    }
+  }
+
+  return true;
+}
+
 }  // namespace
 
 /**
@@ -112,10 +199,14 @@ void PrintUsage(std::ostream* stream) {
  *     @arg @c 1 fbank and energy
  * - @b -e @e double
  *   - floor of raw filter-bank output @f$(0 < \epsilon)@f$
+ * - @b +type @e char
+ *   - data type
+ *     \arg @c f float (4byte)
+ *     \arg @c d double (8byte)
  * - @b infile @e str
- *   - double-type windowed sequence or spectrum
+ *   - windowed sequence or spectrum
  * - @b stdout
- *   - double-type mel-filter-bank output
+ *   - mel-filter-bank output
  *
  * The below example extracts the 20-channel mel-filter-bank outputs from
  * a Hamming windowed signal.
@@ -125,6 +216,10 @@ void PrintUsage(std::ostream* stream) {
  *      fbank -l 512 -n 20 > data.fbank
  * @endcode
  *
+ * If the data type is float, the frames are analyzed in single precision,
+ * which halves the memory traffic. Only the conversion of the input spectrum
+ * other than power spectrum is computed in double precision.
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -139,6 +234,7 @@ int main(int argc, char* argv[]) {
   InputFormats input_format(kDefaultInputFormat);
   OutputFormats output_format(kDefaultOutputFormat);
   double floor(kDefaultFloor);
+  std::string data_type(kDefaultDataType);
 
   for (;;) {
     const int option_char(
@@ -269,14 +365,27 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  const int num_input_files(argc - optind);
-  if (1 < num_input_files) {
+  const char* input_file(NULL);
+  for (int i(argc - optind); 1 <= i; --i) {
+    const char* arg(argv[argc - i]);
+    if (0 == std::strncmp(arg, "+", 1)) {
+      const std::string str(arg);
+      data_type = str.substr(1, std::string::npos);
+    } else if (NULL == input_file) {
+      input_file = arg;
+    } else {
+      std::ostringstream error_message;
+      error_message << "Too many input files";
+      sptk::PrintErrorMessage("fbank", error_message);
+      return 1;
+    }
+  }
+  if ("f" != data_type && "d" != data_type) {
     std::ostringstream error_message;
-    error_message << "Too many input files";
+    error_message << "Unexpected argument for the +type option";
     sptk::PrintErrorMessage("fbank", error_message);
     return 1;
   }
-  const char* input_file(0 == num_input_files ? NULL : argv[optind]);
 
   std::ifstream ifs;
   ifs.open(input_file, std::ios::in | std::ios::binary);
@@ -322,55 +431,102 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  if ("f" == data_type) {
+    const sptk::RealValuedFastFourierTransform fast_fourier_transform(
+        fft_length);
+    if (kWaveform == input_format && !fast_fourier_transform.IsValid()) {
+      std::ostringstream error_message;
+      error_message << "Failed to set condition for spectral analysis";
+      sptk::PrintErrorMessage("fbank", error_message);
+      return 1;
+    }
+    return ProcessInSinglePrecision(spectrum_to_spectrum,
+                                    fast_fourier_transform, analysis,
+                                    input_format, output_format,
+                                    &input_stream)
+               ? 0
+               : 1;
+  }
+
   const int input_length(kWaveform == input_format ? fft_length
                                                    : fft_length / 2 + 1);
   const int output_length(num_channel);
   std::vector<double> input(input_length);
   std::vector<double> processed_input(fft_length / 2 + 1);
-  std::vector<double> output(output_length);
-  double energy;
+  sptk::Matrix power_spectra(kNumFrameInBlock, fft_length / 2 + 1);
+  sptk::Matrix outputs;
+  std::vector<double> energies;
 
-  while (sptk::ReadStream(false, 0, 0, input_length, &input, &input_stream,
-                          NULL)) {
-    if (kWaveform != input_format) {
-      if (!spectrum_to_spectrum.Run(input, &processed_input)) {
-        std::ostringstream error_message;
-        error_message << "Failed to convert spectrum";
-        sptk::PrintErrorMessage("fbank", error_message);
-        return 1;
+  for (bool is_end(false); !is_end;) {
+    // Read a block of frames.
+    int num_frame(0);
+    while (num_frame < kNumFrameInBlock) {
+      if (!sptk::ReadStream(false, 0, 0, input_length, &input, &input_stream,
+                            NULL)) {
+        is_end = true;
+        break;
       }
-    } else {
-      if (!waveform_to_spectrum.Run(input, &processed_input,
-                                    &buffer_for_spectral_analysis)) {
+
+      if (kWaveform != input_format) {
+        if (!spectrum_to_spectrum.Run(input, &processed_input)) {
+          std::ostringstream error_message;
+          error_message << "Failed to convert spectrum";
+          sptk::PrintErrorMessage("fbank", error_message);
+          return 1;
+        }
+      } else {
+        if (!waveform_to_spectrum.Run(input, &processed_input,
+                                      &buffer_for_spectral_analysis)) {
+          std::ostringstream error_message;
+          error_message << "Failed to transform waveform to spectrum";
+          sptk::PrintErrorMessage("fbank", error_message);
+          return 1;
+        }
+      }
+      std::copy(processed_input.begin(), processed_input.end(),
+                power_spectra[num_frame]);
+      ++num_frame;
+    }
+    if (0 == num_frame) {
+      break;
+    }
+    if (num_frame < kNumFrameInBlock) {
+      sptk::Matrix last_block;
+      if (!power_spectra.GetSubmatrix(0, num_frame, 0, fft_length / 2 + 1,
+                                      &last_block)) {
         std::ostringstream error_message;
-        error_message << "Failed to transform waveform to spectrum";
+        error_message << "Failed to extract the last block";
         sptk::PrintErrorMessage("fbank", error_message);
         return 1;
       }
+      power_spectra = last_block;
     }
 
-    if (!analysis.Run(processed_input, &output,
-                      kFbankAndEnergy == output_format ? &energy : NULL)) {
+    if (!analysis.Run(power_spectra, &outputs,
+                      kFbankAndEnergy == output_format ? &energies : NULL)) {
       std::ostringstream error_message;
       error_message << "Failed to run mel-filter bank analysis";
       sptk::PrintErrorMessage("fbank", error_message);
       return 1;
     }
 
-    if (!sptk::WriteStream(0, output_length, output, &std::cout, NULL)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write filter-bank output";
-      sptk::PrintErrorMessage("fbank", error_message);
-      return 1;
-    }
-
-    if (kFbankAndEnergy == output_format) {
-      if (!sptk::WriteStream(energy, &std::cout)) {
+    for (int t(0); t < num_frame; ++t) {
+      std::vector<double> output(outputs[t], outputs[t] + output_length);
+      if (!sptk::WriteStream(0, output_length, output, &std::cout, NULL)) {
         std::ostringstream error_message;
-        error_message << "Failed to write energy";
+        error_message << "Failed to write filter-bank output";
         sptk::PrintErrorMessage("fbank", error_message);
         return 1;
       }
+
+      if (kFbankAndEnergy == output_format) {
+        if (!sptk::WriteStream(energies[t], &std::cout)) {
+          std::ostringstream error_message;
+          error_message << "Failed to write energy";
+          sptk::PrintErrorMessage("fbank", error_message);
+          return 1;
+        }
+      }
     }
   }
 
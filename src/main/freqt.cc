@@ -14,14 +14,16 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <fstream>   // std::ifstream
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
+#include <algorithm>  // std::copy
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/math/frequency_transform.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -31,6 +33,9 @@ const int kDefaultNumOutputOrder(25);
 const double kDefaultInputAlpha(0.0);
 const double kDefaultOutputAlpha(0.35);
 
+// Number of frames transformed at once.
+const int kNumFrameInBlock(256);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -179,7 +184,6 @@ int main(int argc, char* argv[]) {
                      (1.0 - input_alpha * output_alpha));
   sptk::FrequencyTransform frequency_transform(num_input_order,
                                                num_output_order, alpha);
-  sptk::FrequencyTransform::Buffer buffer;
   if (!frequency_transform.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize FrequencyTransform";
@@ -188,22 +192,46 @@ int main(int argc, char* argv[]) {
   }
 
   const int input_length(num_input_order + 1);
-  const int output_length(num_output_order + 1);
   std::vector<double> minimum_phase_sequence(input_length);
-  std::vector<double> warped_sequence(output_length);
+  sptk::Matrix minimum_phase_sequences(kNumFrameInBlock, input_length);
+  sptk::Matrix warped_sequences;
+
+  for (bool is_end(false); !is_end;) {
+    // Read a block of frames.
+    int num_frame(0);
+    while (num_frame < kNumFrameInBlock) {
+      if (!sptk::ReadStream(false, 0, 0, input_length, &minimum_phase_sequence,
+                            &input_stream, NULL)) {
+        is_end = true;
+        break;
+      }
+      std::copy(minimum_phase_sequence.begin(), minimum_phase_sequence.end(),
+                minimum_phase_sequences[num_frame]);
+      ++num_frame;
+    }
+    if (0 == num_frame) {
+      break;
+    }
+    if (num_frame < kNumFrameInBlock) {
+      sptk::Matrix last_block;
+      if (!minimum_phase_sequences.GetSubmatrix(0, num_frame, 0, input_length,
+                                                &last_block)) {
+        std::ostringstream error_message;
+        error_message << "Failed to extract the last block";
+        sptk::PrintErrorMessage("freqt", error_message);
+        return 1;
+      }
+      minimum_phase_sequences = last_block;
+    }
 
-  while (sptk::ReadStream(false, 0, 0, input_length, &minimum_phase_sequence,
-                          &input_stream, NULL)) {
-    if (!frequency_transform.Run(minimum_phase_sequence, &warped_sequence,
-                                 &buffer)) {
+    if (!frequency_transform.Run(minimum_phase_sequences, &warped_sequences)) {
       std::ostringstream error_message;
       error_message << "Failed to run frequency transform";
       sptk::PrintErrorMessage("freqt", error_message);
       return 1;
     }
 
-    if (!sptk::WriteStream(0, output_length, warped_sequence, &std::cout,
-                           NULL)) {
+    if (!sptk::WriteStream(warped_sequences, &std::cout)) {
       std::ostringstream error_message;
       error_message << "Failed to write warped sequence";
       sptk::PrintErrorMessage("freqt", error_message);
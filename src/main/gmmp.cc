@@ -14,14 +14,18 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <fstream>   // std::ifstream
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
+#include <algorithm>  // std::copy
+#include <cstring>    // std::strncmp
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <string>     // std::string
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/math/gaussian_mixture_modeling.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -29,6 +33,10 @@ namespace {
 const int kDefaultNumOrder(25);
 const int kDefaultNumMixture(16);
 const bool kDefaultFullCovarianceFlag(false);
+const char* kDefaultDataType("d");
+
+// Number of vectors evaluated at once.
+const int kNumVectorInBlock(256);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -43,15 +51,18 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -k k  : number of mixtures  (   int)[" << std::setw(5) << std::right << kDefaultNumMixture   << "][ 1 <= k <=   ]" << std::endl;  // NOLINT
   *stream << "       -f    : use full covariance (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultFullCovarianceFlag) << "]" << std::endl;  // NOLINT
   *stream << "               or block covariance" << std::endl;
+  *stream << "       +type : data type                   [" << std::setw(5) << std::right << kDefaultDataType     << "]" << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("f", stream); sptk::PrintDataType("d", stream); *stream << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  gmmfile:" << std::endl;
   *stream << "       GMM parameters              (double)" << std::endl;
   *stream << "  infile:" << std::endl;
-  *stream << "       input data sequence         (double)[stdin]" << std::endl;
+  *stream << "       input data sequence         (  type)[stdin]" << std::endl;
   *stream << "  stdout:" << std::endl;
-  *stream << "       log-probability sequence    (double)" << std::endl;
+  *stream << "       log-probability sequence    (  type)" << std::endl;
   *stream << "  notice:" << std::endl;
   *stream << "       -B option requires B1 + B2 + ... + Bp = l" << std::endl;
+  *stream << "       if type is f, log-probability is computed in single precision" << std::endl;  // NOLINT
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
@@ -71,12 +82,16 @@ void PrintUsage(std::ostream* stream) {
  *   - number of mixtures @f$(1 \le K)@f$
  * - @b -f
  *   - use full or block covariance instead of diagonal one
+ * - @b +type @e char
+ *   - data type of input and output
+ *     \arg @c f float (4byte)
+ *     \arg @c d double (8byte)
  * - @b gmmfile @e str
  *   - double-type GMM parameters
  * - @b infile @e str
- *   - double-type input data sequencea
+ *   - input data sequence
  * - @b stdout
- *   - double-type log-probability
+ *   - log-probability
  *
  * The input of this command is
  * @f[
@@ -108,6 +123,10 @@ void PrintUsage(std::ostream* stream) {
  *   vstat -o 1 data.p > data.p.avg
  * @endcode
  *
+ * If the data type is float, the log-probabilities are computed vector by
+ * vector in single precision. The GMM parameters are read in double precision
+ * and converted once.
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -172,14 +191,31 @@ int main(int argc, char* argv[]) {
   }
 
   // Get input file names.
+  std::string data_type(kDefaultDataType);
+  std::vector<const char*> input_files;
+  for (int i(optind); i < argc; ++i) {
+    if (0 == std::strncmp(argv[i], "+", 1)) {
+      const std::string str(argv[i]);
+      data_type = str.substr(1, std::string::npos);
+    } else {
+      input_files.push_back(argv[i]);
+    }
+  }
+  if ("f" != data_type && "d" != data_type) {
+    std::ostringstream error_message;
+    error_message << "Unexpected argument for the +type option";
+    sptk::PrintErrorMessage("gmmp", error_message);
+    return 1;
+  }
+
   const char* gmm_file;
   const char* input_file;
-  const int num_input_files(argc - optind);
+  const int num_input_files(static_cast<int>(input_files.size()));
   if (2 == num_input_files) {
-    gmm_file = argv[argc - 2];
-    input_file = argv[argc - 1];
+    gmm_file = input_files[0];
+    input_file = input_files[1];
   } else if (1 == num_input_files) {
-    gmm_file = argv[argc - 1];
+    gmm_file = input_files[0];
     input_file = NULL;
   } else {
     std::ostringstream error_message;
@@ -253,22 +289,74 @@ int main(int argc, char* argv[]) {
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
   const int length(num_order + 1);
+  if ("f" == data_type) {
+    std::vector<float> input_vector(length);
+    float log_probability;
+    sptk::GaussianMixtureModeling::Buffer buffer;
+    while (sptk::ReadStream(false, 0, 0, length, &input_vector, &input_stream,
+                            NULL)) {
+      if (!sptk::GaussianMixtureModeling::CalculateLogProbability(
+              num_order, num_mixture, is_diagonal, true, input_vector,
+              weights, mean_vectors, covariance_matrices, NULL,
+              &log_probability, &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to compute log-probability";
+        sptk::PrintErrorMessage("gmmp", error_message);
+        return 1;
+      }
+      if (!sptk::WriteStream(log_probability, &std::cout)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write log-probability";
+        sptk::PrintErrorMessage("gmmp", error_message);
+        return 1;
+      }
+    }
+    return 0;
+  }
+
   std::vector<double> input_vector(length);
+  sptk::Matrix input_vectors(kNumVectorInBlock, length);
+  std::vector<double> log_probabilities;
   sptk::GaussianMixtureModeling::Buffer buffer;
 
-  while (sptk::ReadStream(false, 0, 0, length, &input_vector, &input_stream,
-                          NULL)) {
-    double log_probability;
+  for (bool is_end(false); !is_end;) {
+    // Read a block of vectors.
+    int num_vector(0);
+    while (num_vector < kNumVectorInBlock) {
+      if (!sptk::ReadStream(false, 0, 0, length, &input_vector, &input_stream,
+                            NULL)) {
+        is_end = true;
+        break;
+      }
+      std::copy(input_vector.begin(), input_vector.end(),
+                input_vectors[num_vector]);
+      ++num_vector;
+    }
+    if (0 == num_vector) {
+      break;
+    }
+    if (num_vector < kNumVectorInBlock) {
+      sptk::Matrix last_block;
+      if (!input_vectors.GetSubmatrix(0, num_vector, 0, length, &last_block)) {
+        std::ostringstream error_message;
+        error_message << "Failed to extract the last block";
+        sptk::PrintErrorMessage("gmmp", error_message);
+        return 1;
+      }
+      input_vectors = last_block;
+    }
+
     if (!sptk::GaussianMixtureModeling::CalculateLogProbability(
-            num_order, num_mixture, is_diagonal, true, input_vector, weights,
-            mean_vectors, covariance_matrices, NULL, &log_probability,
+            num_order, num_mixture, is_diagonal, true, input_vectors,
+            weights, mean_vectors, covariance_matrices, &log_probabilities,
             &buffer)) {
       std::ostringstream error_message;
       error_message << "Failed to compute log-probability";
       sptk::PrintErrorMessage("gmmp", error_message);
       return 1;
     }
-    if (!sptk::WriteStream(log_probability, &std::cout)) {
+    if (!sptk::WriteStream(0, num_vector, log_probabilities, &std::cout,
+                           NULL)) {
       std::ostringstream error_message;
       error_message << "Failed to write log-probability";
       sptk::PrintErrorMessage("gmmp", error_message);
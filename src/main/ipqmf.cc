@@ -14,11 +14,12 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <fstream>   // std::ifstream
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
+#include <algorithm>  // std::fill
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/filter/inverse_pseudo_quadrature_mirror_filter_banks.h"
@@ -26,12 +27,15 @@
 
 namespace {
 
+enum InputFormats { kFullRate = 0, kDecimated, kNumInputFormats };
+
 const int kDefaultNumSubband(4);
 const int kDefaultNumFilterOrder(47);
 const double kDefaultAttenuation(100.0);
 const int kDefaultNumIteration(100);
 const double kDefaultConvergenceThreshold(1e-6);
 const double kDefaultInitialStepSize(1e-2);
+const InputFormats kDefaultInputFormat(kFullRate);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -43,6 +47,9 @@ void PrintUsage(std::ostream* stream) {
   *stream << "  options:" << std::endl;
   *stream << "       -k k  : number of subbands         (   int)[" << std::setw(5) << std::right << kDefaultNumSubband           << "][   1 <= k <=   ]" << std::endl;  // NOLINT
   *stream << "       -m m  : order of filter            (   int)[" << std::setw(5) << std::right << kDefaultNumFilterOrder       << "][   2 <= m <=   ]" << std::endl;  // NOLINT
+  *stream << "       -q q  : input format               (   int)[" << std::setw(5) << std::right << kDefaultInputFormat          << "][   0 <= q <= 1 ]" << std::endl;  // NOLINT
+  *stream << "                 0 (full-rate subband signals)" << std::endl;
+  *stream << "                 1 (decimated subband signals)" << std::endl;
   *stream << "     (level 2)" << std::endl;
   *stream << "       -a a  : stopband attenuation in dB (double)[" << std::setw(5) << std::right << kDefaultAttenuation          << "][   0 <  a <=   ]" << std::endl;  // NOLINT
   *stream << "       -i i  : number of iterations       (   int)[" << std::setw(5) << std::right << kDefaultNumIteration         << "][   0 <  i <=   ]" << std::endl;  // NOLINT
@@ -68,6 +75,10 @@ void PrintUsage(std::ostream* stream) {
  *   - number of subbands @f$(1 \le K)@f$
  * - @b -m @e int
  *   - order of filter @f$(2 \le M)@f$
+ * - @b -q @e int
+ *   - input format @f$(0 \le Q \le 1)@f$
+ *     \arg @c 0 full-rate subband signals
+ *     \arg @c 1 decimated subband signals
  * - @b -a @e double
  *   - stopband attenuation @f$(0 < \alpha)@f$
  * - @b -i @e int
@@ -88,6 +99,12 @@ void PrintUsage(std::ostream* stream) {
  *   interpolate -l 4 -p 4 -o 2 < data.sub | ipqmf -k 4 | x2x +ds > data.raw
  * @endcode
  *
+ * The interpolation can be omitted by specifying the input format:
+ *
+ * @code{.sh}
+ *   ipqmf -k 4 -q 1 < data.sub | x2x +ds > data.raw
+ * @endcode
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -99,9 +116,11 @@ int main(int argc, char* argv[]) {
   int num_iteration(kDefaultNumIteration);
   double convergence_threshold(kDefaultConvergenceThreshold);
   double initial_step_size(kDefaultInitialStepSize);
+  InputFormats input_format(kDefaultInputFormat);
 
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "k:m:a:i:d:s:h", NULL, NULL));
+    const int option_char(
+        getopt_long(argc, argv, "k:m:q:a:i:d:s:h", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -127,6 +146,21 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'q': {
+        const int min(0);
+        const int max(static_cast<int>(kNumInputFormats) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -q option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("ipqmf", error_message);
+          return 1;
+        }
+        input_format = static_cast<InputFormats>(tmp);
+        break;
+      }
       case 'a': {
         if (!sptk::ConvertStringToDouble(optarg, &attenuation) ||
             attenuation <= 0.0) {
@@ -218,6 +252,60 @@ int main(int argc, char* argv[]) {
   const int delay(sptk::IsEven(num_filter_order) ? num_filter_order / 2
                                                  : (num_filter_order + 1) / 2);
 
+  if (kDecimated == input_format) {
+    std::vector<double> output_samples(num_subband);
+    int num_output(0);
+
+    int n(0);
+    while (sptk::ReadStream(false, 0, 0, num_subband, &input, &input_stream,
+                            NULL)) {
+      if (!synthesis.Run(input, &output_samples, &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to perform PQMF synthesis";
+        sptk::PrintErrorMessage("ipqmf", error_message);
+        return 1;
+      }
+      for (int i(0); i < num_subband; ++i, ++n) {
+        if (delay <= n) {
+          if (!sptk::WriteStream(output_samples[i], &std::cout)) {
+            std::ostringstream error_message;
+            error_message << "Failed to write reconstructed signal";
+            sptk::PrintErrorMessage("ipqmf", error_message);
+            return 1;
+          }
+          ++num_output;
+        }
+      }
+    }
+
+    // The last input of the equivalent full-rate signal is zero unless K = 1.
+    if (1 < num_subband) {
+      std::fill(input.begin(), input.end(), 0.0);
+    }
+    const int num_sample(n);
+    while (num_output < num_sample) {
+      if (!synthesis.Run(input, &output_samples, &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to perform PQMF synthesis";
+        sptk::PrintErrorMessage("ipqmf", error_message);
+        return 1;
+      }
+      for (int i(0); i < num_subband && num_output < num_sample; ++i, ++n) {
+        if (delay <= n) {
+          if (!sptk::WriteStream(output_samples[i], &std::cout)) {
+            std::ostringstream error_message;
+            error_message << "Failed to write reconstructed signal";
+            sptk::PrintErrorMessage("ipqmf", error_message);
+            return 1;
+          }
+          ++num_output;
+        }
+      }
+    }
+
+    return 0;
+  }
+
   int n(0);
   while (
       sptk::ReadStream(false, 0, 0, num_subband, &input, &input_stream, NULL)) {
@@ -0,0 +1,377 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include <algorithm>  // std::min
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
+
+#include "Getopt/getoptwin.h"
+#include "SPTK/math/inverse_short_time_fourier_transform.h"
+#include "SPTK/utils/sptk_utils.h"
+#include "SPTK/window/data_windowing.h"
+#include "SPTK/window/standard_window.h"
+
+namespace {
+
+enum FramingTypes { kCenter = 0, kStart, kNumFramingTypes };
+
+enum LocalWindowType {
+  kBlackman = 0,
+  kHamming,
+  kHanning,
+  kBartlett,
+  kTrapezoidal,
+  kRectangular,
+  kNumWindowTypes
+};
+
+const int kDefaultFrameLength(256);
+const int kDefaultFramePeriod(100);
+const FramingTypes kDefaultFramingType(kCenter);
+const sptk::DataWindowing::NormalizationType kDefaultNormalizationType(
+    sptk::DataWindowing::NormalizationType::kPower);
+const LocalWindowType kDefaultLocalWindowType(kBlackman);
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " istft - inverse short-time Fourier transform" << std::endl;
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       istft [ options ] [ infile ] > stdout" << std::endl;
+  *stream << "  options:" << std::endl;
+  *stream << "       -l l  : frame length                        (   int)[" << std::setw(5) << std::right << kDefaultFrameLength       << "][   1 <= l <= L   ]" << std::endl;  // NOLINT
+  *stream << "       -L L  : FFT length                          (   int)[" << std::setw(5) << std::right << "l"                       << "][   l <= L <=     ]" << std::endl;  // NOLINT
+  *stream << "       -p p  : frame period                        (   int)[" << std::setw(5) << std::right << kDefaultFramePeriod       << "][   1 <= p <=     ]" << std::endl;  // NOLINT
+  *stream << "       -n n  : framing type                        (   int)[" << std::setw(5) << std::right << kDefaultFramingType       << "][   0 <= n <= 1   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (the beginning of data is the center of the first frame)" << std::endl;  // NOLINT
+  *stream << "                 1 (the beginning of data is the start of the first frame)" << std::endl;  // NOLINT
+  *stream << "       -N N  : normalization type of window        (   int)[" << std::setw(5) << std::right << kDefaultNormalizationType << "][   0 <= N <= 2   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (none)" << std::endl;
+  *stream << "                 1 (power)" << std::endl;
+  *stream << "                 2 (magnitude)" << std::endl;
+  *stream << "       -w w  : window type                         (   int)[" << std::setw(5) << std::right << kDefaultLocalWindowType   << "][   0 <= w <= 5   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (Blackman)" << std::endl;
+  *stream << "                 1 (Hamming)" << std::endl;
+  *stream << "                 2 (Hanning)" << std::endl;
+  *stream << "                 3 (Bartlett)" << std::endl;
+  *stream << "                 4 (trapezoidal)" << std::endl;
+  *stream << "                 5 (rectangular)" << std::endl;
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << "  infile:" << std::endl;
+  *stream << "       real and imaginary parts of spectrum        (double)[stdin]" << std::endl;  // NOLINT
+  *stream << "  stdout:" << std::endl;
+  *stream << "       data sequence                               (double)" << std::endl;  // NOLINT
+  *stream << "  notice:" << std::endl;
+  *stream << "       value of L must be a power of 2" << std::endl;
+  *stream << "       input length of each frame is 2*(L/2+1)" << std::endl;
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+}  // namespace
+
+/**
+ * @a istft [ @e option ] [ @e infile ]
+ *
+ * - @b -l @e int
+ *   - frame length @f$(1 \le L_1)@f$
+ * - @b -L @e int
+ *   - FFT length @f$(L_1 \le L_2)@f$
+ * - @b -p @e int
+ *   - frame period @f$(1 \le P)@f$
+ * - @b -n @e int
+ *   - framing type
+ *     \arg @c 0 the beginning of data is the center of the first frame
+ *     \arg @c 1 the beginning of data is the start of the first frame
+ * - @b -N @e int
+ *   - normalization type of window
+ *     \arg @c 0 none
+ *     \arg @c 1 power
+ *     \arg @c 2 magnitude
+ * - @b -w @e int
+ *   - window type
+ *     \arg @c 0 Blackman
+ *     \arg @c 1 Hamming
+ *     \arg @c 2 Hanning
+ *     \arg @c 3 Bartlett
+ *     \arg @c 4 Trapezoidal
+ *     \arg @c 5 Rectangular
+ * - @b infile @e str
+ *   - double-type real and imaginary parts of spectrum
+ * - @b stdout
+ *   - double-type data sequence
+ *
+ * The input of each frame is the @f$(L_2/2+1)@f$-length real part followed by
+ * the @f$(L_2/2+1)@f$-length imaginary part, which is the output format of
+ * @c fftr with the @c -o @c 0 and @c -H options. The waveform is reconstructed
+ * by the weighted overlap-add with the given window, so the input of @c frame
+ * is recovered if the same options are given to @c frame, @c window, and
+ * @c istft. The length of the output is @f$TP@f$, where @f$T@f$ is the number
+ * of frames.
+ *
+ * @code{.sh}
+ *   frame -l 400 -p 80 data.d | window -l 400 -L 512 |
+ *     fftr -l 512 -o 0 -H > data.ri
+ *   istft -l 400 -L 512 -p 80 data.ri > data.d2
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  int frame_length(kDefaultFrameLength);
+  int fft_length(kDefaultFrameLength);
+  bool is_fft_length_specified(false);
+  int frame_period(kDefaultFramePeriod);
+  FramingTypes framing_type(kDefaultFramingType);
+  sptk::DataWindowing::NormalizationType normalization_type(
+      kDefaultNormalizationType);
+  LocalWindowType local_window_type(kDefaultLocalWindowType);
+
+  for (;;) {
+    const int option_char(getopt_long(argc, argv, "l:L:p:n:N:w:h", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 'l': {
+        if (!sptk::ConvertStringToInteger(optarg, &frame_length) ||
+            frame_length <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -l option must be a positive integer";
+          sptk::PrintErrorMessage("istft", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'L': {
+        if (!sptk::ConvertStringToInteger(optarg, &fft_length) ||
+            fft_length <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -L option must be a positive integer";
+          sptk::PrintErrorMessage("istft", error_message);
+          return 1;
+        }
+        is_fft_length_specified = true;
+        break;
+      }
+      case 'p': {
+        if (!sptk::ConvertStringToInteger(optarg, &frame_period) ||
+            frame_period <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -p option must be a positive integer";
+          sptk::PrintErrorMessage("istft", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'n': {
+        const int min(0);
+        const int max(static_cast<int>(kNumFramingTypes) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -n option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("istft", error_message);
+          return 1;
+        }
+        framing_type = static_cast<FramingTypes>(tmp);
+        break;
+      }
+      case 'N': {
+        const int min(0);
+        const int max(static_cast<int>(sptk::DataWindowing::NormalizationType::
+                                           kNumNormalizationTypes) -
+                      1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -N option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("istft", error_message);
+          return 1;
+        }
+        normalization_type =
+            static_cast<sptk::DataWindowing::NormalizationType>(tmp);
+        break;
+      }
+      case 'w': {
+        const int min(0);
+        const int max(static_cast<int>(kNumWindowTypes) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -w option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("istft", error_message);
+          return 1;
+        }
+        local_window_type = static_cast<LocalWindowType>(tmp);
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  if (!is_fft_length_specified) {
+    fft_length = frame_length;
+  } else if (fft_length < frame_length) {
+    std::ostringstream error_message;
+    error_message << "The frame length " << frame_length
+                  << " must be equal to or less than the FFT length "
+                  << fft_length;
+    sptk::PrintErrorMessage("istft", error_message);
+    return 1;
+  }
+
+  const int num_input_files(argc - optind);
+  if (1 < num_input_files) {
+    std::ostringstream error_message;
+    error_message << "Too many input files";
+    sptk::PrintErrorMessage("istft", error_message);
+    return 1;
+  }
+  const char* input_file(0 == num_input_files ? NULL : argv[optind]);
+
+  std::ifstream ifs;
+  ifs.open(input_file, std::ios::in | std::ios::binary);
+  if (ifs.fail() && NULL != input_file) {
+    std::ostringstream error_message;
+    error_message << "Cannot open file " << input_file;
+    sptk::PrintErrorMessage("istft", error_message);
+    return 1;
+  }
+  std::istream& input_stream(ifs.fail() ? std::cin : ifs);
+
+  sptk::StandardWindow::WindowType window_type;
+  switch (local_window_type) {
+    case kBlackman: {
+      window_type = sptk::StandardWindow::kBlackman;
+      break;
+    }
+    case kHamming: {
+      window_type = sptk::StandardWindow::kHamming;
+      break;
+    }
+    case kHanning: {
+      window_type = sptk::StandardWindow::kHanning;
+      break;
+    }
+    case kBartlett: {
+      window_type = sptk::StandardWindow::kBartlett;
+      break;
+    }
+    case kTrapezoidal: {
+      window_type = sptk::StandardWindow::kTrapezoidal;
+      break;
+    }
+    case kRectangular: {
+      window_type = sptk::StandardWindow::kRectangular;
+      break;
+    }
+    default: {
+      return 1;
+    }
+  }
+
+  sptk::StandardWindow standard_window(frame_length, window_type, false);
+  sptk::InverseShortTimeFourierTransform inverse_short_time_fourier_transform(
+      &standard_window, frame_period, fft_length, normalization_type);
+  sptk::InverseShortTimeFourierTransform::Buffer buffer;
+  if (!inverse_short_time_fourier_transform.IsValid()) {
+    std::ostringstream error_message;
+    error_message << "FFT length must be a power of 2";
+    sptk::PrintErrorMessage("istft", error_message);
+    return 1;
+  }
+
+  const int input_length(fft_length / 2 + 1);
+  std::vector<double> real_part(input_length);
+  std::vector<double> imag_part(input_length);
+  std::vector<double> waveform(frame_period);
+
+  // The first L/2 samples are before the beginning of data if the framing type
+  // is 0.
+  const int num_delay(kCenter == framing_type ? frame_length / 2 : 0);
+  int num_skip(num_delay);
+  int num_frame(0);
+  while (sptk::ReadStream(false, 0, 0, input_length, &real_part,
+                          &input_stream, NULL) &&
+         sptk::ReadStream(false, 0, 0, input_length, &imag_part,
+                          &input_stream, NULL)) {
+    if (!inverse_short_time_fourier_transform.Run(real_part, imag_part,
+                                                  &waveform, &buffer)) {
+      std::ostringstream error_message;
+      error_message << "Failed to run inverse short-time Fourier transform";
+      sptk::PrintErrorMessage("istft", error_message);
+      return 1;
+    }
+    ++num_frame;
+
+    const int write_point(std::min(num_skip, frame_period));
+    num_skip -= write_point;
+    if (write_point < frame_period &&
+        !sptk::WriteStream(write_point, frame_period - write_point, waveform,
+                           &std::cout, NULL)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write data sequence";
+      sptk::PrintErrorMessage("istft", error_message);
+      return 1;
+    }
+  }
+
+  // Output the remaining samples so that the output length is TP.
+  if (0 < num_frame) {
+    if (!inverse_short_time_fourier_transform.Flush(&waveform, &buffer)) {
+      std::ostringstream error_message;
+      error_message << "Failed to run inverse short-time Fourier transform";
+      sptk::PrintErrorMessage("istft", error_message);
+      return 1;
+    }
+    const int num_remaining_sample(num_delay - num_skip);
+    waveform.resize(num_remaining_sample, 0.0);
+    if (0 < num_remaining_sample &&
+        !sptk::WriteStream(0, num_remaining_sample, waveform, &std::cout,
+                           NULL)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write data sequence";
+      sptk::PrintErrorMessage("istft", error_message);
+      return 1;
+    }
+  }
+
+  return 0;
+}
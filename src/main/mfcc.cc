@@ -14,17 +14,19 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <cfloat>    // DBL_MAX
-#include <fstream>   // std::ifstream
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
+#include <algorithm>  // std::copy
+#include <cfloat>     // DBL_MAX
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/analysis/mel_frequency_cepstral_coefficients_analysis.h"
 #include "SPTK/conversion/spectrum_to_spectrum.h"
 #include "SPTK/conversion/waveform_to_spectrum.h"
+#include "SPTK/math/matrix.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -56,6 +58,9 @@ const InputFormats kDefaultInputFormat(kWaveform);
 const OutputFormats kDefaultOutputFormat(kMfcc);
 const double kDefaultFloor(1.0);
 
+// Number of frames analyzed at once.
+const int kNumFrameInBlock(256);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -462,32 +467,59 @@ int main(int argc, char* argv[]) {
   const int output_length(num_order);
   std::vector<double> input(input_length);
   std::vector<double> processed_input(fft_length / 2 + 1);
-  std::vector<double> output(output_length);
-  double energy;
+  sptk::Matrix power_spectra(kNumFrameInBlock, fft_length / 2 + 1);
+  sptk::Matrix outputs;
+  std::vector<double> energies;
 
-  while (sptk::ReadStream(false, 0, 0, input_length, &input, &input_stream,
-                          NULL)) {
-    if (kWaveform != input_format) {
-      if (!spectrum_to_spectrum.Run(input, &processed_input)) {
-        std::ostringstream error_message;
-        error_message << "Failed to convert spectrum";
-        sptk::PrintErrorMessage("mfcc", error_message);
-        return 1;
+  for (bool is_end(false); !is_end;) {
+    // Read a block of frames.
+    int num_frame(0);
+    while (num_frame < kNumFrameInBlock) {
+      if (!sptk::ReadStream(false, 0, 0, input_length, &input, &input_stream,
+                            NULL)) {
+        is_end = true;
+        break;
+      }
+
+      if (kWaveform != input_format) {
+        if (!spectrum_to_spectrum.Run(input, &processed_input)) {
+          std::ostringstream error_message;
+          error_message << "Failed to convert spectrum";
+          sptk::PrintErrorMessage("mfcc", error_message);
+          return 1;
+        }
+      } else {
+        if (!waveform_to_spectrum.Run(input, &processed_input,
+                                      &buffer_for_spectral_analysis)) {
+          std::ostringstream error_message;
+          error_message << "Failed to transform waveform to spectrum";
+          sptk::PrintErrorMessage("mfcc", error_message);
+          return 1;
+        }
       }
-    } else {
-      if (!waveform_to_spectrum.Run(input, &processed_input,
-                                    &buffer_for_spectral_analysis)) {
+      std::copy(processed_input.begin(), processed_input.end(),
+                power_spectra[num_frame]);
+      ++num_frame;
+    }
+    if (0 == num_frame) {
+      break;
+    }
+    if (num_frame < kNumFrameInBlock) {
+      sptk::Matrix last_block;
+      if (!power_spectra.GetSubmatrix(0, num_frame, 0, fft_length / 2 + 1,
+                                      &last_block)) {
         std::ostringstream error_message;
-        error_message << "Failed to transform waveform to spectrum";
+        error_message << "Failed to extract the last block";
         sptk::PrintErrorMessage("mfcc", error_message);
         return 1;
       }
+      power_spectra = last_block;
     }
 
-    if (!analysis.Run(processed_input, &output,
+    if (!analysis.Run(power_spectra, &outputs,
                       (kMfccAndEnergy == output_format ||
                        kMfccAndC0AndEnergy == output_format)
-                          ? &energy
+                          ? &energies
                           : NULL,
                       &buffer_for_mfcc_analysis)) {
       std::ostringstream error_message;
@@ -496,29 +528,33 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
-    if (!sptk::WriteStream(1, output_length, output, &std::cout, NULL)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write filter-bank output";
-      sptk::PrintErrorMessage("mfcc", error_message);
-      return 1;
-    }
-
-    if (kMfccAndC0 == output_format || kMfccAndC0AndEnergy == output_format) {
-      if (!sptk::WriteStream(output[0], &std::cout)) {
+    for (int t(0); t < num_frame; ++t) {
+      std::vector<double> output(outputs[t], outputs[t] + output_length + 1);
+      if (!sptk::WriteStream(1, output_length, output, &std::cout, NULL)) {
         std::ostringstream error_message;
-        error_message << "Failed to write c0";
+        error_message << "Failed to write filter-bank output";
         sptk::PrintErrorMessage("mfcc", error_message);
         return 1;
       }
-    }
 
-    if (kMfccAndEnergy == output_format ||
-        kMfccAndC0AndEnergy == output_format) {
-      if (!sptk::WriteStream(energy, &std::cout)) {
-        std::ostringstream error_message;
-        error_message << "Failed to write energy";
-        sptk::PrintErrorMessage("mfcc", error_message);
-        return 1;
+      if (kMfccAndC0 == output_format ||
+          kMfccAndC0AndEnergy == output_format) {
+        if (!sptk::WriteStream(output[0], &std::cout)) {
+          std::ostringstream error_message;
+          error_message << "Failed to write c0";
+          sptk::PrintErrorMessage("mfcc", error_message);
+          return 1;
+        }
+      }
+
+      if (kMfccAndEnergy == output_format ||
+          kMfccAndC0AndEnergy == output_format) {
+        if (!sptk::WriteStream(energies[t], &std::cout)) {
+          std::ostringstream error_message;
+          error_message << "Failed to write energy";
+          sptk::PrintErrorMessage("mfcc", error_message);
+          return 1;
+        }
       }
     }
   }
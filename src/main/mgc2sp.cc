@@ -15,7 +15,6 @@
 // ------------------------------------------------------------------------ //
 
 #include <algorithm>  // std::transform
-#include <cmath>      // std::exp
 #include <fstream>    // std::ifstream
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
@@ -307,17 +306,17 @@ int main(int argc, char* argv[]) {
         break;
       }
       case kAmplitudeSpectrum: {
-        std::transform(amplitude_spectrum.begin(),
-                       amplitude_spectrum.begin() + output_length,
-                       amplitude_spectrum.begin(),
-                       [](double x) { return std::exp(x); });
+        sptk::Exp(&(amplitude_spectrum[0]), output_length,
+                  &(amplitude_spectrum[0]));
         break;
       }
       case kPowerSpectrum: {
         std::transform(amplitude_spectrum.begin(),
                        amplitude_spectrum.begin() + output_length,
                        amplitude_spectrum.begin(),
-                       [](double x) { return std::exp(2.0 * x); });
+                       [](double x) { return 2.0 * x; });
+        sptk::Exp(&(amplitude_spectrum[0]), output_length,
+                  &(amplitude_spectrum[0]));
         break;
       }
       case kPhaseSpectrumInCycles: {
@@ -15,7 +15,7 @@
 // ------------------------------------------------------------------------ //
 
 #include <cfloat>    // DBL_MAX
-#include <fstream>   // std::ifstream
+#include <fstream>   // std::ifstream, std::ofstream
 #include <iomanip>   // std::setw
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>   // std::ostringstream
@@ -56,6 +56,7 @@ const InputFormats kDefaultInputFormat(kWaveform);
 const OutputFormats kDefaultOutputFormat(kCepstrum);
 const int kDefaultNumIteration(30);
 const double kDefaultConvergenceThreshold(1e-3);
+const bool kDefaultWarmStartFlag(false);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -84,6 +85,9 @@ void PrintUsage(std::ostream* stream) {
   *stream << "     (level 2)" << std::endl;
   *stream << "       -i i  : maximum number of iterations        (   int)[" << std::setw(5) << std::right << kDefaultNumIteration         << "][    0 <= i <=     ]" << std::endl;  // NOLINT
   *stream << "       -d d  : convergence threshold               (double)[" << std::setw(5) << std::right << kDefaultConvergenceThreshold << "][  0.0 <= d <=     ]" << std::endl;  // NOLINT
+  *stream << "       -w    : use previous frame as initial guess (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultWarmStartFlag) << "]" << std::endl;  // NOLINT
+  *stream << "       -I I  : output filename of int type         (string)[" << std::setw(5) << std::right << "N/A"                        << "]" << std::endl;  // NOLINT
+  *stream << "               number of iterations" << std::endl;
   *stream << "       -e e  : small value added to power spectrum (double)[" << std::setw(5) << std::right << "N/A"                        << "][  0.0 <  e <=     ]" << std::endl;  // NOLINT
   *stream << "       -E E  : relative floor in decibels          (double)[" << std::setw(5) << std::right << "N/A"                        << "][      <= E <  0.0 ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
@@ -95,6 +99,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       value of l must be a power of 2" << std::endl;
   *stream << "       if c = 0 or g = 0, standard mel-cepstral analyzer is used" << std::endl;  // NOLINT
   *stream << "       if c > 0 or g != 0, mel-generalized cepstral analyzer is used" << std::endl;  // NOLINT
+  *stream << "       if g = 0, -w can increase number of iterations (check with -I)" << std::endl;  // NOLINT
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
@@ -133,6 +138,10 @@ void PrintUsage(std::ostream* stream) {
  *   - number of iterations @f$(0 \le J)@f$
  * - @b -d @e double
  *   - convergence threshold @f$(0 \le \epsilon)@f$
+ * - @b -w
+ *   - use the previous frame as the initial guess of iteration
+ * - @b -I @e str
+ *   - int-type number of iterations performed in each frame
  * - @b -e @e double
  *   - small value added to power spectrum
  * - @b -E @e double
@@ -154,6 +163,19 @@ void PrintUsage(std::ostream* stream) {
  *   frame < data.d | window | fftr -o 3 -H | mgcep -q 3 > data.mcep
  * @endcode
  *
+ * The @c -w option starts the iteration of each frame from the result of the
+ * previous frame. It typically reduces the number of iterations for
+ * @f$\gamma < 0@f$ and for short frame shifts. For @f$\gamma = 0@f$, however,
+ * the default initial guess is often already close to the solution, and
+ * @c -w can increase the number of iterations on less stationary input. It is
+ * thus not recommended for @f$\gamma = 0@f$ without checking its effect on
+ * the target data with the @c -I option:
+ *
+ * @code{.sh}
+ *   frame < data.d | window | mgcep -w -I data.iter > data.mcep
+ *   x2x +id data.iter | vstat -o 1
+ * @endcode
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -167,12 +189,14 @@ int main(int argc, char* argv[]) {
   OutputFormats output_format(kDefaultOutputFormat);
   int num_iteration(kDefaultNumIteration);
   double convergence_threshold(kDefaultConvergenceThreshold);
+  bool warm_start(kDefaultWarmStartFlag);
+  const char* num_iteration_file(NULL);
   double epsilon(0.0);
   double relative_floor_in_decibels(-DBL_MAX);
 
   for (;;) {
     const int option_char(
-        getopt_long(argc, argv, "m:a:g:c:l:q:o:i:d:e:E:h", NULL, NULL));
+        getopt_long(argc, argv, "m:a:g:c:l:q:o:i:d:wI:e:E:h", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -282,6 +306,14 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'w': {
+        warm_start = true;
+        break;
+      }
+      case 'I': {
+        num_iteration_file = optarg;
+        break;
+      }
       case 'e': {
         if (!sptk::ConvertStringToDouble(optarg, &epsilon) || epsilon <= 0.0) {
           std::ostringstream error_message;
@@ -357,9 +389,9 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  sptk::MelGeneralizedCepstralAnalysis analysis(fft_length, num_order, alpha,
-                                                gamma, num_iteration,
-                                                convergence_threshold);
+  sptk::MelGeneralizedCepstralAnalysis analysis(
+      fft_length, num_order, alpha, gamma, num_iteration, convergence_threshold,
+      warm_start);
   sptk::MelGeneralizedCepstralAnalysis::Buffer buffer_for_cepstral_analysis;
   if (!analysis.IsValid()) {
     std::ostringstream error_message;
@@ -386,12 +418,24 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  std::ofstream ofs;
+  if (NULL != num_iteration_file) {
+    ofs.open(num_iteration_file, std::ios::out | std::ios::binary);
+    if (ofs.fail()) {
+      std::ostringstream error_message;
+      error_message << "Cannot open file " << num_iteration_file;
+      sptk::PrintErrorMessage("mgcep", error_message);
+      return 1;
+    }
+  }
+
   const int input_length(kWaveform == input_format ? fft_length
                                                    : fft_length / 2 + 1);
   const int output_length(num_order + 1);
   std::vector<double> input(input_length);
   std::vector<double> processed_input(fft_length / 2 + 1);
   std::vector<double> output(output_length);
+  int num_performed_iteration;
 
   while (sptk::ReadStream(false, 0, 0, input_length, &input, &input_stream,
                           NULL)) {
@@ -412,7 +456,7 @@ int main(int argc, char* argv[]) {
       }
     }
 
-    if (!analysis.Run(processed_input, &output,
+    if (!analysis.Run(processed_input, &output, &num_performed_iteration,
                       &buffer_for_cepstral_analysis)) {
       std::ostringstream error_message;
       error_message << "Failed to run mel-generalized cepstral analysis";
@@ -420,6 +464,14 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
+    if (NULL != num_iteration_file &&
+        !sptk::WriteStream(num_performed_iteration, &ofs)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write number of iterations";
+      sptk::PrintErrorMessage("mgcep", error_message);
+      return 1;
+    }
+
     if (0.0 != alpha &&
         (kMlsaFilterCoefficients == output_format ||
          kGainNormalizedMlsaFilterCoefficients == output_format)) {
@@ -14,8 +14,6 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <algorithm>  // std::transform
-#include <cmath>      // std::log
 #include <fstream>    // std::ifstream
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
@@ -23,11 +21,10 @@
 #include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
-#include "SPTK/conversion/generalized_cepstrum_gain_normalization.h"
-#include "SPTK/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.h"
 #include "SPTK/filter/mglsa_digital_filter.h"
 #include "SPTK/input/input_source_from_stream.h"
 #include "SPTK/input/input_source_interpolation.h"
+#include "SPTK/input/input_source_preprocessing_for_mel_cepstrum.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
@@ -41,6 +38,9 @@ const int kDefaultNumPadeOrder(4);
 const bool kDefaultTranspositionFlag(false);
 const bool kDefaultGainFlag(true);
 
+// Number of samples filtered at once.
+const int kBlockSize(4096);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -74,97 +74,6 @@ void PrintUsage(std::ostream* stream) {
   // clang-format on
 }
 
-class InputSourcePreprocessingForMelCepstrum
-    : public sptk::InputSourceInterface {
- public:
-  InputSourcePreprocessingForMelCepstrum(double alpha, double gamma,
-                                         bool gain_flag,
-                                         sptk::InputSourceInterface* source)
-      : gamma_(gamma),
-        gain_flag_(gain_flag),
-        source_(source),
-        mel_cepstrum_to_mlsa_digital_filter_coefficients_(
-            source ? source->GetSize() - 1 : 0, alpha),
-        generalized_cepstrum_gain_normalization_(
-            source ? source->GetSize() - 1 : 0, gamma),
-        is_valid_(true) {
-    if (NULL == source || !source->IsValid() ||
-        !mel_cepstrum_to_mlsa_digital_filter_coefficients_.IsValid() ||
-        !generalized_cepstrum_gain_normalization_.IsValid()) {
-      is_valid_ = false;
-      return;
-    }
-  }
-
-  ~InputSourcePreprocessingForMelCepstrum() {
-  }
-
-  bool GetGainFlag() const {
-    return gain_flag_;
-  }
-
-  virtual int GetSize() const {
-    return source_ ? source_->GetSize() : 0;
-  }
-
-  virtual bool IsValid() const {
-    return is_valid_;
-  }
-
-  virtual bool Get(std::vector<double>* mlsa_digital_filter_coefficients) {
-    if (!is_valid_) {
-      return false;
-    }
-
-    if (!source_->Get(&mel_cepstrum_)) {
-      return false;
-    }
-
-    if (!mel_cepstrum_to_mlsa_digital_filter_coefficients_.Run(
-            mel_cepstrum_, mlsa_digital_filter_coefficients)) {
-      return false;
-    }
-
-    if (0.0 != gamma_) {
-      if (!generalized_cepstrum_gain_normalization_.Run(
-              mlsa_digital_filter_coefficients)) {
-        return false;
-      }
-      if (gain_flag_) {
-        (*mlsa_digital_filter_coefficients)[0] =
-            std::log((*mlsa_digital_filter_coefficients)[0]);
-      }
-      std::transform(mlsa_digital_filter_coefficients->begin() + 1,
-                     mlsa_digital_filter_coefficients->end(),
-                     mlsa_digital_filter_coefficients->begin() + 1,
-                     [this](double b) { return b * gamma_; });
-    }
-
-    if (!gain_flag_) {
-      (*mlsa_digital_filter_coefficients)[0] = 0.0;  // exp(0) = 1
-    }
-
-    return true;
-  }
-
- private:
-  const double gamma_;
-  const bool gain_flag_;
-
-  InputSourceInterface* source_;
-
-  const sptk::MelCepstrumToMlsaDigitalFilterCoefficients
-      mel_cepstrum_to_mlsa_digital_filter_coefficients_;
-  const sptk::GeneralizedCepstrumGainNormalization
-      generalized_cepstrum_gain_normalization_;
-
-  bool is_valid_;
-
-  std::vector<double> mel_cepstrum_;
-
-  DISALLOW_COPY_AND_ASSIGN(InputSourcePreprocessingForMelCepstrum);
-};
-
 }  // namespace
 
 /**
@@ -361,8 +270,8 @@ int main(int argc, char* argv[]) {
   sptk::InputSourceFromStream input_source(false, filter_length,
                                            &stream_for_filter_coefficients);
   const double gamma((0 == num_stage) ? 0.0 : -1.0 / num_stage);
-  InputSourcePreprocessingForMelCepstrum preprocessing(alpha, gamma, gain_flag,
-                                                       &input_source);
+  sptk::InputSourcePreprocessingForMelCepstrum preprocessing(
+      alpha, gamma, gain_flag, &input_source);
   sptk::InputSourceInterpolation interpolation(
       frame_period, interpolation_period, true, &preprocessing);
   if (!interpolation.IsValid()) {
@@ -382,24 +291,29 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  double signal;
-
-  while (sptk::ReadStream(&signal, &stream_for_filter_input)) {
-    if (!interpolation.Get(&filter_coefficients)) {
-      std::ostringstream error_message;
-      error_message << "Cannot get filter coefficients";
-      sptk::PrintErrorMessage("mglsadf", error_message);
-      return 1;
-    }
+  std::vector<double> signals(kBlockSize);
+  int actual_read_size;
+
+  while (sptk::ReadStream(true, 0, 0, kBlockSize, &signals,
+                          &stream_for_filter_input, &actual_read_size) &&
+         0 < actual_read_size) {
+    for (int t(0); t < actual_read_size; ++t) {
+      if (!interpolation.Get(&filter_coefficients)) {
+        std::ostringstream error_message;
+        error_message << "Cannot get filter coefficients";
+        sptk::PrintErrorMessage("mglsadf", error_message);
+        return 1;
+      }
 
-    if (!filter.Run(filter_coefficients, &signal, &buffer)) {
-      std::ostringstream error_message;
-      error_message << "Failed to apply MGLSA digital filter";
-      sptk::PrintErrorMessage("mglsadf", error_message);
-      return 1;
+      if (!filter.Run(filter_coefficients, &signals[t], &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to apply MGLSA digital filter";
+        sptk::PrintErrorMessage("mglsadf", error_message);
+        return 1;
+      }
     }
 
-    if (!sptk::WriteStream(signal, &std::cout)) {
+    if (!sptk::WriteStream(0, actual_read_size, signals, &std::cout, NULL)) {
       std::ostringstream error_message;
       error_message << "Failed to write a filter output";
       sptk::PrintErrorMessage("mglsadf", error_message);
@@ -14,9 +14,12 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
+#include <algorithm>  // std::min
+#include <cstddef>    // std::size_t
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/generation/m_sequence_generation.h"
@@ -26,6 +29,9 @@ namespace {
 
 const int kMagicNumberForInfinity(-1);
 
+// Number of values generated at once.
+const int kBlockSize(4096);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -121,16 +127,22 @@ int main(int argc, char* argv[]) {
 
   sptk::MSequenceGeneration generator;
 
+  std::vector<double> outputs(kBlockSize);
   for (int i(0); kMagicNumberForInfinity == output_length || i < output_length;
-       ++i) {
-    double output;
-    if (!generator.Get(&output)) {
+       i += kBlockSize) {
+    const int block_size(kMagicNumberForInfinity == output_length
+                             ? kBlockSize
+                             : std::min(kBlockSize, output_length - i));
+    if (outputs.size() != static_cast<std::size_t>(block_size)) {
+      outputs.resize(block_size);
+    }
+    if (!generator.Get(&outputs)) {
       std::ostringstream error_message;
       error_message << "Failed to generate m-sequence";
       sptk::PrintErrorMessage("mseq", error_message);
       return 1;
     }
-    if (!sptk::WriteStream(output, &std::cout)) {
+    if (!sptk::WriteStream(0, block_size, outputs, &std::cout, NULL)) {
       std::ostringstream error_message;
       error_message << "Failed to write m-sequence";
       sptk::PrintErrorMessage("mseq", error_message);
@@ -14,10 +14,13 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <cmath>     // std::pow, std::sqrt
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
+#include <algorithm>  // std::min
+#include <cmath>      // std::pow, std::sqrt
+#include <cstddef>    // std::size_t
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/generation/normal_distributed_random_value_generation.h"
@@ -30,6 +33,9 @@ const int kDefaultSeed(1);
 const double kDefaultMean(0.0);
 const double kDefaultStandardDeviation(1.0);
 
+// Number of random values generated at once.
+const int kBlockSize(4096);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -192,17 +198,25 @@ int main(int argc, char* argv[]) {
 
   sptk::NormalDistributedRandomValueGeneration generator(seed);
 
+  std::vector<double> outputs(kBlockSize);
   for (int i(0); kMagicNumberForInfinity == output_length || i < output_length;
-       ++i) {
-    double random;
-    if (!generator.Get(&random)) {
+       i += kBlockSize) {
+    const int block_size(kMagicNumberForInfinity == output_length
+                             ? kBlockSize
+                             : std::min(kBlockSize, output_length - i));
+    if (outputs.size() != static_cast<std::size_t>(block_size)) {
+      outputs.resize(block_size);
+    }
+    if (!generator.Get(&outputs)) {
       std::ostringstream error_message;
       error_message << "Failed to generate random values";
       sptk::PrintErrorMessage("nrand", error_message);
       return 1;
     }
-    const double output(mean + random * standard_deviation);
-    if (!sptk::WriteStream(output, &std::cout)) {
+    for (int j(0); j < block_size; ++j) {
+      outputs[j] = mean + outputs[j] * standard_deviation;
+    }
+    if (!sptk::WriteStream(0, block_size, outputs, &std::cout, NULL)) {
       std::ostringstream error_message;
       error_message << "Failed to write random values";
       sptk::PrintErrorMessage("nrand", error_message);
@@ -34,6 +34,8 @@ const int kDefaultNumIteration(10000);
 const double kDefaultConvergenceThreshold(1e-6);
 const sptk::PrincipalComponentAnalysis::CovarianceType kDefaultCovarianceType(
     sptk::PrincipalComponentAnalysis::CovarianceType::kSampleCovariance);
+const sptk::PrincipalComponentAnalysis::EigensolverType kDefaultEigensolverType(
+    sptk::PrincipalComponentAnalysis::EigensolverType::kJacobi);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -52,6 +54,10 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 0 (sample covariance)" << std::endl;
   *stream << "                 1 (unbiased covariance)" << std::endl;
   *stream << "                 2 (correlation)" << std::endl;
+  *stream << "       -s s  : eigenvalue decomposition       (   int)[" << std::setw(5) << std::right << kDefaultEigensolverType       << "][   0 <= s <= 2 ]" << std::endl;  // NOLINT
+  *stream << "                 0 (Jacobi method)" << std::endl;
+  *stream << "                 1 (Householder and QL method)" << std::endl;
+  *stream << "                 2 (randomized method)" << std::endl;
   *stream << "       -v v  : output filename of double type (string)[" << std::setw(5) << std::right << "N/A"                         << "]" << std::endl;  // NOLINT
   *stream << "               eigenvalues and proportions" << std::endl;
   *stream << "       -h    : print this message" << std::endl;
@@ -85,6 +91,11 @@ void PrintUsage(std::ostream* stream) {
  *     @arg @c 0 sample covariance
  *     @arg @c 1 unbiased covariance
  *     @arg @c 2 correlation
+ * - @b -s @e int
+ *   - eigenvalue decomposition
+ *     @arg @c 0 Jacobi method
+ *     @arg @c 1 Householder and QL method
+ *     @arg @c 2 randomized method
  * - @b -v @e str
  *   - double-type eigenvalues and proportions
  * - @b infile @e str
@@ -103,6 +114,16 @@ void PrintUsage(std::ostream* stream) {
  *
  * The eigenvalues are sorted in descending order.
  *
+ * The Jacobi method is accurate but slow for high-dimensional vectors. In such
+ * a case, the Householder and QL method (@c -s @c 1) is recommended. If only a
+ * few principal components are needed, the randomized method (@c -s @c 2)
+ * computes the @f$N@f$ largest eigenvalues only. The input vectors are not
+ * held in memory in any case.
+ *
+ * @code{.sh}
+ *   pca -l 1025 -n 20 -s 2 < spec.d > eigvec.dat
+ * @endcode
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -114,11 +135,13 @@ int main(int argc, char* argv[]) {
   double convergence_threshold(kDefaultConvergenceThreshold);
   sptk::PrincipalComponentAnalysis::CovarianceType covariance_type(
       kDefaultCovarianceType);
+  sptk::PrincipalComponentAnalysis::EigensolverType eigensolver_type(
+      kDefaultEigensolverType);
   const char* eigenvalues_file(NULL);
 
   for (;;) {
     const int option_char(
-        getopt_long(argc, argv, "l:m:n:i:d:u:v:h", NULL, NULL));
+        getopt_long(argc, argv, "l:m:n:i:d:u:s:v:h", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -197,6 +220,25 @@ int main(int argc, char* argv[]) {
             static_cast<sptk::PrincipalComponentAnalysis::CovarianceType>(tmp);
         break;
       }
+      case 's': {
+        const int min(0);
+        const int max(
+            static_cast<int>(sptk::PrincipalComponentAnalysis::EigensolverType::
+                                 kNumEigensolverTypes) -
+            1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -s option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("pca", error_message);
+          return 1;
+        }
+        eigensolver_type =
+            static_cast<sptk::PrincipalComponentAnalysis::EigensolverType>(tmp);
+        break;
+      }
       case 'v': {
         eigenvalues_file = optarg;
         break;
@@ -254,7 +296,8 @@ int main(int argc, char* argv[]) {
   std::ostream& output_stream(ofs);
 
   sptk::PrincipalComponentAnalysis principal_component_analysis(
-      vector_length - 1, num_iteration, convergence_threshold, covariance_type);
+      vector_length - 1, num_iteration, convergence_threshold, covariance_type,
+      eigensolver_type, num_principal_component);
   sptk::PrincipalComponentAnalysis::Buffer buffer;
   if (!principal_component_analysis.IsValid()) {
     std::ostringstream error_message;
@@ -263,23 +306,28 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  // Read input data.
-  std::vector<std::vector<double> > input_vectors;
+  // Accumulate statistics of input data.
+  int num_input_vector(0);
   {
     std::vector<double> tmp(vector_length);
     while (sptk::ReadStream(false, 0, 0, vector_length, &tmp, &input_stream,
                             NULL)) {
-      input_vectors.push_back(tmp);
+      if (!principal_component_analysis.Accumulate(tmp, &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to accumulate statistics";
+        sptk::PrintErrorMessage("pca", error_message);
+        return 1;
+      }
+      ++num_input_vector;
     }
   }
-  if (input_vectors.empty()) return 0;
+  if (0 == num_input_vector) return 0;
 
   std::vector<double> mean_vector(vector_length);
   std::vector<double> eigenvalues(vector_length);
   sptk::Matrix eigenvector_matrix(vector_length, vector_length);
-  if (!principal_component_analysis.Run(input_vectors, &mean_vector,
-                                        &eigenvalues, &eigenvector_matrix,
-                                        &buffer)) {
+  if (!principal_component_analysis.Run(&mean_vector, &eigenvalues,
+                                        &eigenvector_matrix, &buffer)) {
     std::ostringstream error_message;
     error_message << "Failed to perform principal component analysis";
     sptk::PrintErrorMessage("pca", error_message);
@@ -0,0 +1,1739 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include <poll.h>        // poll, pollfd
+#include <pthread.h>     // pthread_sigmask
+#include <sys/select.h>  // fd_set, FD_SET, FD_ZERO, pselect
+#include <sys/socket.h>  // accept, bind, connect, listen, recv, send, etc.
+#include <sys/stat.h>    // S_ISSOCK, lstat
+#include <sys/un.h>      // sockaddr_un
+#include <unistd.h>      // close, unlink
+
+#include <algorithm>           // std::min
+#include <atomic>              // std::atomic
+#include <chrono>              // std::chrono::seconds, etc.
+#include <cerrno>              // errno
+#include <cfloat>              // DBL_MAX
+#include <condition_variable>  // std::condition_variable
+#include <csignal>             // SIGINT, SIGTERM, sig_atomic_t, sigaction, etc.
+#include <cstring>             // std::memcpy, std::memset, std::strlen, etc.
+#include <fstream>             // std::ifstream
+#include <iomanip>             // std::setw
+#include <iostream>            // std::cerr, std::cin, std::cout, etc.
+#include <limits>              // std::numeric_limits
+#include <list>                // std::list
+#include <map>                 // std::map
+#include <memory>              // std::shared_ptr
+#include <mutex>               // std::mutex
+#include <queue>               // std::queue
+#include <sstream>             // std::ostringstream
+#include <streambuf>           // std::streambuf
+#include <string>              // std::string
+#include <thread>              // std::thread
+#include <utility>             // std::pair
+#include <vector>              // std::vector
+
+#include "Getopt/getoptwin.h"
+#include "SPTK/analysis/mel_generalized_cepstral_analysis.h"
+#include "SPTK/conversion/generalized_cepstrum_gain_normalization.h"
+#include "SPTK/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.h"
+#include "SPTK/conversion/spectrum_to_spectrum.h"
+#include "SPTK/conversion/waveform_to_spectrum.h"
+#include "SPTK/generation/delta_calculation.h"
+#include "SPTK/input/input_source_framing.h"
+#include "SPTK/input/input_source_from_stream.h"
+#include "SPTK/input/input_source_interface.h"
+#include "SPTK/input/input_source_prefetching.h"
+#include "SPTK/math/scalar_operation.h"
+#include "SPTK/utils/misc_utils.h"
+#include "SPTK/utils/sptk_utils.h"
+#include "SPTK/window/data_windowing.h"
+#include "SPTK/window/standard_window.h"
+
+namespace {
+
+const int kDefaultQueueLength(64);
+const int kDefaultNumThread(4);
+const int kDefaultMaxNumCachedStage(64);
+const int kDefaultMaxRequestSizeInMegabytes(64);
+const int kDefaultTimeoutInSeconds(10);
+const int kBufferSize(65536);
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " pipeline - run a pipeline of stages in a single process" << std::endl;  // NOLINT
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       pipeline [ options ] description [ infile ] > stdout" << std::endl;  // NOLINT
+  *stream << "       pipeline -s s [ -t t ] [ -C C ] [ -M M ] [ -T T ]" << std::endl;  // NOLINT
+  *stream << "  options:" << std::endl;
+  *stream << "       -q q  : number of frames buffered (   int)[" << std::setw(5) << std::right << kDefaultQueueLength << "][ 0 <= q <=   ]" << std::endl;  // NOLINT
+  *stream << "               between stages" << std::endl;
+  *stream << "       -c c  : send request to server    (string)[" << std::setw(5) << std::right << "N/A"               << "]" << std::endl;  // NOLINT
+  *stream << "               listening on socket c" << std::endl;
+  *stream << "       -s s  : run as server listening   (string)[" << std::setw(5) << std::right << "N/A"               << "]" << std::endl;  // NOLINT
+  *stream << "               on socket s" << std::endl;
+  *stream << "       -t t  : number of threads of      (   int)[" << std::setw(5) << std::right << kDefaultNumThread   << "][ 1 <= t <=   ]" << std::endl;  // NOLINT
+  *stream << "               server" << std::endl;
+  *stream << "       -C C  : maximum number of stages  (   int)[" << std::setw(5) << std::right << kDefaultMaxNumCachedStage        << "][ 1 <= C <=   ]" << std::endl;  // NOLINT
+  *stream << "               kept by server" << std::endl;
+  *stream << "       -M M  : maximum size of request   (   int)[" << std::setw(5) << std::right << kDefaultMaxRequestSizeInMegabytes << "][ 1 <= M <=   ]" << std::endl;  // NOLINT
+  *stream << "               to server in megabytes" << std::endl;
+  *stream << "       -T T  : timeout of server in      (   int)[" << std::setw(5) << std::right << kDefaultTimeoutInSeconds          << "][ 1 <= T <=   ]" << std::endl;  // NOLINT
+  *stream << "               seconds" << std::endl;
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << "  description:" << std::endl;
+  *stream << "       stages separated by |               (string)" << std::endl;  // NOLINT
+  *stream << "  stages:" << std::endl;
+  *stream << "       frame  [ -l -p -n ]" << std::endl;
+  *stream << "       window [ -l -L -n -w ]" << std::endl;
+  *stream << "       spec   [ -l -o -e -E ]" << std::endl;
+  *stream << "       mgcep  [ -m -a -g -c -l -o -i -d -w -e -E ]" << std::endl;
+  *stream << "       delta  [ -l -m -d -r ]" << std::endl;
+  *stream << "       sopr   [ -a -s -m -d -r -p -l -u -ABS -INV -SQR -SQRT -LN" << std::endl;  // NOLINT
+  *stream << "                -LOG2 -LOG10 -LOGX -EXP -POW2 -POW10 -POWX -FLOOR" << std::endl;  // NOLINT
+  *stream << "                -CEIL -ROUND -ROUNDUP -ROUNDDOWN -UNIT -SIGN -SIN" << std::endl;  // NOLINT
+  *stream << "                -COS -TAN -ATAN -TANH -ATANH ]" << std::endl;
+  *stream << "  infile:" << std::endl;
+  *stream << "       input sequence                      (double)[stdin]" << std::endl;  // NOLINT
+  *stream << "  stdout:" << std::endl;
+  *stream << "       output sequence                     (double)" << std::endl;  // NOLINT
+  *stream << "  notice:" << std::endl;
+  *stream << "       options of each stage are the same as those of the command" << std::endl;  // NOLINT
+  *stream << "       if q = 0, all stages run in the main thread" << std::endl;  // NOLINT
+  *stream << "       server keeps stages and processes requests in parallel" << std::endl;  // NOLINT
+  *stream << "       server stops by SIGINT or SIGTERM and removes socket" << std::endl;  // NOLINT
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+// Option of stage, e.g., "-d -0.5 0 0.5" is {"d", {"-0.5", "0", "0.5"}}.
+typedef std::pair<std::string, std::vector<std::string> > Option;
+
+struct StageDescription {
+  std::string name;
+  std::vector<Option> options;
+};
+
+bool IsOptionName(const std::string& word) {
+  double tmp;
+  return 2 <= word.size() && '-' == word[0] &&
+         !sptk::ConvertStringToDouble(word, &tmp);
+}
+
+bool ParseDescription(const std::string& description,
+                      std::vector<StageDescription>* stages) {
+  std::istringstream stream_for_stages(description);
+  std::string stage_string;
+  while (std::getline(stream_for_stages, stage_string, '|')) {
+    StageDescription stage;
+    std::istringstream stream_for_words(stage_string);
+    std::string word;
+    if (!(stream_for_words >> stage.name) || IsOptionName(stage.name)) {
+      return false;
+    }
+    while (stream_for_words >> word) {
+      if (IsOptionName(word)) {
+        stage.options.push_back(Option(word.substr(1), {}));
+      } else if (stage.options.empty()) {
+        return false;
+      } else {
+        stage.options.back().second.push_back(word);
+      }
+    }
+    stages->push_back(stage);
+  }
+  return !stages->empty();
+}
+
+bool GetFlag(const Option& option) {
+  return option.second.empty();
+}
+
+bool GetInteger(const Option& option, int* value) {
+  return 1 == option.second.size() &&
+         sptk::ConvertStringToInteger(option.second[0], value);
+}
+
+bool GetDouble(const Option& option, double* value) {
+  return 1 == option.second.size() &&
+         (sptk::ConvertSpecialStringToDouble(option.second[0], value) ||
+          sptk::ConvertStringToDouble(option.second[0], value));
+}
+
+void PrintInvalidOption(const StageDescription& stage, const Option& option) {
+  std::ostringstream error_message;
+  error_message << "Invalid option -" << option.first << " of " << stage.name;
+  sptk::PrintErrorMessage("pipeline", error_message);
+}
+
+// Stage of pipeline. The object of this class holds the parameters and the
+// objects which are expensive to construct, and is shared by all requests.
+class StageInterface {
+ public:
+  virtual ~StageInterface() {
+  }
+
+  // Return the length of input data. Zero means arbitrary length.
+  virtual int GetInputLength() const = 0;
+
+  virtual bool IsValid() const = 0;
+
+  // Create a node reading the given source. The node refers to this object.
+  virtual sptk::InputSourceInterface* Connect(
+      sptk::InputSourceInterface* source) const = 0;
+};
+
+class FramingStage : public StageInterface {
+ public:
+  FramingStage(int frame_length, int frame_period, bool center)
+      : frame_length_(frame_length),
+        frame_period_(frame_period),
+        center_(center) {
+  }
+
+  virtual int GetInputLength() const {
+    return 1;
+  }
+
+  virtual bool IsValid() const {
+    return true;
+  }
+
+  virtual sptk::InputSourceInterface* Connect(
+      sptk::InputSourceInterface* source) const {
+    return new sptk::InputSourceFraming(frame_length_, frame_period_, center_,
+                                        source);
+  }
+
+ private:
+  const int frame_length_;
+  const int frame_period_;
+  const bool center_;
+
+  DISALLOW_COPY_AND_ASSIGN(FramingStage);
+};
+
+class WindowingNode : public sptk::InputSourceInterface {
+ public:
+  WindowingNode(const sptk::DataWindowing* data_windowing, int output_length,
+                sptk::InputSourceInterface* source)
+      : data_windowing_(data_windowing),
+        output_length_(output_length),
+        source_(source),
+        is_failed_(false) {
+  }
+
+  virtual int GetSize() const {
+    return output_length_;
+  }
+
+  virtual bool IsValid() const {
+    return true;
+  }
+
+  virtual bool Get(std::vector<double>* buffer) {
+    if (!source_->Get(&data_)) {
+      return false;
+    }
+    if (!data_windowing_->Run(data_, buffer)) {
+      is_failed_ = true;
+      return false;
+    }
+    return true;
+  }
+
+  virtual bool IsFailed() const {
+    return is_failed_ || source_->IsFailed();
+  }
+
+ private:
+  const sptk::DataWindowing* data_windowing_;
+  const int output_length_;
+  sptk::InputSourceInterface* source_;
+  std::vector<double> data_;
+  std::atomic<bool> is_failed_;
+
+  DISALLOW_COPY_AND_ASSIGN(WindowingNode);
+};
+
+class WindowingStage : public StageInterface {
+ public:
+  WindowingStage(int input_length, int output_length,
+                 sptk::StandardWindow::WindowType window_type,
+                 sptk::DataWindowing::NormalizationType normalization_type)
+      : input_length_(input_length),
+        output_length_(output_length),
+        window_(input_length, window_type, false),
+        data_windowing_(&window_, output_length, normalization_type) {
+  }
+
+  virtual int GetInputLength() const {
+    return input_length_;
+  }
+
+  virtual bool IsValid() const {
+    return data_windowing_.IsValid();
+  }
+
+  virtual sptk::InputSourceInterface* Connect(
+      sptk::InputSourceInterface* source) const {
+    return new WindowingNode(&data_windowing_, output_length_, source);
+  }
+
+ private:
+  const int input_length_;
+  const int output_length_;
+  sptk::StandardWindow window_;
+  const sptk::DataWindowing data_windowing_;
+
+  DISALLOW_COPY_AND_ASSIGN(WindowingStage);
+};
+
+class SpectrumNode : public sptk::InputSourceInterface {
+ public:
+  SpectrumNode(const sptk::WaveformToSpectrum* waveform_to_spectrum,
+               int output_length, sptk::InputSourceInterface* source)
+      : waveform_to_spectrum_(waveform_to_spectrum),
+        output_length_(output_length),
+        source_(source),
+        is_failed_(false) {
+  }
+
+  virtual int GetSize() const {
+    return output_length_;
+  }
+
+  virtual bool IsValid() const {
+    return true;
+  }
+
+  virtual bool Get(std::vector<double>* buffer) {
+    if (!source_->Get(&waveform_)) {
+      return false;
+    }
+    if (!waveform_to_spectrum_->Run(waveform_, buffer, &buffer_)) {
+      is_failed_ = true;
+      return false;
+    }
+    return true;
+  }
+
+  virtual bool IsFailed() const {
+    return is_failed_ || source_->IsFailed();
+  }
+
+ private:
+  const sptk::WaveformToSpectrum* waveform_to_spectrum_;
+  const int output_length_;
+  sptk::InputSourceInterface* source_;
+  std::vector<double> waveform_;
+  sptk::WaveformToSpectrum::Buffer buffer_;
+  std::atomic<bool> is_failed_;
+
+  DISALLOW_COPY_AND_ASSIGN(SpectrumNode);
+};
+
+class SpectrumStage : public StageInterface {
+ public:
+  SpectrumStage(int fft_length,
+                sptk::SpectrumToSpectrum::InputOutputFormats output_format,
+                double epsilon, double relative_floor_in_decibels)
+      : fft_length_(fft_length),
+        waveform_to_spectrum_(fft_length, fft_length, output_format, epsilon,
+                              relative_floor_in_decibels) {
+  }
+
+  virtual int GetInputLength() const {
+    return fft_length_;
+  }
+
+  virtual bool IsValid() const {
+    return waveform_to_spectrum_.IsValid();
+  }
+
+  virtual sptk::InputSourceInterface* Connect(
+      sptk::InputSourceInterface* source) const {
+    return new SpectrumNode(&waveform_to_spectrum_, fft_length_ / 2 + 1,
+                            source);
+  }
+
+ private:
+  const int fft_length_;
+  const sptk::WaveformToSpectrum waveform_to_spectrum_;
+
+  DISALLOW_COPY_AND_ASSIGN(SpectrumStage);
+};
+
+class MelGeneralizedCepstralAnalysisStage : public StageInterface {
+ public:
+  class Buffer {
+   public:
+    Buffer() {
+    }
+
+    virtual ~Buffer() {
+    }
+
+   private:
+    std::vector<double> periodogram_;
+    sptk::WaveformToSpectrum::Buffer buffer_for_spectral_analysis_;
+    sptk::MelGeneralizedCepstralAnalysis::Buffer buffer_for_cepstral_analysis_;
+
+    friend class MelGeneralizedCepstralAnalysisStage;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
+  MelGeneralizedCepstralAnalysisStage(int fft_length, int num_order,
+                                      double alpha, double gamma,
+                                      int num_iteration,
+                                      double convergence_threshold,
+                                      bool warm_start, bool mlsa_filter_output,
+                                      bool gain_normalized_output,
+                                      double epsilon,
+                                      double relative_floor_in_decibels)
+      : fft_length_(fft_length),
+        mlsa_filter_output_(mlsa_filter_output && 0.0 != alpha),
+        gain_normalized_output_(gain_normalized_output),
+        waveform_to_spectrum_(
+            fft_length, fft_length,
+            sptk::SpectrumToSpectrum::InputOutputFormats::kPowerSpectrum,
+            epsilon, relative_floor_in_decibels),
+        analysis_(fft_length, num_order, alpha, gamma, num_iteration,
+                  convergence_threshold, warm_start),
+        mel_cepstrum_to_mlsa_digital_filter_coefficients_(num_order, alpha),
+        generalized_cepstrum_gain_normalization_(num_order, gamma) {
+  }
+
+  virtual int GetInputLength() const {
+    return fft_length_;
+  }
+
+  virtual bool IsValid() const {
+    return waveform_to_spectrum_.IsValid() && analysis_.IsValid() &&
+           mel_cepstrum_to_mlsa_digital_filter_coefficients_.IsValid() &&
+           generalized_cepstrum_gain_normalization_.IsValid();
+  }
+
+  virtual sptk::InputSourceInterface* Connect(
+      sptk::InputSourceInterface* source) const;
+
+  int GetOutputLength() const {
+    return analysis_.GetNumOrder() + 1;
+  }
+
+  bool Run(const std::vector<double>& waveform, std::vector<double>* output,
+           Buffer* buffer) const {
+    if (!waveform_to_spectrum_.Run(waveform, &buffer->periodogram_,
+                                   &buffer->buffer_for_spectral_analysis_) ||
+        !analysis_.Run(buffer->periodogram_, output,
+                       &buffer->buffer_for_cepstral_analysis_)) {
+      return false;
+    }
+    if (mlsa_filter_output_ &&
+        !mel_cepstrum_to_mlsa_digital_filter_coefficients_.Run(output)) {
+      return false;
+    }
+    if (gain_normalized_output_ &&
+        !generalized_cepstrum_gain_normalization_.Run(output)) {
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  const int fft_length_;
+  const bool mlsa_filter_output_;
+  const bool gain_normalized_output_;
+  const sptk::WaveformToSpectrum waveform_to_spectrum_;
+  const sptk::MelGeneralizedCepstralAnalysis analysis_;
+  const sptk::MelCepstrumToMlsaDigitalFilterCoefficients
+      mel_cepstrum_to_mlsa_digital_filter_coefficients_;
+  const sptk::GeneralizedCepstrumGainNormalization
+      generalized_cepstrum_gain_normalization_;
+
+  DISALLOW_COPY_AND_ASSIGN(MelGeneralizedCepstralAnalysisStage);
+};
+
+class MelGeneralizedCepstralAnalysisNode : public sptk::InputSourceInterface {
+ public:
+  MelGeneralizedCepstralAnalysisNode(
+      const MelGeneralizedCepstralAnalysisStage* stage,
+      sptk::InputSourceInterface* source)
+      : stage_(stage), source_(source), is_failed_(false) {
+  }
+
+  virtual int GetSize() const {
+    return stage_->GetOutputLength();
+  }
+
+  virtual bool IsValid() const {
+    return true;
+  }
+
+  virtual bool Get(std::vector<double>* buffer) {
+    if (!source_->Get(&waveform_)) {
+      return false;
+    }
+    if (!stage_->Run(waveform_, buffer, &buffer_)) {
+      is_failed_ = true;
+      return false;
+    }
+    return true;
+  }
+
+  virtual bool IsFailed() const {
+    return is_failed_ || source_->IsFailed();
+  }
+
+ private:
+  const MelGeneralizedCepstralAnalysisStage* stage_;
+  sptk::InputSourceInterface* source_;
+  std::vector<double> waveform_;
+  MelGeneralizedCepstralAnalysisStage::Buffer buffer_;
+  std::atomic<bool> is_failed_;
+
+  DISALLOW_COPY_AND_ASSIGN(MelGeneralizedCepstralAnalysisNode);
+};
+
+sptk::InputSourceInterface* MelGeneralizedCepstralAnalysisStage::Connect(
+    sptk::InputSourceInterface* source) const {
+  return new MelGeneralizedCepstralAnalysisNode(this, source);
+}
+
+class DeltaStage : public StageInterface {
+ public:
+  DeltaStage(int num_order,
+             const std::vector<std::vector<double> >& window_coefficients)
+      : num_order_(num_order), window_coefficients_(window_coefficients) {
+  }
+
+  virtual int GetInputLength() const {
+    return num_order_ + 1;
+  }
+
+  virtual bool IsValid() const {
+    return true;
+  }
+
+  virtual sptk::InputSourceInterface* Connect(
+      sptk::InputSourceInterface* source) const {
+    return new sptk::DeltaCalculation(num_order_, window_coefficients_, source,
+                                      false);
+  }
+
+ private:
+  const int num_order_;
+  const std::vector<std::vector<double> > window_coefficients_;
+
+  DISALLOW_COPY_AND_ASSIGN(DeltaStage);
+};
+
+class ScalarOperationNode : public sptk::InputSourceInterface {
+ public:
+  ScalarOperationNode(const sptk::ScalarOperation* scalar_operation,
+                      sptk::InputSourceInterface* source)
+      : scalar_operation_(scalar_operation),
+        source_(source),
+        is_failed_(false) {
+  }
+
+  virtual int GetSize() const {
+    return source_->GetSize();
+  }
+
+  virtual bool IsValid() const {
+    return true;
+  }
+
+  virtual bool Get(std::vector<double>* buffer) {
+    if (!source_->Get(buffer)) {
+      return false;
+    }
+    if (!scalar_operation_->Run(buffer, &is_magic_numbers_)) {
+      is_failed_ = true;
+      return false;
+    }
+    return true;
+  }
+
+  virtual bool IsFailed() const {
+    return is_failed_ || source_->IsFailed();
+  }
+
+ private:
+  const sptk::ScalarOperation* scalar_operation_;
+  sptk::InputSourceInterface* source_;
+  std::vector<bool> is_magic_numbers_;
+  std::atomic<bool> is_failed_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScalarOperationNode);
+};
+
+class ScalarOperationStage : public StageInterface {
+ public:
+  ScalarOperationStage() {
+  }
+
+  sptk::ScalarOperation* GetScalarOperation() {
+    return &scalar_operation_;
+  }
+
+  virtual int GetInputLength() const {
+    return 0;
+  }
+
+  virtual bool IsValid() const {
+    return true;
+  }
+
+  virtual sptk::InputSourceInterface* Connect(
+      sptk::InputSourceInterface* source) const {
+    return new ScalarOperationNode(&scalar_operation_, source);
+  }
+
+ private:
+  sptk::ScalarOperation scalar_operation_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScalarOperationStage);
+};
+
+StageInterface* CreateFramingStage(const StageDescription& stage) {
+  int frame_length(256);
+  int frame_period(100);
+  int framing_type(0);
+  for (std::vector<Option>::const_iterator option(stage.options.begin());
+       option != stage.options.end(); ++option) {
+    if (("l" == option->first && GetInteger(*option, &frame_length) &&
+         0 < frame_length) ||
+        ("p" == option->first && GetInteger(*option, &frame_period) &&
+         0 < frame_period) ||
+        ("n" == option->first && GetInteger(*option, &framing_type) &&
+         sptk::IsInRange(framing_type, 0, 1))) {
+      continue;
+    }
+    PrintInvalidOption(stage, *option);
+    return NULL;
+  }
+  return new FramingStage(frame_length, frame_period, 0 == framing_type);
+}
+
+StageInterface* CreateWindowingStage(const StageDescription& stage) {
+  const sptk::StandardWindow::WindowType window_types[] = {
+      sptk::StandardWindow::kBlackman,    sptk::StandardWindow::kHamming,
+      sptk::StandardWindow::kHanning,     sptk::StandardWindow::kBartlett,
+      sptk::StandardWindow::kTrapezoidal, sptk::StandardWindow::kRectangular,
+  };
+  int input_length(256);
+  int output_length(0);
+  int normalization_type(sptk::DataWindowing::NormalizationType::kPower);
+  int window_type(0);
+  for (std::vector<Option>::const_iterator option(stage.options.begin());
+       option != stage.options.end(); ++option) {
+    if (("l" == option->first && GetInteger(*option, &input_length) &&
+         0 < input_length) ||
+        ("L" == option->first && GetInteger(*option, &output_length) &&
+         0 < output_length) ||
+        ("n" == option->first && GetInteger(*option, &normalization_type) &&
+         sptk::IsInRange(normalization_type, 0, 2)) ||
+        ("w" == option->first && GetInteger(*option, &window_type) &&
+         sptk::IsInRange(window_type, 0, 5))) {
+      continue;
+    }
+    PrintInvalidOption(stage, *option);
+    return NULL;
+  }
+  if (0 == output_length) {
+    output_length = input_length;
+  }
+  return new WindowingStage(
+      input_length, output_length, window_types[window_type],
+      static_cast<sptk::DataWindowing::NormalizationType>(normalization_type));
+}
+
+StageInterface* CreateSpectrumStage(const StageDescription& stage) {
+  int fft_length(256);
+  int output_format(
+      sptk::SpectrumToSpectrum::kLogAmplitudeSpectrumInDecibels);
+  double epsilon(0.0);
+  double relative_floor_in_decibels(-DBL_MAX);
+  for (std::vector<Option>::const_iterator option(stage.options.begin());
+       option != stage.options.end(); ++option) {
+    if (("l" == option->first && GetInteger(*option, &fft_length)) ||
+        ("o" == option->first && GetInteger(*option, &output_format) &&
+         sptk::IsInRange(output_format, 0, 3)) ||
+        ("e" == option->first && GetDouble(*option, &epsilon) &&
+         0.0 < epsilon) ||
+        ("E" == option->first &&
+         GetDouble(*option, &relative_floor_in_decibels) &&
+         relative_floor_in_decibels < 0.0)) {
+      continue;
+    }
+    PrintInvalidOption(stage, *option);
+    return NULL;
+  }
+  return new SpectrumStage(
+      fft_length,
+      static_cast<sptk::SpectrumToSpectrum::InputOutputFormats>(output_format),
+      epsilon, relative_floor_in_decibels);
+}
+
+StageInterface* CreateMelGeneralizedCepstralAnalysisStage(
+    const StageDescription& stage) {
+  int num_order(25);
+  double alpha(0.35);
+  double gamma(0.0);
+  int fft_length(256);
+  int output_format(0);
+  int num_iteration(30);
+  double convergence_threshold(1e-3);
+  bool warm_start(false);
+  double epsilon(0.0);
+  double relative_floor_in_decibels(-DBL_MAX);
+  for (std::vector<Option>::const_iterator option(stage.options.begin());
+       option != stage.options.end(); ++option) {
+    int num_stage;
+    if ("c" == option->first && GetInteger(*option, &num_stage) &&
+        0 <= num_stage) {
+      gamma = (0 == num_stage) ? 0.0 : -1.0 / num_stage;
+      continue;
+    }
+    if ("w" == option->first && GetFlag(*option)) {
+      warm_start = true;
+      continue;
+    }
+    if (("m" == option->first && GetInteger(*option, &num_order) &&
+         0 <= num_order) ||
+        ("a" == option->first && GetDouble(*option, &alpha) &&
+         sptk::IsValidAlpha(alpha)) ||
+        ("g" == option->first && GetDouble(*option, &gamma) &&
+         sptk::IsValidGamma(gamma)) ||
+        ("l" == option->first && GetInteger(*option, &fft_length)) ||
+        ("o" == option->first && GetInteger(*option, &output_format) &&
+         sptk::IsInRange(output_format, 0, 3)) ||
+        ("i" == option->first && GetInteger(*option, &num_iteration) &&
+         0 < num_iteration) ||
+        ("d" == option->first && GetDouble(*option, &convergence_threshold) &&
+         0.0 <= convergence_threshold) ||
+        ("e" == option->first && GetDouble(*option, &epsilon) &&
+         0.0 < epsilon) ||
+        ("E" == option->first &&
+         GetDouble(*option, &relative_floor_in_decibels) &&
+         relative_floor_in_decibels < 0.0)) {
+      continue;
+    }
+    PrintInvalidOption(stage, *option);
+    return NULL;
+  }
+  // The output formats are cepstrum, MLSA filter coefficients, and their
+  // gain normalized versions.
+  return new MelGeneralizedCepstralAnalysisStage(
+      fft_length, num_order, alpha, gamma, num_iteration,
+      convergence_threshold, warm_start, 1 == output_format % 2,
+      2 <= output_format, epsilon, relative_floor_in_decibels);
+}
+
+StageInterface* CreateDeltaStage(const StageDescription& stage) {
+  int num_order(24);
+  std::vector<std::vector<double> > window_coefficients(
+      1, std::vector<double>(1, 1.0));
+  for (std::vector<Option>::const_iterator option(stage.options.begin());
+       option != stage.options.end(); ++option) {
+    if ("l" == option->first && GetInteger(*option, &num_order) &&
+        0 < num_order) {
+      --num_order;
+      continue;
+    }
+    if ("m" == option->first && GetInteger(*option, &num_order) &&
+        0 <= num_order) {
+      continue;
+    }
+    if ("d" == option->first && !option->second.empty()) {
+      std::vector<double> coefficients(option->second.size());
+      bool is_valid(true);
+      for (std::size_t i(0); i < coefficients.size(); ++i) {
+        is_valid = is_valid && sptk::ConvertStringToDouble(option->second[i],
+                                                           &coefficients[i]);
+      }
+      if (is_valid) {
+        window_coefficients.push_back(coefficients);
+        continue;
+      }
+    }
+    if ("r" == option->first && sptk::IsInRange(
+                                    static_cast<int>(option->second.size()),
+                                    1, 2)) {
+      int n;
+      std::vector<double> coefficients;
+      if (sptk::ConvertStringToInteger(option->second[0], &n) &&
+          sptk::ComputeFirstOrderRegressionCoefficients(n, &coefficients)) {
+        window_coefficients.push_back(coefficients);
+        if (1 == option->second.size()) {
+          continue;
+        }
+        if (sptk::ConvertStringToInteger(option->second[1], &n) &&
+            sptk::ComputeSecondOrderRegressionCoefficients(n,
+                                                           &coefficients)) {
+          window_coefficients.push_back(coefficients);
+          continue;
+        }
+      }
+    }
+    PrintInvalidOption(stage, *option);
+    return NULL;
+  }
+  return new DeltaStage(num_order, window_coefficients);
+}
+
+bool AddScalarOperation(const Option& option,
+                        sptk::ScalarOperation* scalar_operation) {
+  const std::string& name(option.first);
+  double x;
+  if (GetFlag(option)) {
+    if ("ABS" == name) return scalar_operation->AddAbsoluteOperation();
+    if ("INV" == name) return scalar_operation->AddReciprocalOperation();
+    if ("SQR" == name) return scalar_operation->AddSquareOperation();
+    if ("SQRT" == name) return scalar_operation->AddSquareRootOperation();
+    if ("LN" == name) return scalar_operation->AddNaturalLogarithmOperation();
+    if ("LOG2" == name) return scalar_operation->AddLogarithmOperation(2.0);
+    if ("LOG10" == name) return scalar_operation->AddLogarithmOperation(10.0);
+    if ("EXP" == name) {
+      return scalar_operation->AddNaturalExponentialOperation();
+    }
+    if ("POW2" == name) return scalar_operation->AddExponentialOperation(2.0);
+    if ("POW10" == name) {
+      return scalar_operation->AddExponentialOperation(10.0);
+    }
+    if ("FLOOR" == name) return scalar_operation->AddFlooringOperation();
+    if ("CEIL" == name) return scalar_operation->AddCeilingOperation();
+    if ("ROUND" == name) return scalar_operation->AddRoundingOperation();
+    if ("ROUNDUP" == name) return scalar_operation->AddRoundingUpOperation();
+    if ("ROUNDDOWN" == name) {
+      return scalar_operation->AddRoundingDownOperation();
+    }
+    if ("UNIT" == name) return scalar_operation->AddUnitStepOperation();
+    if ("SIGN" == name) return scalar_operation->AddSignOperation();
+    if ("SIN" == name) return scalar_operation->AddSineOperation();
+    if ("COS" == name) return scalar_operation->AddCosineOperation();
+    if ("TAN" == name) return scalar_operation->AddTangentOperation();
+    if ("ATAN" == name) return scalar_operation->AddArctangentOperation();
+    if ("TANH" == name) {
+      return scalar_operation->AddHyperbolicTangentOperation();
+    }
+    if ("ATANH" == name) {
+      return scalar_operation->AddHyperbolicArctangentOperation();
+    }
+  } else if (GetDouble(option, &x)) {
+    if ("a" == name) return scalar_operation->AddAdditionOperation(x);
+    if ("s" == name) return scalar_operation->AddSubtractionOperation(x);
+    if ("m" == name) return scalar_operation->AddMultiplicationOperation(x);
+    if ("d" == name) return scalar_operation->AddDivisionOperation(x);
+    if ("r" == name) return scalar_operation->AddModuloOperation(x);
+    if ("p" == name) return scalar_operation->AddPowerOperation(x);
+    if ("l" == name) return scalar_operation->AddLowerBoundingOperation(x);
+    if ("u" == name) return scalar_operation->AddUpperBoundingOperation(x);
+    if ("LOGX" == name) return scalar_operation->AddLogarithmOperation(x);
+    if ("POWX" == name) return scalar_operation->AddExponentialOperation(x);
+  }
+  return false;
+}
+
+StageInterface* CreateScalarOperationStage(const StageDescription& stage) {
+  ScalarOperationStage* scalar_operation_stage(new ScalarOperationStage());
+  for (std::vector<Option>::const_iterator option(stage.options.begin());
+       option != stage.options.end(); ++option) {
+    if (!AddScalarOperation(*option,
+                            scalar_operation_stage->GetScalarOperation())) {
+      PrintInvalidOption(stage, *option);
+      delete scalar_operation_stage;
+      return NULL;
+    }
+  }
+  return scalar_operation_stage;
+}
+
+StageInterface* CreateStage(const StageDescription& stage) {
+  StageInterface* created_stage;
+  if ("frame" == stage.name) {
+    created_stage = CreateFramingStage(stage);
+  } else if ("window" == stage.name) {
+    created_stage = CreateWindowingStage(stage);
+  } else if ("spec" == stage.name) {
+    created_stage = CreateSpectrumStage(stage);
+  } else if ("mgcep" == stage.name) {
+    created_stage = CreateMelGeneralizedCepstralAnalysisStage(stage);
+  } else if ("delta" == stage.name) {
+    created_stage = CreateDeltaStage(stage);
+  } else if ("sopr" == stage.name) {
+    created_stage = CreateScalarOperationStage(stage);
+  } else {
+    std::ostringstream error_message;
+    error_message << "Unknown stage " << stage.name;
+    sptk::PrintErrorMessage("pipeline", error_message);
+    return NULL;
+  }
+
+  if (NULL != created_stage && !created_stage->IsValid()) {
+    std::ostringstream error_message;
+    error_message << "Failed to initialize " << stage.name;
+    sptk::PrintErrorMessage("pipeline", error_message);
+    delete created_stage;
+    return NULL;
+  }
+  return created_stage;
+}
+
+// Cache of stages keyed by their descriptions. The stages are created at the
+// first request and reused by the following requests. If the number of stages
+// exceeds the limit, the least recently used one is removed from the cache. It
+// is deleted when the last request using it finishes.
+class StageCache {
+ public:
+  explicit StageCache(int max_num_stage) : max_num_stage_(max_num_stage) {
+  }
+
+  std::shared_ptr<const StageInterface> Get(const StageDescription& stage) {
+    std::string key(stage.name);
+    for (std::vector<Option>::const_iterator option(stage.options.begin());
+         option != stage.options.end(); ++option) {
+      key += " -" + option->first;
+      for (std::vector<std::string>::const_iterator value(
+               option->second.begin());
+           value != option->second.end(); ++value) {
+        key += " " + *value;
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, StageList::iterator>::iterator itr(
+        positions_.find(key));
+    if (positions_.end() != itr) {
+      stages_.splice(stages_.begin(), stages_, itr->second);
+      return itr->second->second;
+    }
+    StageInterface* created_stage(CreateStage(stage));
+    if (NULL == created_stage) {
+      return std::shared_ptr<const StageInterface>();
+    }
+    stages_.push_front(std::make_pair(
+        key, std::shared_ptr<const StageInterface>(created_stage)));
+    positions_[key] = stages_.begin();
+    if (max_num_stage_ < static_cast<int>(stages_.size())) {
+      positions_.erase(stages_.back().first);
+      stages_.pop_back();
+    }
+    return stages_.front().second;
+  }
+
+ private:
+  // Stages ordered from the most recently used one.
+  typedef std::list<
+      std::pair<std::string, std::shared_ptr<const StageInterface> > >
+      StageList;
+
+  const int max_num_stage_;
+  StageList stages_;
+  std::map<std::string, StageList::iterator> positions_;
+  std::mutex mutex_;
+
+  DISALLOW_COPY_AND_ASSIGN(StageCache);
+};
+
+void DeleteNodes(std::vector<sptk::InputSourceInterface*>* nodes) {
+  // Delete nodes from the last one so that the threads stop in order.
+  for (std::vector<sptk::InputSourceInterface*>::reverse_iterator itr(
+           nodes->rbegin());
+       itr != nodes->rend(); ++itr) {
+    delete *itr;
+  }
+  nodes->clear();
+}
+
+// Build a chain of nodes reading the stream and run it.
+bool RunPipeline(const std::string& description, int queue_length,
+                 StageCache* cache, std::istream* input_stream,
+                 std::ostream* output_stream) {
+  std::vector<StageDescription> stages;
+  if (!ParseDescription(description, &stages)) {
+    std::ostringstream error_message;
+    error_message << "Failed to parse description";
+    sptk::PrintErrorMessage("pipeline", error_message);
+    return false;
+  }
+
+  // The stages are held until the nodes referring to them are deleted.
+  std::vector<std::shared_ptr<const StageInterface> > used_stages;
+  std::vector<sptk::InputSourceInterface*> nodes;
+  std::vector<std::pair<std::string, sptk::InputSourceInterface*> >
+      stage_nodes;
+  for (std::vector<StageDescription>::const_iterator stage(stages.begin());
+       stage != stages.end(); ++stage) {
+    const std::shared_ptr<const StageInterface> cached_stage(
+        cache->Get(*stage));
+    if (!cached_stage) {
+      DeleteNodes(&nodes);
+      return false;
+    }
+
+    const int input_length(cached_stage->GetInputLength());
+    if (nodes.empty()) {
+      nodes.push_back(new sptk::InputSourceFromStream(
+          false, 0 == input_length ? 1 : input_length, input_stream));
+    } else if (0 != input_length && nodes.back()->GetSize() != input_length) {
+      std::ostringstream error_message;
+      error_message << "Input length of " << stage->name << " ("
+                    << input_length
+                    << ") is different from output length of previous stage ("
+                    << nodes.back()->GetSize() << ")";
+      sptk::PrintErrorMessage("pipeline", error_message);
+      DeleteNodes(&nodes);
+      return false;
+    }
+    nodes.push_back(cached_stage->Connect(nodes.back()));
+    used_stages.push_back(cached_stage);
+    stage_nodes.push_back(std::make_pair(stage->name, nodes.back()));
+
+    // Run the stage in a separate thread.
+    if (0 < queue_length) {
+      nodes.push_back(
+          new sptk::InputSourcePrefetching(queue_length, nodes.back()));
+    }
+  }
+
+  sptk::InputSourceInterface* output_source(nodes.back());
+  const int output_length(output_source->GetSize());
+  std::vector<double> output(output_length);
+  while (output_source->Get(&output)) {
+    if (!sptk::WriteStream(0, output_length, output, output_stream, NULL)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write output";
+      sptk::PrintErrorMessage("pipeline", error_message);
+      DeleteNodes(&nodes);
+      return false;
+    }
+  }
+
+  // Distinguish a failure of a stage from the end of input. The failure is
+  // reported by all the following nodes, so the first one is its origin.
+  if (output_source->IsFailed()) {
+    for (std::vector<std::pair<std::string, sptk::InputSourceInterface*> >::
+             const_iterator itr(stage_nodes.begin());
+         itr != stage_nodes.end(); ++itr) {
+      if (itr->second->IsFailed()) {
+        std::ostringstream error_message;
+        error_message << "Failed to run " << itr->first;
+        sptk::PrintErrorMessage("pipeline", error_message);
+        break;
+      }
+    }
+    DeleteNodes(&nodes);
+    return false;
+  }
+  DeleteNodes(&nodes);
+
+  return true;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+// Wait until the socket is ready for the given events. Fail if the deadline
+// passes. Clock::time_point::max() means no deadline.
+bool WaitForSocket(int socket_descriptor, short events,  // NOLINT
+                   const Clock::time_point& deadline) {
+  for (;;) {
+    int timeout_in_milliseconds(-1);
+    if (Clock::time_point::max() != deadline) {
+      const std::chrono::milliseconds::rep rest(
+          std::chrono::duration_cast<std::chrono::milliseconds>(deadline -
+                                                                Clock::now())
+              .count());
+      if (rest <= 0) {
+        return false;
+      }
+      timeout_in_milliseconds = static_cast<int>(std::min(
+          rest, static_cast<std::chrono::milliseconds::rep>(
+                    std::numeric_limits<int>::max())));
+    }
+    pollfd descriptor;
+    descriptor.fd = socket_descriptor;
+    descriptor.events = events;
+    descriptor.revents = 0;
+    const int num_ready(poll(&descriptor, 1, timeout_in_milliseconds));
+    if (num_ready < 0) {
+      if (EINTR == errno) continue;
+      return false;
+    }
+    return 0 < num_ready;
+  }
+}
+
+bool SendAll(int socket_descriptor, const char* data, std::size_t size,
+             const Clock::time_point& deadline) {
+  while (0 < size) {
+    if (!WaitForSocket(socket_descriptor, POLLOUT, deadline)) {
+      return false;
+    }
+    const ssize_t sent_size(
+        send(socket_descriptor, data, size, MSG_NOSIGNAL | MSG_DONTWAIT));
+    if (sent_size < 0) {
+      if (EINTR == errno || EAGAIN == errno || EWOULDBLOCK == errno) continue;
+      return false;
+    }
+    data += sent_size;
+    size -= sent_size;
+  }
+  return true;
+}
+
+// Receive exactly the given size of data. Fail if the peer shuts down before.
+bool ReceiveExactly(int socket_descriptor, char* data, std::size_t size,
+                    const Clock::time_point& deadline) {
+  while (0 < size) {
+    if (!WaitForSocket(socket_descriptor, POLLIN, deadline)) {
+      return false;
+    }
+    const ssize_t received_size(
+        recv(socket_descriptor, data, size, MSG_DONTWAIT));
+    if (received_size < 0) {
+      if (EINTR == errno || EAGAIN == errno || EWOULDBLOCK == errno) continue;
+      return false;
+    }
+    if (0 == received_size) {
+      return false;
+    }
+    data += received_size;
+    size -= received_size;
+  }
+  return true;
+}
+
+// Receive data until the peer shuts down. Fail if the data exceed max_size or
+// the deadline passes.
+bool ReceiveAll(int socket_descriptor, std::size_t max_size,
+                const Clock::time_point& deadline, std::string* data) {
+  char buffer[kBufferSize];
+  for (;;) {
+    if (!WaitForSocket(socket_descriptor, POLLIN, deadline)) {
+      return false;
+    }
+    const ssize_t received_size(
+        recv(socket_descriptor, buffer, sizeof(buffer), MSG_DONTWAIT));
+    if (received_size < 0) {
+      if (EINTR == errno || EAGAIN == errno || EWOULDBLOCK == errno) continue;
+      return false;
+    }
+    if (0 == received_size) {
+      return true;
+    }
+    if (max_size - data->size() < static_cast<std::size_t>(received_size)) {
+      return false;
+    }
+    data->append(buffer, received_size);
+  }
+}
+
+// Stream buffer reading data in memory without copying it.
+class MemoryInputBuffer : public std::streambuf {
+ public:
+  MemoryInputBuffer(const char* data, std::size_t size) {
+    char* begin(const_cast<char*>(data));
+    setg(begin, begin, begin + size);
+  }
+
+  virtual ~MemoryInputBuffer() {
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(MemoryInputBuffer);
+};
+
+// Stream buffer sending data to socket in chunks of at most kBufferSize bytes,
+// each of which is preceded by its size. Sending a chunk fails if the peer
+// does not receive it within the timeout.
+class SocketOutputBuffer : public std::streambuf {
+ public:
+  SocketOutputBuffer(int socket_descriptor, int timeout_in_seconds)
+      : socket_descriptor_(socket_descriptor),
+        timeout_in_seconds_(timeout_in_seconds),
+        buffer_(kBufferSize) {
+    setp(&(buffer_[0]), &(buffer_[0]) + buffer_.size());
+  }
+
+  virtual ~SocketOutputBuffer() {
+  }
+
+ protected:
+  virtual int_type overflow(int_type c) {
+    if (!SendChunk()) {
+      return traits_type::eof();
+    }
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+
+  virtual int sync() {
+    return SendChunk() ? 0 : -1;
+  }
+
+ private:
+  bool SendChunk() {
+    const int size(static_cast<int>(pptr() - pbase()));
+    if (0 == size) {
+      return true;
+    }
+    setp(pbase(), epptr());
+    const Clock::time_point deadline(
+        Clock::now() + std::chrono::seconds(timeout_in_seconds_));
+    return SendAll(socket_descriptor_, reinterpret_cast<const char*>(&size),
+                   sizeof(size), deadline) &&
+           SendAll(socket_descriptor_, pbase(), size, deadline);
+  }
+
+  const int socket_descriptor_;
+  const int timeout_in_seconds_;
+  std::vector<char> buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(SocketOutputBuffer);
+};
+
+bool SetSocketPath(const char* socket_path, sockaddr_un* address) {
+  if (sizeof(address->sun_path) <= std::strlen(socket_path)) {
+    std::ostringstream error_message;
+    error_message << "Too long socket path " << socket_path;
+    sptk::PrintErrorMessage("pipeline", error_message);
+    return false;
+  }
+  std::memset(address, 0, sizeof(*address));
+  address->sun_family = AF_UNIX;
+  std::strcpy(address->sun_path, socket_path);  // NOLINT
+  return true;
+}
+
+// Request: length of description (int), description, and input sequence.
+// Response: chunks of output sequence, each of which is preceded by its size
+// (int), zero (int), and status (int). The whole request must be received
+// within the timeout. The output is sent while the pipeline runs, so the
+// memory for the response does not depend on its size.
+void HandleRequest(int socket_descriptor, std::size_t max_request_size,
+                   int timeout_in_seconds, StageCache* cache) {
+  std::string request;
+  int description_length;
+  int status(1);
+  SocketOutputBuffer output_buffer(socket_descriptor, timeout_in_seconds);
+  std::ostream output_stream(&output_buffer);
+  if (!ReceiveAll(socket_descriptor, max_request_size,
+                  Clock::now() + std::chrono::seconds(timeout_in_seconds),
+                  &request)) {
+    std::ostringstream error_message;
+    error_message << "Failed to receive request within " << timeout_in_seconds
+                  << " seconds or request is too large";
+    sptk::PrintErrorMessage("pipeline", error_message);
+  } else if (sizeof(description_length) <= request.size()) {
+    std::memcpy(&description_length, request.data(),
+                sizeof(description_length));
+    if (0 <= description_length &&
+        static_cast<std::size_t>(description_length) <=
+            request.size() - sizeof(description_length)) {
+      const char* description(request.data() + sizeof(description_length));
+      const char* input(description + description_length);
+      MemoryInputBuffer input_buffer(
+          input, request.data() + request.size() - input);
+      std::istream input_stream(&input_buffer);
+      // The requests are already processed in parallel.
+      if (RunPipeline(std::string(description, description_length), 0, cache,
+                      &input_stream, &output_stream) &&
+          output_stream.flush()) {
+        status = 0;
+      }
+    }
+  }
+
+  const int trailer[] = {0, status};
+  if (output_stream.flush()) {
+    SendAll(socket_descriptor, reinterpret_cast<const char*>(trailer),
+            sizeof(trailer),
+            Clock::now() + std::chrono::seconds(timeout_in_seconds));
+  }
+  close(socket_descriptor);
+}
+
+// Set by the handler of SIGINT and SIGTERM to stop the server.
+volatile std::sig_atomic_t is_interrupted(0);
+
+void HandleInterruption(int) {
+  is_interrupted = 1;
+}
+
+// Remove a stale socket file left by a server which did not stop normally.
+// Other files and sockets used by a running server are not removed.
+bool RemoveStaleSocket(const char* socket_path, const sockaddr_un& address) {
+  struct stat file_status;
+  if (lstat(socket_path, &file_status) < 0) {
+    return ENOENT == errno;
+  }
+  if (!S_ISSOCK(file_status.st_mode)) {
+    std::ostringstream error_message;
+    error_message << "Cannot overwrite " << socket_path
+                  << " which is not a socket";
+    sptk::PrintErrorMessage("pipeline", error_message);
+    return false;
+  }
+
+  const int socket_descriptor(socket(AF_UNIX, SOCK_STREAM, 0));
+  if (socket_descriptor < 0) {
+    return false;
+  }
+  const bool is_used(0 == connect(socket_descriptor,
+                                  reinterpret_cast<const sockaddr*>(&address),
+                                  sizeof(address)));
+  close(socket_descriptor);
+  if (is_used) {
+    std::ostringstream error_message;
+    error_message << "Another server is listening on " << socket_path;
+    sptk::PrintErrorMessage("pipeline", error_message);
+    return false;
+  }
+  return 0 == unlink(socket_path);
+}
+
+bool Serve(const char* socket_path, int num_thread, int max_num_cached_stage,
+           std::size_t max_request_size, int timeout_in_seconds) {
+  sockaddr_un address;
+  if (!SetSocketPath(socket_path, &address) ||
+      !RemoveStaleSocket(socket_path, address)) {
+    return false;
+  }
+
+  const int listening_socket_descriptor(socket(AF_UNIX, SOCK_STREAM, 0));
+  if (listening_socket_descriptor < 0) {
+    std::ostringstream error_message;
+    error_message << "Failed to create socket";
+    sptk::PrintErrorMessage("pipeline", error_message);
+    return false;
+  }
+  if (bind(listening_socket_descriptor,
+           reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0) {
+    std::ostringstream error_message;
+    error_message << "Failed to bind " << socket_path;
+    sptk::PrintErrorMessage("pipeline", error_message);
+    close(listening_socket_descriptor);
+    return false;
+  }
+  if (listen(listening_socket_descriptor, SOMAXCONN) < 0) {
+    std::ostringstream error_message;
+    error_message << "Failed to listen on " << socket_path;
+    sptk::PrintErrorMessage("pipeline", error_message);
+    close(listening_socket_descriptor);
+    unlink(socket_path);
+    return false;
+  }
+
+  // SIGINT and SIGTERM are blocked except while the main thread waits for a
+  // connection, so that they always interrupt the wait and the socket file is
+  // removed below.
+  sigset_t interruption_signals;
+  sigset_t original_signals;
+  sigemptyset(&interruption_signals);
+  sigaddset(&interruption_signals, SIGINT);
+  sigaddset(&interruption_signals, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &interruption_signals, &original_signals);
+  sigset_t waiting_signals(original_signals);
+  sigdelset(&waiting_signals, SIGINT);
+  sigdelset(&waiting_signals, SIGTERM);
+  struct sigaction action;
+  struct sigaction original_sigint_action;
+  struct sigaction original_sigterm_action;
+  std::memset(&action, 0, sizeof(action));
+  action.sa_handler = HandleInterruption;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGINT, &action, &original_sigint_action);
+  sigaction(SIGTERM, &action, &original_sigterm_action);
+
+  // Accepted connections are processed by the worker threads.
+  StageCache cache(max_num_cached_stage);
+  std::queue<int> connections;
+  bool is_stopped(false);
+  std::mutex mutex;
+  std::condition_variable is_accepted;
+  std::vector<std::thread> workers;
+  for (int i(0); i < num_thread; ++i) {
+    workers.push_back(std::thread([&]() {
+      for (;;) {
+        int socket_descriptor;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          while (connections.empty() && !is_stopped) {
+            is_accepted.wait(lock);
+          }
+          if (connections.empty()) {
+            return;
+          }
+          socket_descriptor = connections.front();
+          connections.pop();
+        }
+        HandleRequest(socket_descriptor, max_request_size, timeout_in_seconds,
+                      &cache);
+      }
+    }));
+  }
+
+  bool is_succeeded(true);
+  while (!is_interrupted) {
+    fd_set descriptors;
+    FD_ZERO(&descriptors);
+    FD_SET(listening_socket_descriptor, &descriptors);
+    if (pselect(listening_socket_descriptor + 1, &descriptors, NULL, NULL,
+                NULL, &waiting_signals) < 0) {
+      if (EINTR == errno) continue;
+      is_succeeded = false;
+      break;
+    }
+
+    const int socket_descriptor(
+        accept(listening_socket_descriptor, NULL, NULL));
+    if (socket_descriptor < 0) {
+      if (EINTR == errno || ECONNABORTED == errno) continue;
+      is_succeeded = false;
+      break;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      connections.push(socket_descriptor);
+    }
+    is_accepted.notify_one();
+  }
+
+  if (!is_succeeded) {
+    std::ostringstream error_message;
+    error_message << "Failed to accept connection";
+    sptk::PrintErrorMessage("pipeline", error_message);
+  }
+
+  // The requests already accepted are processed before stopping.
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    is_stopped = true;
+  }
+  is_accepted.notify_all();
+  for (std::vector<std::thread>::iterator itr(workers.begin());
+       itr != workers.end(); ++itr) {
+    itr->join();
+  }
+  close(listening_socket_descriptor);
+  unlink(socket_path);
+
+  sigaction(SIGINT, &original_sigint_action, NULL);
+  sigaction(SIGTERM, &original_sigterm_action, NULL);
+  pthread_sigmask(SIG_SETMASK, &original_signals, NULL);
+  return is_succeeded;
+}
+
+bool SendRequest(const char* socket_path, const std::string& description,
+                 std::istream* input_stream, std::ostream* output_stream) {
+  sockaddr_un address;
+  if (!SetSocketPath(socket_path, &address)) {
+    return false;
+  }
+
+  const int socket_descriptor(socket(AF_UNIX, SOCK_STREAM, 0));
+  if (socket_descriptor < 0 ||
+      connect(socket_descriptor, reinterpret_cast<const sockaddr*>(&address),
+              sizeof(address)) < 0) {
+    std::ostringstream error_message;
+    error_message << "Failed to connect to " << socket_path;
+    sptk::PrintErrorMessage("pipeline", error_message);
+    if (0 <= socket_descriptor) close(socket_descriptor);
+    return false;
+  }
+
+  const int description_length(static_cast<int>(description.size()));
+  const Clock::time_point no_deadline(Clock::time_point::max());
+  bool is_sent(SendAll(socket_descriptor,
+                       reinterpret_cast<const char*>(&description_length),
+                       sizeof(description_length), no_deadline) &&
+               SendAll(socket_descriptor, description.data(),
+                       description.size(), no_deadline));
+  char buffer[kBufferSize];
+  while (is_sent && input_stream->read(buffer, sizeof(buffer)).gcount()) {
+    is_sent = SendAll(socket_descriptor, buffer, input_stream->gcount(),
+                      no_deadline);
+  }
+  shutdown(socket_descriptor, SHUT_WR);
+
+  // Write the output as it is received.
+  int size;
+  bool is_received(is_sent);
+  while (is_received) {
+    is_received = ReceiveExactly(socket_descriptor,
+                                 reinterpret_cast<char*>(&size), sizeof(size),
+                                 no_deadline) &&
+                  0 <= size && size <= kBufferSize;
+    if (!is_received || 0 == size) break;
+    is_received =
+        ReceiveExactly(socket_descriptor, buffer, size, no_deadline) &&
+        output_stream->write(buffer, size);
+  }
+  int status(1);
+  if (!is_received ||
+      !ReceiveExactly(socket_descriptor, reinterpret_cast<char*>(&status),
+                      sizeof(status), no_deadline)) {
+    std::ostringstream error_message;
+    error_message << "Failed to communicate with server";
+    sptk::PrintErrorMessage("pipeline", error_message);
+    close(socket_descriptor);
+    return false;
+  }
+  close(socket_descriptor);
+
+  if (0 != status) {
+    std::ostringstream error_message;
+    error_message << "Failed to run pipeline on server";
+    sptk::PrintErrorMessage("pipeline", error_message);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+/**
+ * @a pipeline [ @e option ] @e description [ @e infile ]
+ *
+ * - @b -q @e int
+ *   - number of frames buffered between stages @f$(0 \le Q)@f$
+ * - @b -c @e str
+ *   - send request to server listening on socket
+ * - @b -s @e str
+ *   - run as server listening on socket
+ * - @b -t @e int
+ *   - number of threads of server @f$(1 \le T)@f$
+ * - @b -C @e int
+ *   - maximum number of stages kept by server @f$(1 \le C)@f$
+ * - @b -M @e int
+ *   - maximum size of request to server in megabytes @f$(1 \le M)@f$
+ * - @b -T @e int
+ *   - timeout of server in seconds @f$(1 \le T)@f$
+ * - @b description @e str
+ *   - stages separated by @c |
+ * - @b infile @e str
+ *   - double-type input sequence
+ * - @b stdout
+ *   - double-type output sequence
+ *
+ * This command runs a pipeline of stages in a single process. Each stage is
+ * written in the same way as the corresponding command, and the stages
+ * exchange frames in memory instead of pipes. The available stages are
+ * @c frame, @c window, @c spec, @c mgcep, @c delta, and @c sopr with the
+ * options listed in the usage. The input of @c spec and @c mgcep is a waveform
+ * and @c sopr does not handle magic numbers.
+ *
+ * Each stage runs in its own thread and at most @f$Q@f$ frames are buffered
+ * between adjacent stages. If @f$Q=0@f$, all stages run in the main thread.
+ * If a stage fails, the frames given before the failure are output and the
+ * command returns 1 as the corresponding pipe of commands does. The client in
+ * the server mode behaves in the same way.
+ *
+ * The below example extracts mel-cepstrum and its dynamic components:
+ *
+ * @code{.sh}
+ *   x2x +sd data.short |
+ *     pipeline 'frame -l 400 -p 80 | window -l 400 -L 512 |
+ *               mgcep -l 512 -m 24 -a 0.42 | delta -m 24 -r 1 1' > data.mgc
+ * @endcode
+ *
+ * which is the same as
+ *
+ * @code{.sh}
+ *   x2x +sd data.short | frame -l 400 -p 80 | window -l 400 -L 512 |
+ *     mgcep -l 512 -m 24 -a 0.42 | delta -m 24 -r 1 1 > data.mgc
+ * @endcode
+ *
+ * If many short inputs are processed, the time to start the command and to
+ * construct the stages can be dominant. In such a case, the command can run
+ * as a server listening on a Unix domain socket. The server keeps the stages
+ * constructed for the previous requests and processes the requests with
+ * @f$T@f$ threads. The client sends the description and the input to the
+ * server and receives the output:
+ *
+ * @code{.sh}
+ *   pipeline -s /tmp/sptk.sock -t 8 &
+ *   for f in *.raw; do
+ *     pipeline -c /tmp/sptk.sock 'frame | window | mgcep' $f > ${f%.raw}.mgc
+ *   done
+ * @endcode
+ *
+ * The whole input of each request is held in memory by the server, so the
+ * server is intended for short inputs. Requests larger than @f$M@f$ megabytes
+ * are rejected. The output is sent to the client while it is computed, so its
+ * size is not limited. If a client does not send the whole request within
+ * @f$T@f$ seconds, or does not receive a part of the output within @f$T@f$
+ * seconds, the connection is closed so that other requests are not blocked.
+ * The server keeps at most @f$C@f$ stages and discards the least
+ * recently used one when a new stage is constructed. The server stops on
+ * SIGINT or SIGTERM after processing the accepted requests, and removes the
+ * socket file. An existing file at the socket path is replaced only if it is
+ * a socket no server is listening on.
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  int queue_length(kDefaultQueueLength);
+  const char* client_socket_path(NULL);
+  const char* server_socket_path(NULL);
+  int num_thread(kDefaultNumThread);
+  int max_num_cached_stage(kDefaultMaxNumCachedStage);
+  int max_request_size_in_megabytes(kDefaultMaxRequestSizeInMegabytes);
+  int timeout_in_seconds(kDefaultTimeoutInSeconds);
+
+  for (;;) {
+    const int option_char(
+        getopt_long(argc, argv, "q:c:s:t:C:M:T:h", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 'q': {
+        if (!sptk::ConvertStringToInteger(optarg, &queue_length) ||
+            queue_length < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -q option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("pipeline", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'c': {
+        client_socket_path = optarg;
+        break;
+      }
+      case 's': {
+        server_socket_path = optarg;
+        break;
+      }
+      case 't': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_thread) ||
+            num_thread <= 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -t option must be a "
+                        << "positive integer";
+          sptk::PrintErrorMessage("pipeline", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'C': {
+        if (!sptk::ConvertStringToInteger(optarg, &max_num_cached_stage) ||
+            max_num_cached_stage <= 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -C option must be a "
+                        << "positive integer";
+          sptk::PrintErrorMessage("pipeline", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'M': {
+        if (!sptk::ConvertStringToInteger(optarg,
+                                          &max_request_size_in_megabytes) ||
+            max_request_size_in_megabytes <= 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -M option must be a "
+                        << "positive integer";
+          sptk::PrintErrorMessage("pipeline", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'T': {
+        if (!sptk::ConvertStringToInteger(optarg, &timeout_in_seconds) ||
+            timeout_in_seconds <= 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -T option must be a "
+                        << "positive integer";
+          sptk::PrintErrorMessage("pipeline", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  const int num_input_files(argc - optind);
+
+  if (NULL != server_socket_path) {
+    if (NULL != client_socket_path || 0 != num_input_files) {
+      std::ostringstream error_message;
+      error_message << "Server takes neither -c option nor description";
+      sptk::PrintErrorMessage("pipeline", error_message);
+      return 1;
+    }
+    return Serve(server_socket_path, num_thread, max_num_cached_stage,
+                 static_cast<std::size_t>(max_request_size_in_megabytes)
+                     << 20,
+                 timeout_in_seconds)
+               ? 0
+               : 1;
+  }
+
+  // Get description and input file name.
+  if (num_input_files < 1 || 2 < num_input_files) {
+    std::ostringstream error_message;
+    error_message << "Description and at most one input file are required";
+    sptk::PrintErrorMessage("pipeline", error_message);
+    return 1;
+  }
+  const char* description(argv[optind]);
+  const char* input_file(2 == num_input_files ? argv[optind + 1] : NULL);
+
+  std::ifstream ifs;
+  ifs.open(input_file, std::ios::in | std::ios::binary);
+  if (ifs.fail() && NULL != input_file) {
+    std::ostringstream error_message;
+    error_message << "Cannot open file " << input_file;
+    sptk::PrintErrorMessage("pipeline", error_message);
+    return 1;
+  }
+  std::istream& input_stream(ifs.fail() ? std::cin : ifs);
+
+  if (NULL != client_socket_path) {
+    return SendRequest(client_socket_path, description, &input_stream,
+                       &std::cout)
+               ? 0
+               : 1;
+  }
+
+  StageCache cache(max_num_cached_stage);
+  return RunPipeline(description, queue_length, &cache, &input_stream,
+                     &std::cout)
+             ? 0
+             : 1;
+}
@@ -26,12 +26,15 @@
 
 namespace {
 
+enum OutputFormats { kFullRate = 0, kDecimated, kNumOutputFormats };
+
 const int kDefaultNumSubband(4);
 const int kDefaultNumFilterOrder(47);
 const double kDefaultAttenuation(100.0);
 const int kDefaultNumIteration(100);
 const double kDefaultConvergenceThreshold(1e-6);
 const double kDefaultInitialStepSize(1e-2);
+const OutputFormats kDefaultOutputFormat(kFullRate);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -43,6 +46,9 @@ void PrintUsage(std::ostream* stream) {
   *stream << "  options:" << std::endl;
   *stream << "       -k k  : number of subbands         (   int)[" << std::setw(5) << std::right << kDefaultNumSubband           << "][   1 <= k <=   ]" << std::endl;  // NOLINT
   *stream << "       -m m  : order of filter            (   int)[" << std::setw(5) << std::right << kDefaultNumFilterOrder       << "][   2 <= m <=   ]" << std::endl;  // NOLINT
+  *stream << "       -o o  : output format              (   int)[" << std::setw(5) << std::right << kDefaultOutputFormat         << "][   0 <= o <= 1 ]" << std::endl;  // NOLINT
+  *stream << "                 0 (full-rate subband signals)" << std::endl;
+  *stream << "                 1 (decimated subband signals)" << std::endl;
   *stream << "     (level 2)" << std::endl;
   *stream << "       -a a  : stopband attenuation in dB (double)[" << std::setw(5) << std::right << kDefaultAttenuation          << "][   0 <  a <=   ]" << std::endl;  // NOLINT
   *stream << "       -i i  : number of iterations       (   int)[" << std::setw(5) << std::right << kDefaultNumIteration         << "][   0 <  i <=   ]" << std::endl;  // NOLINT
@@ -68,6 +74,10 @@ void PrintUsage(std::ostream* stream) {
  *   - number of subbands @f$(1 \le K)@f$
  * - @b -m @e int
  *   - order of filter @f$(2 \le M)@f$
+ * - @b -o @e int
+ *   - output format @f$(0 \le O \le 1)@f$
+ *     \arg @c 0 full-rate subband signals
+ *     \arg @c 1 decimated subband signals
  * - @b -a @e double
  *   - stopband attenuation @f$(0 < \alpha)@f$
  * - @b -i @e int
@@ -88,6 +98,13 @@ void PrintUsage(std::ostream* stream) {
  *   x2x +sd data.short | pqmf -k 4 | decimate -l 4 -p 4 > data.sub
  * @endcode
  *
+ * The same result is more efficiently obtained by computing the decimated
+ * subband signals directly:
+ *
+ * @code{.sh}
+ *   x2x +sd data.short | pqmf -k 4 -o 1 > data.sub
+ * @endcode
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
@@ -99,9 +116,11 @@ int main(int argc, char* argv[]) {
   int num_iteration(kDefaultNumIteration);
   double convergence_threshold(kDefaultConvergenceThreshold);
   double initial_step_size(kDefaultInitialStepSize);
+  OutputFormats output_format(kDefaultOutputFormat);
 
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "k:m:a:i:d:s:h", NULL, NULL));
+    const int option_char(
+        getopt_long(argc, argv, "k:m:o:a:i:d:s:h", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -127,6 +146,21 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'o': {
+        const int min(0);
+        const int max(static_cast<int>(kNumOutputFormats) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -o option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("pqmf", error_message);
+          return 1;
+        }
+        output_format = static_cast<OutputFormats>(tmp);
+        break;
+      }
       case 'a': {
         if (!sptk::ConvertStringToDouble(optarg, &attenuation) ||
             attenuation <= 0.0) {
@@ -217,6 +251,63 @@ int main(int argc, char* argv[]) {
   const int delay(sptk::IsEven(num_filter_order) ? num_filter_order / 2
                                                  : (num_filter_order - 1) / 2);
 
+  if (kDecimated == output_format) {
+    // Zeros are prepended so that the last sample of each block corresponds
+    // to the sample kept by decimation of the full-rate subband signals.
+    const int num_padding(num_subband - 1 - delay % num_subband);
+    std::vector<double> samples(num_subband, 0.0);
+    int index(num_padding);
+    int num_output(0);
+
+    int n(0);
+    while (sptk::ReadStream(&input, &input_stream)) {
+      samples[index++] = input;
+      ++n;
+      if (num_subband == index) {
+        index = 0;
+        if (!analysis.Run(samples, &output, &buffer)) {
+          std::ostringstream error_message;
+          error_message << "Failed to perform PQMF analysis";
+          sptk::PrintErrorMessage("pqmf", error_message);
+          return 1;
+        }
+        if (delay < n) {
+          if (!sptk::WriteStream(0, num_subband, output, &std::cout, NULL)) {
+            std::ostringstream error_message;
+            error_message << "Failed to write subband signals";
+            sptk::PrintErrorMessage("pqmf", error_message);
+            return 1;
+          }
+          ++num_output;
+        }
+      }
+    }
+
+    for (int t(n); num_output * num_subband < n; ++t) {
+      samples[index++] = input;
+      if (num_subband == index) {
+        index = 0;
+        if (!analysis.Run(samples, &output, &buffer)) {
+          std::ostringstream error_message;
+          error_message << "Failed to perform PQMF analysis";
+          sptk::PrintErrorMessage("pqmf", error_message);
+          return 1;
+        }
+        if (delay <= t) {
+          if (!sptk::WriteStream(0, num_subband, output, &std::cout, NULL)) {
+            std::ostringstream error_message;
+            error_message << "Failed to write subband signals";
+            sptk::PrintErrorMessage("pqmf", error_message);
+            return 1;
+          }
+          ++num_output;
+        }
+      }
+    }
+
+    return 0;
+  }
+
   int n(0);
   while (sptk::ReadStream(&input, &input_stream)) {
     if (!analysis.Run(input, &output, &buffer)) {
@@ -17,6 +17,7 @@
 #include <fstream>   // std::ifstream
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>   // std::ostringstream
+#include <vector>    // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/math/scalar_operation.h"
@@ -24,16 +25,21 @@
 
 namespace {
 
+// Number of numbers processed at once.
+const int kBlockSize(4096);
+
 enum LongOptions {
   kABS = 1000,
   kINV,
   kSQR,
   kSQRT,
   kLN,
+  kFASTLN,
   kLOG2,
   kLOG10,
   kLOGX,
   kEXP,
+  kFASTEXP,
   kPOW2,
   kPOW10,
   kPOWX,
@@ -76,10 +82,12 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -SQR         : square                              [      x ^ 2 ]" << std::endl;  // NOLINT
   *stream << "       -SQRT        : square root                         [    x ^ 0.5 ]" << std::endl;  // NOLINT
   *stream << "       -LN          : natural logarithm                   [      ln(x) ]" << std::endl;  // NOLINT
+  *stream << "       -FASTLN      : fast natural logarithm              [      ln(x) ]" << std::endl;  // NOLINT
   *stream << "       -LOG2        : base 2 logarithm                    [    log2(x) ]" << std::endl;  // NOLINT
   *stream << "       -LOG10       : base 10 logarithm                   [   log10(x) ]" << std::endl;  // NOLINT
   *stream << "       -LOGX X      : base X logarithm     (double)[  N/A][    logX(x) ]" << std::endl;  // NOLINT
   *stream << "       -EXP         : exponential                         [      e ^ x ]" << std::endl;  // NOLINT
+  *stream << "       -FASTEXP     : fast exponential                    [      e ^ x ]" << std::endl;  // NOLINT
   *stream << "       -POW2        : power of 2                          [      2 ^ x ]" << std::endl;  // NOLINT
   *stream << "       -POW10       : power of 10                         [     10 ^ x ]" << std::endl;  // NOLINT
   *stream << "       -POWX X      : power of X           (double)[  N/A][      X ^ x ]" << std::endl;  // NOLINT
@@ -121,6 +129,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       data sequence after operations      (double)" << std::endl;
   *stream << "  notice:" << std::endl;
   *stream << "       if -MAGIC is given before -magic is given, return error" << std::endl;  // NOLINT
+  *stream << "       errors of -FASTLN and -FASTEXP are within 2 and 1 ULP" << std::endl;  // NOLINT
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
@@ -158,6 +167,8 @@ void PrintUsage(std::ostream* stream) {
  *   - square root
  * - @b -LN
  *   - natural logarithm
+ * - @b -FASTLN
+ *   - fast natural logarithm
  * - @b -LOG2
  *   - base 2 logarithm
  * - @b -LOG10
@@ -166,6 +177,8 @@ void PrintUsage(std::ostream* stream) {
  *   - base @f$X@f$ logarithm
  * - @b -EXP
  *   - exponential
+ * - @b -FASTEXP
+ *   - fast exponential
  * - @b -POW2
  *   - power of 2
  * - @b -POW10
@@ -209,6 +222,13 @@ void PrintUsage(std::ostream* stream) {
  * - @b stdout
  *   - double-type data sequence after operations
  *
+ * The @c -FASTLN and @c -FASTEXP options use the vectorizable polynomial
+ * approximations of sptk::Log and sptk::Exp instead of @c std::log and
+ * @c std::exp. Their errors are within 2 ULP and 1 ULP, respectively.
+ * Arguments for which the input or the result is not a normalized finite
+ * number, e.g., zero, negative, or denormalized inputs of the logarithm, give
+ * the same results as @c -LN and @c -EXP.
+ *
  * @code{.sh}
  *   # 0, 1, 2, 3
  *   ramp -l 4 | sopr -m 2 -a 1 | x2x +da
@@ -228,10 +248,12 @@ int main(int argc, char* argv[]) {
       {"SQR", no_argument, NULL, kSQR},
       {"SQRT", no_argument, NULL, kSQRT},
       {"LN", no_argument, NULL, kLN},
+      {"FASTLN", no_argument, NULL, kFASTLN},
       {"LOG2", no_argument, NULL, kLOG2},
       {"LOG10", no_argument, NULL, kLOG10},
       {"LOGX", required_argument, NULL, kLOGX},
       {"EXP", no_argument, NULL, kEXP},
+      {"FASTEXP", no_argument, NULL, kFASTEXP},
       {"POW2", no_argument, NULL, kPOW2},
       {"POW10", no_argument, NULL, kPOW10},
       {"POWX", required_argument, NULL, kPOWX},
@@ -441,6 +463,15 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case kFASTLN: {
+        if (!scalar_operation.AddNaturalLogarithmOperation(true)) {
+          std::ostringstream error_message;
+          error_message << "Failed to add operation by -FASTLN option";
+          sptk::PrintErrorMessage("sopr", error_message);
+          return 1;
+        }
+        break;
+      }
       case kLOG2: {
         if (!scalar_operation.AddLogarithmOperation(2.0)) {
           std::ostringstream error_message;
@@ -484,6 +515,15 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case kFASTEXP: {
+        if (!scalar_operation.AddNaturalExponentialOperation(true)) {
+          std::ostringstream error_message;
+          error_message << "Failed to add operation by -FASTEXP option";
+          sptk::PrintErrorMessage("sopr", error_message);
+          return 1;
+        }
+        break;
+      }
       case kPOW2: {
         if (!scalar_operation.AddExponentialOperation(2.0)) {
           std::ostringstream error_message;
@@ -708,21 +748,37 @@ int main(int argc, char* argv[]) {
   }
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
-  double number;
-  bool is_magic_number;
+  std::vector<double> numbers(kBlockSize);
+  std::vector<bool> is_magic_numbers(kBlockSize);
+  int actual_read_size;
 
-  while (sptk::ReadStream(&number, &input_stream)) {
-    if (!scalar_operation.Run(&number, &is_magic_number)) {
+  while (sptk::ReadStream(true, 0, 0, kBlockSize, &numbers, &input_stream,
+                          &actual_read_size) &&
+         0 < actual_read_size) {
+    if (actual_read_size < kBlockSize) {
+      numbers.resize(actual_read_size);
+    }
+    if (!scalar_operation.Run(&numbers, &is_magic_numbers)) {
       std::ostringstream error_message;
       error_message << "Failed to perform scalar operation";
       sptk::PrintErrorMessage("sopr", error_message);
       return 1;
     }
-    if (!is_magic_number && !sptk::WriteStream(number, &std::cout)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write data";
-      sptk::PrintErrorMessage("sopr", error_message);
-      return 1;
+    // Write numbers except magic numbers.
+    for (int begin(0), end(0); begin < actual_read_size; begin = end + 1) {
+      while (begin < actual_read_size && is_magic_numbers[begin]) {
+        ++begin;
+      }
+      for (end = begin; end < actual_read_size && !is_magic_numbers[end];) {
+        ++end;
+      }
+      if (begin < end && !sptk::WriteStream(begin, end - begin, numbers,
+                                            &std::cout, NULL)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write data";
+        sptk::PrintErrorMessage("sopr", error_message);
+        return 1;
+      }
     }
   }
 
@@ -0,0 +1,490 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include <algorithm>  // std::fill
+#include <cfloat>     // DBL_MAX
+#include <cstring>    // std::strncmp
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+#include "Getopt/getoptwin.h"
+#include "SPTK/conversion/spectrum_to_spectrum.h"
+#include "SPTK/math/short_time_fourier_transform.h"
+#include "SPTK/utils/sptk_utils.h"
+#include "SPTK/window/data_windowing.h"
+#include "SPTK/window/standard_window.h"
+
+namespace {
+
+enum FramingTypes { kCenter = 0, kStart, kNumFramingTypes };
+
+enum LocalWindowType {
+  kBlackman = 0,
+  kHamming,
+  kHanning,
+  kBartlett,
+  kTrapezoidal,
+  kRectangular,
+  kNumWindowTypes
+};
+
+const int kDefaultFrameLength(256);
+const int kDefaultFramePeriod(100);
+const FramingTypes kDefaultFramingType(kCenter);
+const sptk::DataWindowing::NormalizationType kDefaultNormalizationType(
+    sptk::DataWindowing::NormalizationType::kPower);
+const LocalWindowType kDefaultLocalWindowType(kBlackman);
+const sptk::SpectrumToSpectrum::InputOutputFormats kDefaultOutputFormat(
+    sptk::SpectrumToSpectrum::kLogAmplitudeSpectrumInDecibels);
+const char* kDefaultDataType("d");
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " stft - short-time Fourier transform" << std::endl;
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       stft [ options ] [ infile ] > stdout" << std::endl;
+  *stream << "  options:" << std::endl;
+  *stream << "       -l l  : frame length                        (   int)[" << std::setw(5) << std::right << kDefaultFrameLength       << "][   1 <= l <= L   ]" << std::endl;  // NOLINT
+  *stream << "       -L L  : FFT length                          (   int)[" << std::setw(5) << std::right << "l"                       << "][   l <= L <=     ]" << std::endl;  // NOLINT
+  *stream << "       -p p  : frame period                        (   int)[" << std::setw(5) << std::right << kDefaultFramePeriod       << "][   1 <= p <=     ]" << std::endl;  // NOLINT
+  *stream << "       -n n  : framing type                        (   int)[" << std::setw(5) << std::right << kDefaultFramingType       << "][   0 <= n <= 1   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (the beginning of data is the center of the first frame)" << std::endl;  // NOLINT
+  *stream << "                 1 (the beginning of data is the start of the first frame)" << std::endl;  // NOLINT
+  *stream << "       -N N  : normalization type of window        (   int)[" << std::setw(5) << std::right << kDefaultNormalizationType << "][   0 <= N <= 2   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (none)" << std::endl;
+  *stream << "                 1 (power)" << std::endl;
+  *stream << "                 2 (magnitude)" << std::endl;
+  *stream << "       -w w  : window type                         (   int)[" << std::setw(5) << std::right << kDefaultLocalWindowType   << "][   0 <= w <= 5   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (Blackman)" << std::endl;
+  *stream << "                 1 (Hamming)" << std::endl;
+  *stream << "                 2 (Hanning)" << std::endl;
+  *stream << "                 3 (Bartlett)" << std::endl;
+  *stream << "                 4 (trapezoidal)" << std::endl;
+  *stream << "                 5 (rectangular)" << std::endl;
+  *stream << "       -e e  : small value added to power spectrum (double)[" << std::setw(5) << std::right << "N/A"                     << "][ 0.0 <  e <=     ]" << std::endl;  // NOLINT
+  *stream << "       -E E  : relative floor in decibels          (double)[" << std::setw(5) << std::right << "N/A"                     << "][     <= E <  0.0 ]" << std::endl;  // NOLINT
+  *stream << "       -o o  : output format                       (   int)[" << std::setw(5) << std::right << kDefaultOutputFormat      << "][   0 <= o <= 3   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (20*log|X(k)|)" << std::endl;
+  *stream << "                 1 (ln|X(k)|)" << std::endl;
+  *stream << "                 2 (|X(k)|)" << std::endl;
+  *stream << "                 3 (|X(k)|^2)" << std::endl;
+  *stream << "       +type : data type                                   [" << std::setw(5) << std::right << kDefaultDataType          << "]" << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("f", stream); sptk::PrintDataType("d", stream); *stream << std::endl;  // NOLINT
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << "  infile:" << std::endl;
+  *stream << "       data sequence                               (  type)[stdin]" << std::endl;  // NOLINT
+  *stream << "  stdout:" << std::endl;
+  *stream << "       spectrum                                    (  type)" << std::endl;  // NOLINT
+  *stream << "  notice:" << std::endl;
+  *stream << "       value of L must be a power of 2" << std::endl;
+  *stream << "       if type is f, spectrum is computed in single precision" << std::endl;  // NOLINT
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+// The signals after the end of data are regarded as zeros.
+template <typename T>
+bool Process(
+    const sptk::ShortTimeFourierTransform& short_time_fourier_transform,
+    int frame_period, int first_shift, std::istream* input_stream) {
+  sptk::ShortTimeFourierTransform::Buffer buffer;
+  const int output_length(short_time_fourier_transform.GetFftLength() / 2 + 1);
+  std::vector<T> waveform;
+  std::vector<T> spectrum(output_length);
+
+  int num_read_sample(0);
+  bool is_end(false);
+  for (int frame_position(0);; frame_position += frame_period) {
+    const int num_shift(0 == frame_position ? first_shift : frame_period);
+    waveform.resize(num_shift);
+    if (!is_end) {
+      int actual_read_size(0);
+      if (!sptk::ReadStream(true, 0, 0, num_shift, &waveform, input_stream,
+                            &actual_read_size)) {
+        actual_read_size = 0;
+      }
+      if (actual_read_size < num_shift) {
+        std::fill(waveform.begin() + actual_read_size, waveform.end(), T(0));
+        is_end = true;
+      }
+      num_read_sample += actual_read_size;
+    } else {
+      std::fill(waveform.begin(), waveform.end(), T(0));
+    }
+
+    // Output frames whose positions are within data.
+    if (num_read_sample <= frame_position) {
+      break;
+    }
+
+    if (!short_time_fourier_transform.Run(waveform, &spectrum, &buffer)) {
+      std::ostringstream error_message;
+      error_message << "Failed to run short-time Fourier transform";
+      sptk::PrintErrorMessage("stft", error_message);
+      return false;
+    }
+
+    if (!sptk::WriteStream(0, output_length, spectrum, &std::cout, NULL)) {
+      std::ostringstream error_message;
+      error_message << "Failed to write spectrum";
+      sptk::PrintErrorMessage("stft", error_message);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+/**
+ * @a stft [ @e option ] [ @e infile ]
+ *
+ * - @b -l @e int
+ *   - frame length @f$(1 \le L_1)@f$
+ * - @b -L @e int
+ *   - FFT length @f$(L_1 \le L_2)@f$
+ * - @b -p @e int
+ *   - frame period @f$(1 \le P)@f$
+ * - @b -n @e int
+ *   - framing type
+ *     \arg @c 0 the beginning of data is the center of the first frame
+ *     \arg @c 1 the beginning of data is the start of the first frame
+ * - @b -N @e int
+ *   - normalization type of window
+ *     \arg @c 0 none
+ *     \arg @c 1 power
+ *     \arg @c 2 magnitude
+ * - @b -w @e int
+ *   - window type
+ *     \arg @c 0 Blackman
+ *     \arg @c 1 Hamming
+ *     \arg @c 2 Hanning
+ *     \arg @c 3 Bartlett
+ *     \arg @c 4 Trapezoidal
+ *     \arg @c 5 Rectangular
+ * - @b -e @e double
+ *   - small value added to power spectrum
+ * - @b -E @e double
+ *   - relative floor in decibels
+ * - @b -o @e int
+ *   - output format
+ *     \arg @c 0 amplitude spectrum in dB
+ *     \arg @c 1 log amplitude spectrum
+ *     \arg @c 2 amplitude spectrum
+ *     \arg @c 3 power spectrum
+ * - @b +type @e char
+ *   - data type
+ *     \arg @c f float (4byte)
+ *     \arg @c d double (8byte)
+ * - @b infile @e str
+ *   - data sequence
+ * - @b stdout
+ *   - spectrum
+ *
+ * This command performs framing, windowing, and spectral analysis at once.
+ * The frames are not copied, so it is faster than the chain of @c frame,
+ * @c window, and @c spec, especially if the frames overlap.
+ *
+ * The below example performs spectral analysis with Blackman window.
+ *
+ * @code{.sh}
+ *   stft -l 400 -L 512 -p 80 -e 1e-6 data.d > data.sp
+ * @endcode
+ *
+ * which is the same as
+ *
+ * @code{.sh}
+ *   frame -l 400 -p 80 data.d | window -l 400 -L 512 |
+ *     spec -l 512 -e 1e-6 > data.sp
+ * @endcode
+ *
+ * If the data type is @c f, the windowing and the FFT are computed in single
+ * precision, which halves the memory traffic. The result differs from that of
+ * double precision by rounding errors.
+ *
+ * @code{.sh}
+ *   x2x +df data.d | stft -l 400 -L 512 -p 80 -e 1e-6 +f > data.sp.f
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  int frame_length(kDefaultFrameLength);
+  int fft_length(kDefaultFrameLength);
+  bool is_fft_length_specified(false);
+  int frame_period(kDefaultFramePeriod);
+  FramingTypes framing_type(kDefaultFramingType);
+  sptk::DataWindowing::NormalizationType normalization_type(
+      kDefaultNormalizationType);
+  LocalWindowType local_window_type(kDefaultLocalWindowType);
+  double epsilon(0.0);
+  double relative_floor_in_decibels(-DBL_MAX);
+  sptk::SpectrumToSpectrum::InputOutputFormats output_format(
+      kDefaultOutputFormat);
+  std::string data_type(kDefaultDataType);
+
+  for (;;) {
+    const int option_char(
+        getopt_long(argc, argv, "l:L:p:n:N:w:e:E:o:h", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 'l': {
+        if (!sptk::ConvertStringToInteger(optarg, &frame_length) ||
+            frame_length <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -l option must be a positive integer";
+          sptk::PrintErrorMessage("stft", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'L': {
+        if (!sptk::ConvertStringToInteger(optarg, &fft_length) ||
+            fft_length <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -L option must be a positive integer";
+          sptk::PrintErrorMessage("stft", error_message);
+          return 1;
+        }
+        is_fft_length_specified = true;
+        break;
+      }
+      case 'p': {
+        if (!sptk::ConvertStringToInteger(optarg, &frame_period) ||
+            frame_period <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -p option must be a positive integer";
+          sptk::PrintErrorMessage("stft", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'n': {
+        const int min(0);
+        const int max(static_cast<int>(kNumFramingTypes) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -n option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("stft", error_message);
+          return 1;
+        }
+        framing_type = static_cast<FramingTypes>(tmp);
+        break;
+      }
+      case 'N': {
+        const int min(0);
+        const int max(static_cast<int>(sptk::DataWindowing::NormalizationType::
+                                           kNumNormalizationTypes) -
+                      1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -N option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("stft", error_message);
+          return 1;
+        }
+        normalization_type =
+            static_cast<sptk::DataWindowing::NormalizationType>(tmp);
+        break;
+      }
+      case 'w': {
+        const int min(0);
+        const int max(static_cast<int>(kNumWindowTypes) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -w option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("stft", error_message);
+          return 1;
+        }
+        local_window_type = static_cast<LocalWindowType>(tmp);
+        break;
+      }
+      case 'e': {
+        if (!sptk::ConvertStringToDouble(optarg, &epsilon) || epsilon <= 0.0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -e option must be a positive number";
+          sptk::PrintErrorMessage("stft", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'E': {
+        if (!sptk::ConvertStringToDouble(optarg, &relative_floor_in_decibels) ||
+            0.0 <= relative_floor_in_decibels) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -E option must be a negative number";
+          sptk::PrintErrorMessage("stft", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'o': {
+        const int min(0);
+        const int max(
+            static_cast<int>(sptk::SpectrumToSpectrum::kNumInputOutputFormats) -
+            1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -o option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("stft", error_message);
+          return 1;
+        }
+        output_format =
+            static_cast<sptk::SpectrumToSpectrum::InputOutputFormats>(tmp);
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  if (!is_fft_length_specified) {
+    fft_length = frame_length;
+  } else if (fft_length < frame_length) {
+    std::ostringstream error_message;
+    error_message << "The frame length " << frame_length
+                  << " must be equal to or less than the FFT length "
+                  << fft_length;
+    sptk::PrintErrorMessage("stft", error_message);
+    return 1;
+  }
+
+  const char* input_file(NULL);
+  for (int i(argc - optind); 1 <= i; --i) {
+    const char* arg(argv[argc - i]);
+    if (0 == std::strncmp(arg, "+", 1)) {
+      const std::string str(arg);
+      data_type = str.substr(1, std::string::npos);
+    } else if (NULL == input_file) {
+      input_file = arg;
+    } else {
+      std::ostringstream error_message;
+      error_message << "Too many input files";
+      sptk::PrintErrorMessage("stft", error_message);
+      return 1;
+    }
+  }
+  if ("f" != data_type && "d" != data_type) {
+    std::ostringstream error_message;
+    error_message << "Unexpected argument for the +type option";
+    sptk::PrintErrorMessage("stft", error_message);
+    return 1;
+  }
+
+  std::ifstream ifs;
+  ifs.open(input_file, std::ios::in | std::ios::binary);
+  if (ifs.fail() && NULL != input_file) {
+    std::ostringstream error_message;
+    error_message << "Cannot open file " << input_file;
+    sptk::PrintErrorMessage("stft", error_message);
+    return 1;
+  }
+  std::istream& input_stream(ifs.fail() ? std::cin : ifs);
+
+  sptk::StandardWindow::WindowType window_type;
+  switch (local_window_type) {
+    case kBlackman: {
+      window_type = sptk::StandardWindow::kBlackman;
+      break;
+    }
+    case kHamming: {
+      window_type = sptk::StandardWindow::kHamming;
+      break;
+    }
+    case kHanning: {
+      window_type = sptk::StandardWindow::kHanning;
+      break;
+    }
+    case kBartlett: {
+      window_type = sptk::StandardWindow::kBartlett;
+      break;
+    }
+    case kTrapezoidal: {
+      window_type = sptk::StandardWindow::kTrapezoidal;
+      break;
+    }
+    case kRectangular: {
+      window_type = sptk::StandardWindow::kRectangular;
+      break;
+    }
+    default: {
+      return 1;
+    }
+  }
+
+  sptk::StandardWindow standard_window(frame_length, window_type, false);
+  sptk::ShortTimeFourierTransform short_time_fourier_transform(
+      &standard_window, fft_length, normalization_type, output_format, epsilon,
+      relative_floor_in_decibels);
+  if (!short_time_fourier_transform.IsValid()) {
+    std::ostringstream error_message;
+    error_message << "FFT length must be a power of 2";
+    sptk::PrintErrorMessage("stft", error_message);
+    return 1;
+  }
+
+  // The t-th frame ends at tP + L - L/2 if the framing type is 0, otherwise
+  // at tP + L.
+  const int first_shift(kCenter == framing_type
+                            ? frame_length - frame_length / 2
+                            : frame_length);
+  const bool result("f" == data_type
+                        ? Process<float>(short_time_fourier_transform,
+                                         frame_period, first_shift,
+                                         &input_stream)
+                        : Process<double>(short_time_fourier_transform,
+                                          frame_period, first_shift,
+                                          &input_stream));
+  if (!result) {
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,468 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include <cstdint>    // int16_t
+#include <exception>  // std::exception
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
+
+#include "Getopt/getoptwin.h"
+#include "SPTK/generation/m_sequence_generation.h"
+#include "SPTK/generation/mglsa_vocoder.h"
+#include "SPTK/generation/normal_distributed_random_value_generation.h"
+#include "SPTK/input/input_source_from_stream.h"
+#include "SPTK/postfilter/mel_cepstrum_postfilter.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace {
+
+enum OutputFormats { kDouble = 0, kShort, kNumOutputFormats };
+
+const int kDefaultNumFilterOrder(25);
+const double kDefaultAlpha(0.35);
+const int kDefaultNumStage(0);
+const int kDefaultFramePeriod(100);
+const int kDefaultInterpolationPeriod(1);
+const int kDefaultNumPadeOrder(4);
+const bool kDefaultTranspositionFlag(false);
+const bool kDefaultGainFlag(true);
+const bool kDefaultFlagToUseNormalDistributedRandomValue(false);
+const int kDefaultSeed(1);
+const double kDefaultBeta(0.0);
+const int kDefaultImpulseResponseLength(1024);
+const OutputFormats kDefaultOutputFormat(kDouble);
+
+// Onset index of postfilter, i.e., 0th and 1st coefficients are not emphasized.
+const int kOnsetIndexOfPostfilter(2);
+
+// Number of samples synthesized at once.
+const int kBlockSize(4096);
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " vocoder - synthesize speech from pitch and mel-generalized cepstrum" << std::endl;  // NOLINT
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       vocoder [ options ] mgcfile [ infile ] > stdout" << std::endl;  // NOLINT
+  *stream << "  options:" << std::endl;
+  *stream << "       -m m  : order of filter coefficients  (   int)[" << std::setw(5) << std::right << kDefaultNumFilterOrder        << "][    0 <= m <  l   ]" << std::endl;  // NOLINT
+  *stream << "       -a a  : all-pass constant             (double)[" << std::setw(5) << std::right << kDefaultAlpha                 << "][ -1.0 <  a <  1.0 ]" << std::endl;  // NOLINT
+  *stream << "       -c c  : gamma = -1 / c                (   int)[" << std::setw(5) << std::right << kDefaultNumStage              << "][    0 <= c <=     ]" << std::endl;  // NOLINT
+  *stream << "       -p p  : frame period                  (   int)[" << std::setw(5) << std::right << kDefaultFramePeriod           << "][    1 <= p <=     ]" << std::endl;  // NOLINT
+  *stream << "       -i i  : interpolation period          (   int)[" << std::setw(5) << std::right << kDefaultInterpolationPeriod   << "][    0 <= i <= p/2 ]" << std::endl;  // NOLINT
+  *stream << "       -P P  : order of Pade approximation   (   int)[" << std::setw(5) << std::right << kDefaultNumPadeOrder          << "][    4 <= P <= 7   ]" << std::endl;  // NOLINT
+  *stream << "       -t    : transpose filter              (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultTranspositionFlag) << "]" << std::endl;  // NOLINT
+  *stream << "       -k    : filtering without gain        (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(!kDefaultGainFlag)         << "]" << std::endl;  // NOLINT
+  *stream << "       -n    : use gauss noise               (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultFlagToUseNormalDistributedRandomValue) << "]" << std::endl;  // NOLINT
+  *stream << "               for unvoiced frame" << std::endl;
+  *stream << "               default is M-sequence" << std::endl;
+  *stream << "       -s s  : seed for random generation    (   int)[" << std::setw(5) << std::right << kDefaultSeed                  << "][      <= s <=     ]" << std::endl;  // NOLINT
+  *stream << "       -b b  : intensity of postfilter       (double)[" << std::setw(5) << std::right << kDefaultBeta                  << "][      <= b <=     ]" << std::endl;  // NOLINT
+  *stream << "       -l l  : length of impulse response    (   int)[" << std::setw(5) << std::right << kDefaultImpulseResponseLength << "][    2 <= l <=     ]" << std::endl;  // NOLINT
+  *stream << "               of postfilter" << std::endl;
+  *stream << "       -o o  : output format                 (   int)[" << std::setw(5) << std::right << kDefaultOutputFormat          << "][    0 <= o <= 1   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (double)" << std::endl;
+  *stream << "                 1 (short)" << std::endl;
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << "  mgcfile:" << std::endl;
+  *stream << "       mel-generalized cepstral coefficients (double)" << std::endl;  // NOLINT
+  *stream << "  infile:" << std::endl;
+  *stream << "       pitch period                          (double)[stdin]" << std::endl;  // NOLINT
+  *stream << "  stdout:" << std::endl;
+  *stream << "       speech waveform" << std::endl;
+  *stream << "  notice:" << std::endl;
+  *stream << "       if i = 0, don't interpolate pitch and filter coefficients" << std::endl;  // NOLINT
+  *stream << "       if c = 0, MLSA filter is used" << std::endl;
+  *stream << "       if c > 0, MGLSA filter is used and P is ignored" << std::endl;  // NOLINT
+  *stream << "       if b = 0, postfilter is not applied" << std::endl;
+  *stream << "       postfilter is available only if c = 0" << std::endl;
+  *stream << "       short output is rounded and clipped" << std::endl;
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+bool WriteWaveform(const std::vector<double>& waveform,
+                   OutputFormats output_format,
+                   std::vector<int16_t>* buffer) {
+  const int length(static_cast<int>(waveform.size()));
+  if (kShort == output_format) {
+    buffer->resize(length);
+    for (int t(0); t < length; ++t) {
+      const double x(waveform[t]);
+      if (x <= INT16_MIN) {
+        (*buffer)[t] = INT16_MIN;
+      } else if (INT16_MAX <= x) {
+        (*buffer)[t] = INT16_MAX;
+      } else {
+        (*buffer)[t] = static_cast<int16_t>(0.0 < x ? x + 0.5 : x - 0.5);
+      }
+    }
+    return sptk::WriteStream(0, length, *buffer, &std::cout, NULL);
+  }
+  return sptk::WriteStream(0, length, waveform, &std::cout, NULL);
+}
+
+}  // namespace
+
+/**
+ * @a vocoder [ @e option ] @e mgcfile [ @e infile ]
+ *
+ * - @b -m @e int
+ *   - order of coefficients @f$(0 \le M < L)@f$
+ * - @b -a @e double
+ *   - all-pass constant @f$(|\alpha| < 1)@f$
+ * - @b -c @e int
+ *   - gamma @f$\gamma = -1 / C@f$ @f$(1 \le C)@f$
+ * - @b -p @e int
+ *   - frame period @f$(1 \le P)@f$
+ * - @b -i @e int
+ *   - interpolation period @f$(0 \le I \le P/2)@f$
+ * - @b -P @e int
+ *   - order of Pade approximation @f$(4 \le L \le 7)@f$
+ * - @b -t
+ *   - transpose filter
+ * - @b -k
+ *   - filtering without gain
+ * - @b -n
+ *   - use gaussian noise instead of M-sequence for unvoiced frame
+ * - @b -s @e int
+ *   - seed for random number generation
+ * - @b -b @e double
+ *   - intensity of postfilter @f$(\beta)@f$
+ * - @b -l @e int
+ *   - length of impulse response of postfilter @f$(2 \le L)@f$
+ * - @b -o @e int
+ *   - output format
+ *     \arg @c 0 double
+ *     \arg @c 1 short
+ * - @b mgcfile @e str
+ *   - double-type mel-generalized cepstral coefficients
+ * - @b infile @e str
+ *   - double-type pitch period
+ * - @b stdout
+ *   - double-type or short-type speech waveform
+ *
+ * This command synthesizes speech waveform from the pitch period in @c infile
+ * (or standard input) and the mel-generalized cepstrum in @c mgcfile in a
+ * single process. The output is the same as that of the pipeline of
+ * @c excite, @c mcpf, and @c mglsadf, but the samples are processed in blocks
+ * and are not passed through pipes. The short-type output is rounded and
+ * clipped, which corresponds to @c x2x @c +ds @c -r.
+ *
+ * In the below example, a speech waveform is synthesized from @c data.pitch and
+ * @c data.mcep with postfiltering.
+ *
+ * @code{.sh}
+ *   vocoder -m 24 -a 0.42 -b 0.2 -o 1 data.mcep < data.pitch > data.raw
+ * @endcode
+ *
+ * The above is equivalent to the following pipeline except that the samples
+ * exceeding the range of short type are clipped.
+ *
+ * @code{.sh}
+ *   mcpf -m 24 -a 0.42 -b 0.2 < data.mcep > data.pf
+ *   excite < data.pitch | mglsadf -m 24 -a 0.42 data.pf | x2x +ds -r > data.raw
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  int num_filter_order(kDefaultNumFilterOrder);
+  double alpha(kDefaultAlpha);
+  int num_stage(kDefaultNumStage);
+  int frame_period(kDefaultFramePeriod);
+  int interpolation_period(kDefaultInterpolationPeriod);
+  int num_pade_order(kDefaultNumPadeOrder);
+  bool transposition_flag(kDefaultTranspositionFlag);
+  bool gain_flag(kDefaultGainFlag);
+  bool use_normal_distributed_random_value(
+      kDefaultFlagToUseNormalDistributedRandomValue);
+  int seed(kDefaultSeed);
+  double beta(kDefaultBeta);
+  int impulse_response_length(kDefaultImpulseResponseLength);
+  OutputFormats output_format(kDefaultOutputFormat);
+
+  for (;;) {
+    const int option_char(
+        getopt_long(argc, argv, "m:a:c:p:i:P:tkns:b:l:o:h", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 'm': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_filter_order) ||
+            num_filter_order < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -m option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("vocoder", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'a': {
+        if (!sptk::ConvertStringToDouble(optarg, &alpha) ||
+            !sptk::IsValidAlpha(alpha)) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -a option must be in (-1.0, 1.0)";
+          sptk::PrintErrorMessage("vocoder", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'c': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_stage) ||
+            num_stage < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -c option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("vocoder", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'p': {
+        if (!sptk::ConvertStringToInteger(optarg, &frame_period) ||
+            frame_period <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -p option must be a positive integer";
+          sptk::PrintErrorMessage("vocoder", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'i': {
+        if (!sptk::ConvertStringToInteger(optarg, &interpolation_period) ||
+            interpolation_period < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -i option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("vocoder", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'P': {
+        const int min(4);
+        const int max(7);
+        if (!sptk::ConvertStringToInteger(optarg, &num_pade_order) ||
+            !sptk::IsInRange(num_pade_order, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -P option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("vocoder", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 't': {
+        transposition_flag = true;
+        break;
+      }
+      case 'k': {
+        gain_flag = false;
+        break;
+      }
+      case 'n': {
+        use_normal_distributed_random_value = true;
+        break;
+      }
+      case 's': {
+        if (!sptk::ConvertStringToInteger(optarg, &seed)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -s option must be an integer";
+          sptk::PrintErrorMessage("vocoder", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'b': {
+        if (!sptk::ConvertStringToDouble(optarg, &beta)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -b option must be a number";
+          sptk::PrintErrorMessage("vocoder", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'l': {
+        if (!sptk::ConvertStringToInteger(optarg, &impulse_response_length) ||
+            impulse_response_length <= 1) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -l option must be an integer "
+                        << "greater than 1";
+          sptk::PrintErrorMessage("vocoder", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'o': {
+        const int min(0);
+        const int max(static_cast<int>(kNumOutputFormats) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -o option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("vocoder", error_message);
+          return 1;
+        }
+        output_format = static_cast<OutputFormats>(tmp);
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  if (frame_period / 2 < interpolation_period) {
+    std::ostringstream error_message;
+    error_message << "Interpolation period must be equal to or less than half "
+                  << "frame period";
+    sptk::PrintErrorMessage("vocoder", error_message);
+    return 1;
+  }
+
+  const bool use_postfilter(0.0 != beta);
+  if (use_postfilter && 0 != num_stage) {
+    std::ostringstream error_message;
+    error_message << "Postfilter is available only if c = 0";
+    sptk::PrintErrorMessage("vocoder", error_message);
+    return 1;
+  }
+
+  if (use_postfilter && impulse_response_length <= num_filter_order) {
+    std::ostringstream error_message;
+    error_message << "Order of mel-cepstrum must be less than length of "
+                  << "impulse response";
+    sptk::PrintErrorMessage("vocoder", error_message);
+    return 1;
+  }
+
+  // Get input file names.
+  const char* mel_generalized_cepstrum_file;
+  const char* pitch_file;
+  const int num_input_files(argc - optind);
+  if (2 == num_input_files) {
+    mel_generalized_cepstrum_file = argv[argc - 2];
+    pitch_file = argv[argc - 1];
+  } else if (1 == num_input_files) {
+    mel_generalized_cepstrum_file = argv[argc - 1];
+    pitch_file = NULL;
+  } else {
+    std::ostringstream error_message;
+    error_message << "Just two input files, mgcfile and infile, are required";
+    sptk::PrintErrorMessage("vocoder", error_message);
+    return 1;
+  }
+
+  // Open stream for reading mel-generalized cepstrum.
+  std::ifstream ifs1;
+  ifs1.open(mel_generalized_cepstrum_file, std::ios::in | std::ios::binary);
+  if (ifs1.fail()) {
+    std::ostringstream error_message;
+    error_message << "Cannot open file " << mel_generalized_cepstrum_file;
+    sptk::PrintErrorMessage("vocoder", error_message);
+    return 1;
+  }
+  std::istream& stream_for_mel_generalized_cepstrum(ifs1);
+
+  // Open stream for reading pitch.
+  std::ifstream ifs2;
+  ifs2.open(pitch_file, std::ios::in | std::ios::binary);
+  if (ifs2.fail() && NULL != pitch_file) {
+    std::ostringstream error_message;
+    error_message << "Cannot open file " << pitch_file;
+    sptk::PrintErrorMessage("vocoder", error_message);
+    return 1;
+  }
+  std::istream& stream_for_pitch(ifs2.fail() ? std::cin : ifs2);
+
+  // Prepare postfilter.
+  sptk::MelCepstrumPostfilter postfilter(
+      num_filter_order, use_postfilter ? impulse_response_length : 2,
+      use_postfilter ? kOnsetIndexOfPostfilter : 0, alpha, beta);
+  if (use_postfilter && !postfilter.IsValid()) {
+    std::ostringstream error_message;
+    error_message << "FFT length must be a power of 2 and greater than 1";
+    sptk::PrintErrorMessage("vocoder", error_message);
+    return 1;
+  }
+
+  // Run synthesis.
+  sptk::RandomGenerationInterface* random_generation(NULL);
+  try {
+    if (use_normal_distributed_random_value) {
+      random_generation =
+          new sptk::NormalDistributedRandomValueGeneration(seed);
+    } else {
+      random_generation = new sptk::MSequenceGeneration();
+    }
+
+    sptk::InputSourceFromStream pitch_source(false, 1, &stream_for_pitch);
+    sptk::InputSourceFromStream mel_generalized_cepstrum_source(
+        false, num_filter_order + 1, &stream_for_mel_generalized_cepstrum);
+    sptk::MglsaVocoder vocoder(
+        num_filter_order, alpha, num_stage, num_pade_order, transposition_flag,
+        gain_flag, frame_period, interpolation_period, &pitch_source,
+        &mel_generalized_cepstrum_source, random_generation,
+        use_postfilter ? &postfilter : NULL);
+    if (!vocoder.IsValid()) {
+      std::ostringstream error_message;
+      error_message << "Failed to initialize MglsaVocoder";
+      sptk::PrintErrorMessage("vocoder", error_message);
+      delete random_generation;
+      return 1;
+    }
+
+    std::vector<double> waveform(kBlockSize);
+    std::vector<int16_t> buffer;
+    while (vocoder.Get(kBlockSize, &waveform)) {
+      if (!WriteWaveform(waveform, output_format, &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write speech waveform";
+        sptk::PrintErrorMessage("vocoder", error_message);
+        delete random_generation;
+        return 1;
+      }
+    }
+  } catch (std::exception&) {
+    std::ostringstream error_message;
+    error_message << "Unknown exception";
+    sptk::PrintErrorMessage("vocoder", error_message);
+    delete random_generation;
+    return 1;
+  }
+  delete random_generation;
+
+  return 0;
+}
@@ -14,12 +14,14 @@
 // limitations under the License.                                           //
 // ------------------------------------------------------------------------ //
 
-#include <cmath>     // std::sqrt
-#include <fstream>   // std::ifstream
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
+#include <algorithm>  // std::min
+#include <cmath>      // std::sqrt
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <thread>     // std::thread
+#include <vector>     // std::vector
 
 #include "Getopt/getoptwin.h"
 #include "SPTK/math/statistics_accumulation.h"
@@ -37,6 +39,7 @@ enum OutputFormats {
   kCorrelation,
   kPrecision,
   kMeanAndLowerAndUpperBounds,
+  kNumberAndMeanAndCovariance,
   kNumOutputFormats
 };
 
@@ -45,6 +48,9 @@ const int kDefaultVectorLength(1);
 const double kDefaultConfidenceLevel(95.0);
 const OutputFormats kDefaultOutputFormat(kMeanAndCovariance);
 const bool kDefaultOutputOnlyDiagonalElementsFlag(false);
+const bool kDefaultInputStatisticsFlag(false);
+const int kDefaultNumThreads(1);
+const int kNumVectorsPerThread(4096);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -58,7 +64,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -m m  : order of vector      (   int)[" << std::setw(5) << std::right << "l-1"                   << "][ 0 <= m <=     ]" << std::endl;  // NOLINT
   *stream << "       -t t  : output interval      (   int)[" << std::setw(5) << std::right << "EOF"                   << "][ 1 <= t <=     ]" << std::endl;  // NOLINT
   *stream << "       -c c  : confidence level     (double)[" << std::setw(5) << std::right << kDefaultConfidenceLevel << "][ 0 <  c <  100 ]" << std::endl;  // NOLINT
-  *stream << "       -o o  : output format        (   int)[" << std::setw(5) << std::right << kDefaultOutputFormat    << "][ 0 <= o <= 6   ]" << std::endl;  // NOLINT
+  *stream << "       -o o  : output format        (   int)[" << std::setw(5) << std::right << kDefaultOutputFormat    << "][ 0 <= o <= 7   ]" << std::endl;  // NOLINT
   *stream << "                 0 (mean and covariance)" << std::endl;
   *stream << "                 1 (mean)" << std::endl;
   *stream << "                 2 (covariance)" << std::endl;
@@ -66,13 +72,21 @@ void PrintUsage(std::ostream* stream) {
   *stream << "                 4 (correlation)" << std::endl;
   *stream << "                 5 (precision)" << std::endl;
   *stream << "                 6 (mean and lower/upper bounds)" << std::endl;
+  *stream << "                 7 (number of vectors, mean, and" << std::endl;
+  *stream << "                    covariance)" << std::endl;
   *stream << "       -d    : output only diagonal (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultOutputOnlyDiagonalElementsFlag) << "]" << std::endl;  // NOLINT
   *stream << "               elements" << std::endl;
+  *stream << "       -s    : input statistics     (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultInputStatisticsFlag)            << "]" << std::endl;  // NOLINT
+  *stream << "               instead of vectors" << std::endl;
+  *stream << "       -n n  : number of threads    (   int)[" << std::setw(5) << std::right << kDefaultNumThreads      << "][ 1 <= n <=     ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
-  *stream << "       vectors                      (double)[stdin]" << std::endl;
+  *stream << "       vectors or statistics        (double)[stdin]" << std::endl;
   *stream << "  stdout:" << std::endl;
   *stream << "       statistics                   (double)" << std::endl;
+  *stream << "  notice:" << std::endl;
+  *stream << "       if s is true, input must be the output of o = 7" << std::endl;  // NOLINT
+  *stream << "       if o = 7, full covariance is output regardless of d" << std::endl;  // NOLINT
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
@@ -172,6 +186,36 @@ bool OutputStatistics(const sptk::StatisticsAccumulation& accumulation,
     }
   }
 
+  if (kNumberAndMeanAndCovariance == output_format) {
+    int num_vector;
+    if (!accumulation.GetNumData(buffer, &num_vector)) {
+      return false;
+    }
+    if (!sptk::WriteStream(static_cast<double>(num_vector), &std::cout)) {
+      return false;
+    }
+
+    std::vector<double> mean(vector_length);
+    if (!accumulation.GetMean(buffer, &mean)) {
+      return false;
+    }
+    if (!sptk::WriteStream(0, vector_length, mean, &std::cout, NULL)) {
+      return false;
+    }
+
+    sptk::SymmetricMatrix variance(vector_length);
+    if (!accumulation.GetFullCovariance(buffer, &variance)) {
+      return false;
+    }
+    for (int i(0); i < vector_length; ++i) {
+      for (int j(0); j < vector_length; ++j) {
+        if (!sptk::WriteStream(variance[i][j], &std::cout)) {
+          return false;
+        }
+      }
+    }
+  }
+
   if (kMeanAndLowerAndUpperBounds == output_format) {
     int num_vector;
     if (!accumulation.GetNumData(buffer, &num_vector)) {
@@ -215,6 +259,66 @@ bool OutputStatistics(const sptk::StatisticsAccumulation& accumulation,
   return true;
 }
 
+bool ReadStatistics(const sptk::StatisticsAccumulation& accumulation,
+                    int vector_length, std::istream* input_stream,
+                    sptk::StatisticsAccumulation::Buffer* buffer,
+                    bool* is_eof) {
+  *is_eof = false;
+  double num_vector;
+  if (!sptk::ReadStream(&num_vector, input_stream)) {
+    *is_eof = true;
+    return false;
+  }
+  std::vector<double> mean(vector_length);
+  if (!sptk::ReadStream(false, 0, 0, vector_length, &mean, input_stream,
+                        NULL)) {
+    return false;
+  }
+  sptk::SymmetricMatrix variance(vector_length);
+  if (!sptk::ReadStream(&variance, input_stream)) {
+    return false;
+  }
+  return accumulation.Merge(static_cast<int>(num_vector), mean, variance,
+                            buffer);
+}
+
+bool AccumulateInParallel(
+    const sptk::StatisticsAccumulation& accumulation,
+    const std::vector<std::vector<double> >& data, int num_data,
+    std::vector<sptk::StatisticsAccumulation::Buffer>* buffers_for_threads,
+    sptk::StatisticsAccumulation::Buffer* buffer) {
+  const int num_threads(static_cast<int>(buffers_for_threads->size()));
+  std::vector<char> results(num_threads, 1);
+  std::vector<std::thread> threads;
+  for (int k(0); k < num_threads; ++k) {
+    const int begin(num_data * k / num_threads);
+    const int end(num_data * (k + 1) / num_threads);
+    sptk::StatisticsAccumulation::Buffer* buffer_for_thread(
+        &((*buffers_for_threads)[k]));
+    char* result(&(results[k]));
+    threads.push_back(std::thread([&accumulation, &data, begin, end,
+                                   buffer_for_thread, result]() {
+      accumulation.Clear(buffer_for_thread);
+      for (int t(begin); t < end; ++t) {
+        if (!accumulation.Run(data[t], buffer_for_thread)) {
+          *result = 0;
+          return;
+        }
+      }
+    }));
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (int k(0); k < num_threads; ++k) {
+    if (!results[k] || !accumulation.Merge((*buffers_for_threads)[k], buffer)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace
 
 /**
@@ -237,10 +341,15 @@ bool OutputStatistics(const sptk::StatisticsAccumulation& accumulation,
  *     \arg @c 4 correlation
  *     \arg @c 5 precision
  *     \arg @c 6 mean and lower/upper bounds
+ *     \arg @c 7 number of vectors, mean, and covariance
  * - @b -d
  *   - output only diagonal elements
+ * - @b -s
+ *   - input statistics instead of vectors
+ * - @b -n @e int
+ *   - number of threads @f$(1 \le N)@f$
  * - @b infile @e str
- *   - double-type vectors
+ *   - double-type vectors or statistics
  * - @b stdout
  *   - double-type statistics
  *
@@ -332,6 +441,30 @@ bool OutputStatistics(const sptk::StatisticsAccumulation& accumulation,
  * and @f$p(C, L-1)@f$ is the upper @f$(100-C)/2@f$-th percentile of the of the
  * t-distribution with degrees of freedom @f$L-1@f$.
  *
+ * If @f$O=7@f$,
+ * @f[
+ *   \begin{array}{cccc}
+ *     T, &
+ *     \underbrace{\mu_{0}(1), \; \ldots, \; \mu_{0}(L)}_L, &
+ *     \underbrace{\sigma^2_0(1,1),  \; \sigma^2_{0}(1,2), \; \ldots, \;
+ *                 \sigma^2_0(L,L)}_{L \times L}, &
+ *     \ldots.
+ *   \end{array}
+ * @f]
+ * The output can be given to this command again with @c -s option. The
+ * statistics of several inputs are then merged as if the inputs had been
+ * concatenated. This enables to compute statistics of a large amount of data
+ * in parallel.
+ *
+ * @code{.sh}
+ *   vstat -l 10 -o 7 data1.d > data1.stat
+ *   vstat -l 10 -o 7 data2.d > data2.stat
+ *   cat data1.stat data2.stat | vstat -l 10 -s -o 0 > data12.stat
+ * @endcode
+ *
+ * If @f$N > 1@f$, the input vectors are read in blocks, and each block is
+ * divided into @f$N@f$ parts whose statistics are accumulated in parallel.
+ *
  * @code{.sh}
  *   echo 0 1 2 3 4 5 6 7 8 9 | x2x +ad > data.d
  *   vstat -o 1 data.d | x2x +da
@@ -350,9 +483,12 @@ int main(int argc, char* argv[]) {
   double confidence_level(kDefaultConfidenceLevel);
   OutputFormats output_format(kDefaultOutputFormat);
   bool outputs_only_diagonal_elements(kDefaultOutputOnlyDiagonalElementsFlag);
+  bool input_statistics(kDefaultInputStatisticsFlag);
+  int num_threads(kDefaultNumThreads);
 
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "l:m:t:c:o:dh", NULL, NULL));
+    const int option_char(
+        getopt_long(argc, argv, "l:m:t:c:o:dsn:h", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -420,6 +556,21 @@ int main(int argc, char* argv[]) {
         outputs_only_diagonal_elements = true;
         break;
       }
+      case 's': {
+        input_statistics = true;
+        break;
+      }
+      case 'n': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_threads) ||
+            num_threads <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -n option must be a positive integer";
+          sptk::PrintErrorMessage("vstat", error_message);
+          return 1;
+        }
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -460,27 +611,101 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  std::vector<double> data(vector_length);
-  for (int vector_index(1);
-       sptk::ReadStream(false, 0, 0, vector_length, &data, &input_stream, NULL);
-       ++vector_index) {
-    if (!accumulation.Run(data, &buffer)) {
-      std::ostringstream error_message;
-      error_message << "Failed to accumulate statistics";
-      sptk::PrintErrorMessage("vstat", error_message);
-      return 1;
+  if (input_statistics) {
+    for (int vector_index(1);; ++vector_index) {
+      bool is_eof;
+      if (!ReadStatistics(accumulation, vector_length, &input_stream, &buffer,
+                          &is_eof)) {
+        if (is_eof) break;
+        std::ostringstream error_message;
+        error_message << "Failed to merge statistics";
+        sptk::PrintErrorMessage("vstat", error_message);
+        return 1;
+      }
+
+      if (kMagicNumberForEndOfFile != output_interval &&
+          0 == vector_index % output_interval) {
+        if (!OutputStatistics(accumulation, buffer, vector_length,
+                              output_format, confidence_level,
+                              outputs_only_diagonal_elements)) {
+          std::ostringstream error_message;
+          error_message << "Failed to write statistics";
+          sptk::PrintErrorMessage("vstat", error_message);
+          return 1;
+        }
+        accumulation.Clear(&buffer);
+      }
     }
+  } else if (1 < num_threads) {
+    const int block_size(kNumVectorsPerThread * num_threads);
+    std::vector<std::vector<double> > data(block_size,
+                                           std::vector<double>(vector_length));
+    std::vector<sptk::StatisticsAccumulation::Buffer> buffers_for_threads(
+        num_threads);
+    for (int num_remaining_vectors(output_interval);;) {
+      // Read vectors until the block is filled or the output timing comes.
+      const int num_vectors_to_read(
+          kMagicNumberForEndOfFile == output_interval
+              ? block_size
+              : std::min(block_size, num_remaining_vectors));
+      int num_read_vectors(0);
+      while (num_read_vectors < num_vectors_to_read &&
+             sptk::ReadStream(false, 0, 0, vector_length,
+                              &data[num_read_vectors], &input_stream, NULL)) {
+        ++num_read_vectors;
+      }
+      if (0 == num_read_vectors) break;
 
-    if (kMagicNumberForEndOfFile != output_interval &&
-        0 == vector_index % output_interval) {
-      if (!OutputStatistics(accumulation, buffer, vector_length, output_format,
-                            confidence_level, outputs_only_diagonal_elements)) {
+      if (!AccumulateInParallel(accumulation, data, num_read_vectors,
+                                &buffers_for_threads, &buffer)) {
         std::ostringstream error_message;
-        error_message << "Failed to write statistics";
+        error_message << "Failed to accumulate statistics";
         sptk::PrintErrorMessage("vstat", error_message);
         return 1;
       }
-      accumulation.Clear(&buffer);
+
+      if (kMagicNumberForEndOfFile != output_interval) {
+        num_remaining_vectors -= num_read_vectors;
+        if (0 == num_remaining_vectors) {
+          if (!OutputStatistics(accumulation, buffer, vector_length,
+                                output_format, confidence_level,
+                                outputs_only_diagonal_elements)) {
+            std::ostringstream error_message;
+            error_message << "Failed to write statistics";
+            sptk::PrintErrorMessage("vstat", error_message);
+            return 1;
+          }
+          accumulation.Clear(&buffer);
+          num_remaining_vectors = output_interval;
+        }
+      }
+
+      if (num_read_vectors < num_vectors_to_read) break;
+    }
+  } else {
+    std::vector<double> data(vector_length);
+    for (int vector_index(1); sptk::ReadStream(false, 0, 0, vector_length,
+                                               &data, &input_stream, NULL);
+         ++vector_index) {
+      if (!accumulation.Run(data, &buffer)) {
+        std::ostringstream error_message;
+        error_message << "Failed to accumulate statistics";
+        sptk::PrintErrorMessage("vstat", error_message);
+        return 1;
+      }
+
+      if (kMagicNumberForEndOfFile != output_interval &&
+          0 == vector_index % output_interval) {
+        if (!OutputStatistics(accumulation, buffer, vector_length,
+                              output_format, confidence_level,
+                              outputs_only_diagonal_elements)) {
+          std::ostringstream error_message;
+          error_message << "Failed to write statistics";
+          sptk::PrintErrorMessage("vstat", error_message);
+          return 1;
+        }
+        accumulation.Clear(&buffer);
+      }
     }
   }
 
@@ -16,28 +16,27 @@
 
 #include "SPTK/math/discrete_cosine_transform.h"
 
-#include <algorithm>  // std::copy, std::reverse_copy
-#include <cmath>      // std::cos, std::sin, std::sqrt
-#include <cstddef>    // std::size_t
+#include <cmath>    // std::cos, std::sin, std::sqrt
+#include <cstddef>  // std::size_t
 
 namespace sptk {
 
 DiscreteCosineTransform::DiscreteCosineTransform(int dct_length)
-    : dct_length_(dct_length), fourier_transform_(2 * dct_length_) {
+    : dct_length_(dct_length), fourier_transform_(dct_length_) {
   if (!fourier_transform_.IsValid()) {
     return;
   }
 
-  const int dft_length(fourier_transform_.GetLength());
-  const double argument(sptk::kPi / dft_length);
-  const double c(1.0 / std::sqrt(dft_length));
+  // The factor 1/2 is required to separate real and imaginary parts.
+  const double argument(sptk::kPi / (2 * dct_length_));
+  const double c(0.5 * std::sqrt(2.0 / dct_length_));
   cosine_table_.resize(dct_length_);
   sine_table_.resize(dct_length_);
   cosine_table_[0] = c / std::sqrt(2.0);
   sine_table_[0] = 0.0;
   for (int i(1); i < dct_length_; ++i) {
     cosine_table_[i] = std::cos(argument * i) * c;
-    sine_table_[i] = -std::sin(argument * i) * c;
+    sine_table_[i] = std::sin(argument * i) * c;
   }
 }
 
@@ -56,15 +55,6 @@ bool DiscreteCosineTransform::Run(
   }
 
   // Prepare memories.
-  const int dft_length(fourier_transform_.GetLength());
-  if (buffer->fourier_transform_real_part_.size() !=
-      static_cast<std::size_t>(dft_length)) {
-    buffer->fourier_transform_real_part_.resize(dft_length);
-  }
-  if (buffer->fourier_transform_imag_part_.size() !=
-      static_cast<std::size_t>(dft_length)) {
-    buffer->fourier_transform_imag_part_.resize(dft_length);
-  }
   if (real_part_output->size() != static_cast<std::size_t>(dct_length_)) {
     real_part_output->resize(dct_length_);
   }
@@ -72,45 +62,106 @@ bool DiscreteCosineTransform::Run(
     imag_part_output->resize(dct_length_);
   }
 
-  std::copy(real_part_input.begin(), real_part_input.end(),
-            buffer->fourier_transform_real_part_.begin());
-  std::reverse_copy(real_part_input.begin(), real_part_input.end(),
-                    buffer->fourier_transform_real_part_.end() - dct_length_);
+  return Transform(&(real_part_input[0]), &(imag_part_input[0]),
+                   &((*real_part_output)[0]), &((*imag_part_output)[0]),
+                   buffer);
+}
+
+bool DiscreteCosineTransform::Run(
+    std::vector<double>* real_part, std::vector<double>* imag_part,
+    DiscreteCosineTransform::Buffer* buffer) const {
+  if (NULL == real_part || NULL == imag_part) return false;
+  return Run(*real_part, *imag_part, real_part, imag_part, buffer);
+}
+
+bool DiscreteCosineTransform::Run(
+    const Matrix& input_sequences, Matrix* output_sequences,
+    DiscreteCosineTransform::Buffer* buffer) const {
+  // Check inputs.
+  const int num_sequence(input_sequences.GetNumRow());
+  if (!fourier_transform_.IsValid() ||
+      input_sequences.GetNumColumn() != dct_length_ ||
+      NULL == output_sequences || &input_sequences == output_sequences ||
+      NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  if (output_sequences->GetNumRow() != num_sequence ||
+      output_sequences->GetNumColumn() != dct_length_) {
+    output_sequences->Resize(num_sequence, dct_length_);
+  }
+
+  // Transform two sequences at once by regarding them as real and imaginary
+  // parts.
+  for (int t(0); t < num_sequence; t += 2) {
+    if (t + 1 < num_sequence) {
+      if (!Transform(input_sequences[t], input_sequences[t + 1],
+                     (*output_sequences)[t], (*output_sequences)[t + 1],
+                     buffer)) {
+        return false;
+      }
+    } else {
+      if (buffer->imag_part_output_.size() !=
+          static_cast<std::size_t>(dct_length_)) {
+        buffer->imag_part_output_.resize(dct_length_);
+      }
+      if (!Transform(input_sequences[t], NULL, (*output_sequences)[t],
+                     &(buffer->imag_part_output_[0]), buffer)) {
+        return false;
+      }
+    }
+  }
 
-  std::copy(imag_part_input.begin(), imag_part_input.end(),
-            buffer->fourier_transform_imag_part_.begin());
-  std::reverse_copy(imag_part_input.begin(), imag_part_input.end(),
-                    buffer->fourier_transform_imag_part_.end() - dct_length_);
+  return true;
+}
+
+bool DiscreteCosineTransform::Transform(
+    const double* real_part_input, const double* imag_part_input,
+    double* real_part_output, double* imag_part_output,
+    DiscreteCosineTransform::Buffer* buffer) const {
+  // Prepare memories.
+  if (buffer->fourier_transform_real_part_.size() !=
+      static_cast<std::size_t>(dct_length_)) {
+    buffer->fourier_transform_real_part_.resize(dct_length_);
+  }
+  if (buffer->fourier_transform_imag_part_.size() !=
+      static_cast<std::size_t>(dct_length_)) {
+    buffer->fourier_transform_imag_part_.resize(dct_length_);
+  }
+
+  // Reorder input as x(0), x(2), ..., x(3), x(1). A null imaginary part is
+  // regarded as zeros.
+  double* v_real(&buffer->fourier_transform_real_part_[0]);
+  double* v_imag(&buffer->fourier_transform_imag_part_[0]);
+  for (int n(0); n < dct_length_; ++n) {
+    const int i(0 == n % 2 ? n / 2 : dct_length_ - 1 - n / 2);
+    v_real[i] = real_part_input[n];
+    v_imag[i] = NULL == imag_part_input ? 0.0 : imag_part_input[n];
+  }
 
   if (!fourier_transform_.Run(&buffer->fourier_transform_real_part_,
                               &buffer->fourier_transform_imag_part_)) {
     return false;
   }
 
+  // Separate the DFTs of real and imaginary parts by using the conjugate
+  // symmetry and multiply them by twiddle factors.
   const double* cosine_table(&(cosine_table_[0]));
   const double* sine_table(&(sine_table_[0]));
-  double* discrete_cosine_transform_real_part_output(&((*real_part_output)[0]));
-  double* discrete_cosine_transform_imag_part_output(&((*imag_part_output)[0]));
-  double* fourier_transform_real_part(&buffer->fourier_transform_real_part_[0]);
-  double* fourier_transform_imag_part(&buffer->fourier_transform_imag_part_[0]);
-
-  for (int i(0); i < dct_length_; ++i) {
-    discrete_cosine_transform_real_part_output[i] =
-        fourier_transform_real_part[i] * cosine_table[i] -
-        fourier_transform_imag_part[i] * sine_table[i];
-    discrete_cosine_transform_imag_part_output[i] =
-        fourier_transform_real_part[i] * sine_table[i] +
-        fourier_transform_imag_part[i] * cosine_table[i];
+  for (int k(0); k < dct_length_; ++k) {
+    const int l(0 == k ? 0 : dct_length_ - k);
+    const double sum_real(v_real[k] + v_real[l]);
+    const double difference_real(v_real[k] - v_real[l]);
+    const double sum_imag(v_imag[k] + v_imag[l]);
+    const double difference_imag(v_imag[k] - v_imag[l]);
+    real_part_output[k] =
+        cosine_table[k] * sum_real + sine_table[k] * difference_imag;
+    imag_part_output[k] =
+        cosine_table[k] * sum_imag - sine_table[k] * difference_real;
   }
 
   return true;
 }
 
-bool DiscreteCosineTransform::Run(
-    std::vector<double>* real_part, std::vector<double>* imag_part,
-    DiscreteCosineTransform::Buffer* buffer) const {
-  if (NULL == real_part || NULL == imag_part) return false;
-  return Run(*real_part, *imag_part, real_part, imag_part, buffer);
-}
-
 }  // namespace sptk
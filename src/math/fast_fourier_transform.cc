@@ -46,10 +46,12 @@ FastFourierTransform::FastFourierTransform(int num_order, int fft_length)
   sine_table_[fft_length_ / 2] = 0.0;
 }
 
-bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
-                               const std::vector<double>& imag_part_input,
-                               std::vector<double>* real_part_output,
-                               std::vector<double>* imag_part_output) const {
+template <typename T>
+bool FastFourierTransform::Transform(const std::vector<T>& real_part_input,
+                                     const std::vector<T>& imag_part_input,
+                                     const std::vector<T>& sine_table,
+                                     std::vector<T>* real_part_output,
+                                     std::vector<T>* imag_part_output) const {
   // Check inputs.
   if (!is_valid_ ||
       real_part_input.size() != static_cast<std::size_t>(num_order_ + 1) ||
@@ -70,28 +72,28 @@ bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
   std::copy(real_part_input.begin(), real_part_input.end(),
             real_part_output->begin());
   std::fill(real_part_output->begin() + real_part_input.size(),
-            real_part_output->end(), 0.0);
+            real_part_output->end(), T(0));
   std::copy(imag_part_input.begin(), imag_part_input.end(),
             imag_part_output->begin());
   std::fill(imag_part_output->begin() + imag_part_input.size(),
-            imag_part_output->end(), 0.0);
+            imag_part_output->end(), T(0));
 
-  double* x(&((*real_part_output)[0]));
-  double* y(&((*imag_part_output)[0]));
+  T* x(&((*real_part_output)[0]));
+  T* y(&((*imag_part_output)[0]));
 
   {
     int lix(fft_length_);
     int lmx(half_fft_length_);
     int lf(1);
     while (1 < lmx) {
-      const double* sinp(&(sine_table_[0]));
-      const double* cosp(&(sine_table_[0]) + fft_length_ / 4);
+      const T* sinp(&(sine_table[0]));
+      const T* cosp(&(sine_table[0]) + fft_length_ / 4);
       for (int i(0); i < lmx; ++i) {
-        double* xpi(&(x[i]));
-        double* ypi(&(y[i]));
+        T* xpi(&(x[i]));
+        T* ypi(&(y[i]));
         for (int li(lix); li <= fft_length_; li += lix) {
-          const double t1(*(xpi) - *(xpi + lmx));
-          const double t2(*(ypi) - *(ypi + lmx));
+          const T t1(*(xpi) - *(xpi + lmx));
+          const T t2(*(ypi) - *(ypi + lmx));
           *(xpi) += *(xpi + lmx);
           *(ypi) += *(ypi + lmx);
           *(xpi + lmx) = *cosp * t1 + *sinp * t2;
@@ -109,11 +111,11 @@ bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
   }
 
   {
-    double* xp(x);
-    double* yp(y);
+    T* xp(x);
+    T* yp(y);
     for (int li(0); li < half_fft_length_; ++li) {
-      const double t1(*(xp) - *(xp + 1));
-      const double t2(*(yp) - *(yp + 1));
+      const T t1(*(xp) - *(xp + 1));
+      const T t2(*(yp) - *(yp + 1));
       *(xp) += *(xp + 1);
       *(yp) += *(yp + 1);
       *(xp + 1) = t1;
@@ -125,14 +127,14 @@ bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
 
   // Bit reversal.
   {
-    double* xp(x);
-    double* yp(y);
+    T* xp(x);
+    T* yp(y);
     const int dec_fft_length(fft_length_ - 1);
     for (int lmx(0), j(0); lmx < dec_fft_length; ++lmx) {
       const int lmxj(lmx - j);
       if (lmxj < 0) {
-        const double t1(*(xp));
-        const double t2(*(yp));
+        const T t1(*(xp));
+        const T t2(*(yp));
         *(xp) = *(xp + lmxj);
         *(yp) = *(yp + lmxj);
         *(xp + lmxj) = t1;
@@ -153,10 +155,35 @@ bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
   return true;
 }
 
+bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
+                               const std::vector<double>& imag_part_input,
+                               std::vector<double>* real_part_output,
+                               std::vector<double>* imag_part_output) const {
+  return Transform(real_part_input, imag_part_input, sine_table_,
+                   real_part_output, imag_part_output);
+}
+
 bool FastFourierTransform::Run(std::vector<double>* real_part,
                                std::vector<double>* imag_part) const {
   if (NULL == real_part || NULL == imag_part) return false;
   return Run(*real_part, *imag_part, real_part, imag_part);
 }
 
+bool FastFourierTransform::Run(const std::vector<float>& real_part_input,
+                               const std::vector<float>& imag_part_input,
+                               std::vector<float>* real_part_output,
+                               std::vector<float>* imag_part_output) const {
+  std::call_once(float_sine_table_flag_, [this]() {
+    float_sine_table_.assign(sine_table_.begin(), sine_table_.end());
+  });
+  return Transform(real_part_input, imag_part_input, float_sine_table_,
+                   real_part_output, imag_part_output);
+}
+
+bool FastFourierTransform::Run(std::vector<float>* real_part,
+                               std::vector<float>* imag_part) const {
+  if (NULL == real_part || NULL == imag_part) return false;
+  return Run(*real_part, *imag_part, real_part, imag_part);
+}
+
 }  // namespace sptk
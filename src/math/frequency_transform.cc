@@ -32,6 +32,27 @@ FrequencyTransform::FrequencyTransform(int num_input_order,
     is_valid_ = false;
     return;
   }
+
+  // Make conversion matrix. The i-th row is the response to the unit impulse
+  // at the i-th input, which is obtained by applying the recursion to the
+  // (i-1)-th row.
+  const int input_length(num_input_order_ + 1);
+  const int output_length(num_output_order_ + 1);
+  conversion_matrix_.Resize(input_length, output_length);
+  conversion_matrix_[0][0] = 1.0;
+
+  const double beta(1.0 - alpha_ * alpha_);
+  for (int i(1); i < input_length; ++i) {
+    const double* d(conversion_matrix_[i - 1]);
+    double* g(conversion_matrix_[i]);
+    g[0] = alpha_ * d[0];
+    if (1 <= num_output_order_) {
+      g[1] = beta * d[0] + alpha_ * d[1];
+    }
+    for (int m(2); m <= num_output_order_; ++m) {
+      g[m] = d[m - 1] + alpha_ * (d[m] - g[m - 1]);
+    }
+  }
 }
 
 bool FrequencyTransform::Run(const std::vector<double>& minimum_phase_sequence,
@@ -50,9 +71,6 @@ bool FrequencyTransform::Run(const std::vector<double>& minimum_phase_sequence,
   if (warped_sequence->size() != static_cast<std::size_t>(output_length)) {
     warped_sequence->resize(output_length);
   }
-  if (buffer->d_.size() != static_cast<std::size_t>(output_length)) {
-    buffer->d_.resize(output_length);
-  }
 
   // There is no need to convert input when alpha is zero.
   if (0.0 == alpha_) {
@@ -69,28 +87,33 @@ bool FrequencyTransform::Run(const std::vector<double>& minimum_phase_sequence,
     return true;
   }
 
+  // Perform frequency transform.
   std::fill(warped_sequence->begin(), warped_sequence->end(), 0.0);
-
-  const double beta(1.0 - alpha_ * alpha_);
-  const double* c(&(minimum_phase_sequence[0]));
-  double* d(&buffer->d_[0]);
   double* g(&((*warped_sequence)[0]));
-
-  // Apply recursive formula.
-  for (int i(num_input_order_); 0 <= i; --i) {
-    d[0] = g[0];
-    g[0] = c[i] + alpha_ * d[0];
-    if (1 <= num_output_order_) {
-      d[1] = g[1];
-      g[1] = beta * d[0] + alpha_ * d[1];
-    }
-    for (int m(2); m <= num_output_order_; ++m) {
-      d[m] = g[m];
-      g[m] = d[m - 1] + alpha_ * (d[m] - g[m - 1]);
+  for (int i(0); i <= num_input_order_; ++i) {
+    const double c(minimum_phase_sequence[i]);
+    const double* a(conversion_matrix_[i]);
+    for (int m(0); m <= num_output_order_; ++m) {
+      g[m] += c * a[m];
     }
   }
 
   return true;
 }
 
+bool FrequencyTransform::Run(const Matrix& minimum_phase_sequences,
+                             Matrix* warped_sequences) const {
+  // Check inputs.
+  if (!is_valid_ ||
+      minimum_phase_sequences.GetNumColumn() != num_input_order_ + 1 ||
+      NULL == warped_sequences) {
+    return false;
+  }
+
+  // Perform frequency transform.
+  *warped_sequences = minimum_phase_sequences * conversion_matrix_;
+
+  return true;
+}
+
 }  // namespace sptk
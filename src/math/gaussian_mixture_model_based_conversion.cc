@@ -16,10 +16,16 @@
 
 #include "SPTK/math/gaussian_mixture_model_based_conversion.h"
 
-#include <algorithm>  // std::copy, std::max_element
+#include <algorithm>  // std::copy, std::min
+#include <cmath>      // std::log, std::sqrt
 #include <cstddef>    // std::size_t
 
-#include "SPTK/math/gaussian_mixture_modeling.h"
+namespace {
+
+// Number of frames converted at once.
+const int kNumFrameInBlock(256);
+
+}  // namespace
 
 namespace sptk {
 
@@ -43,9 +49,9 @@ GaussianMixtureModelBasedConversion::GaussianMixtureModelBasedConversion(
       mlpg_(num_target_order_, window_coefficients, use_magic_number_,
             magic_number_),
       is_valid_(true),
-      source_mean_vectors_(num_mixture_, std::vector<double>(source_length_)),
-      source_covariance_matrices_(num_mixture_,
-                                  SymmetricMatrix(source_length_)),
+      whitening_matrix_(source_length_, num_mixture_ * source_length_),
+      whitened_mean_vector_(num_mixture_ * source_length_),
+      log_constants_(num_mixture_),
       e_slope_(num_mixture_, Matrix(target_length_, source_length_)),
       e_bias_(num_mixture_, std::vector<double>(target_length_)),
       d_(num_mixture_, SymmetricMatrix(target_length_)) {
@@ -64,23 +70,53 @@ GaussianMixtureModelBasedConversion::GaussianMixtureModelBasedConversion(
       return;
     }
 
-    // Set \mu^{(X)}.
-    std::copy(mean_vectors[k].begin(), mean_vectors[k].begin() + source_length_,
-              source_mean_vectors_[k].begin());
-
     // Set \Sigma^{(XX)}.
+    SymmetricMatrix source_covariance_matrix(source_length_);
     for (int l(0); l < source_length_; ++l) {
       for (int m(0); m <= l; ++m) {
-        source_covariance_matrices_[k][l][m] = covariance_matrices[k][l][m];
+        source_covariance_matrix[l][m] = covariance_matrices[k][l][m];
       }
     }
 
     // Set \Sigma^{(YX)} \Sigma^{(XX)}^{-1}.
     SymmetricMatrix xx(source_length_);
-    if (!source_covariance_matrices_[k].Invert(&xx)) {
+    if (!source_covariance_matrix.Invert(&xx)) {
       is_valid_ = false;
       return;
     }
+
+    // Set W satisfying W^T W = \Sigma^{(XX)}^{-1} from its LDL^T decomposition,
+    // i.e., W = D^{1/2} L^T, and W \mu^{(X)}.
+    {
+      SymmetricMatrix lower_triangular_matrix;
+      std::vector<double> diagonal_elements;
+      if (!xx.CholeskyDecomposition(&lower_triangular_matrix,
+                                    &diagonal_elements)) {
+        is_valid_ = false;
+        return;
+      }
+      const int offset(k * source_length_);
+      double log_determinant(0.0);
+      for (int m(0); m < source_length_; ++m) {
+        if (diagonal_elements[m] <= 0.0) {
+          is_valid_ = false;
+          return;
+        }
+        const double scale(std::sqrt(diagonal_elements[m]));
+        double tmp(0.0);
+        for (int l(m); l < source_length_; ++l) {
+          const double w(scale * lower_triangular_matrix[l][m]);
+          whitening_matrix_[l][offset + m] = w;
+          tmp += w * mean_vectors[k][l];
+        }
+        whitened_mean_vector_[offset + m] = tmp;
+        log_determinant -= std::log(diagonal_elements[m]);
+      }
+      log_constants_[k] =
+          std::log(weights_[k]) -
+          0.5 * (source_length_ * std::log(sptk::kTwoPi) + log_determinant);
+    }
+
     for (int l(0); l < target_length_; ++l) {
       const int ll(source_length_ + l);
       for (int m(0); m < source_length_; ++m) {
@@ -130,39 +166,88 @@ bool GaussianMixtureModelBasedConversion::Run(
   std::vector<SymmetricMatrix> d(sequence_length,
                                  SymmetricMatrix(target_length_));
 
-  // Compute posterior probabilities of source input.
-  {
-    std::vector<double> components_of_log_probability(num_mixture_);
-    GaussianMixtureModeling::Buffer buffer;
-    for (int t(0); t < sequence_length; ++t) {
+  std::vector<int> frame_indices;
+  std::vector<std::vector<int> > frames_of_mixture(num_mixture_);
+  Matrix source_block;
+  Matrix whitened_block;
+  Matrix transposed_block;
+
+  for (int begin(0); begin < sequence_length; begin += kNumFrameInBlock) {
+    const int end(std::min(begin + kNumFrameInBlock, sequence_length));
+
+    // Collect frames to be converted.
+    frame_indices.clear();
+    for (int t(begin); t < end; ++t) {
+      if (source_vectors[t].size() !=
+          static_cast<std::size_t>(source_length_)) {
+        return false;
+      }
       if (use_magic_number_ && magic_number_ == source_vectors[t][0]) {
         continue;
       }
+      frame_indices.push_back(t);
+    }
+    const int num_frame(static_cast<int>(frame_indices.size()));
+    if (0 == num_frame) {
+      continue;
+    }
 
-      if (!GaussianMixtureModeling::CalculateLogProbability(
-              source_length_ - 1, num_mixture_, false, 0 == t,
-              source_vectors[t], weights_, source_mean_vectors_,
-              source_covariance_matrices_, &components_of_log_probability, NULL,
-              &buffer)) {
-        return false;
-      }
+    source_block.Resize(num_frame, source_length_);
+    for (int i(0); i < num_frame; ++i) {
+      std::copy(source_vectors[frame_indices[i]].begin(),
+                source_vectors[frame_indices[i]].end(), source_block[i]);
+    }
 
-      const int selected_mixture(static_cast<int>(
-          std::max_element(components_of_log_probability.begin(),
-                           components_of_log_probability.end()) -
-          components_of_log_probability.begin()));
+    // Whiten source vectors by all mixtures at once.
+    whitened_block = source_block * whitening_matrix_;
 
-      // Set E.
-      for (int l(0); l < target_length_; ++l) {
-        double tmp(0.0);
+    // Select the most probable mixture of each frame.
+    for (int i(0); i < num_frame; ++i) {
+      const double* z(whitened_block[i]);
+      const double* mu(&(whitened_mean_vector_[0]));
+      int selected_mixture(0);
+      double max_log_probability(0.0);
+      for (int k(0); k < num_mixture_; ++k) {
+        double sum(0.0);
+        for (int l(0); l < source_length_; ++l) {
+          const double diff(z[l] - mu[l]);
+          sum += diff * diff;
+        }
+        const double log_probability(log_constants_[k] - 0.5 * sum);
+        if (0 == k || max_log_probability < log_probability) {
+          selected_mixture = k;
+          max_log_probability = log_probability;
+        }
+        z += source_length_;
+        mu += source_length_;
+      }
+      frames_of_mixture[selected_mixture].push_back(i);
+    }
+
+    // Set E and D of the frames sharing the same mixture.
+    for (int k(0); k < num_mixture_; ++k) {
+      const std::vector<int>& frames(frames_of_mixture[k]);
+      if (frames.empty()) {
+        continue;
+      }
+      const int num_selected_frame(static_cast<int>(frames.size()));
+      transposed_block.Resize(source_length_, num_selected_frame);
+      for (int j(0); j < num_selected_frame; ++j) {
+        const double* x(source_block[frames[j]]);
         for (int m(0); m < source_length_; ++m) {
-          tmp += e_slope_[selected_mixture][l][m] * source_vectors[t][m];
+          transposed_block[m][j] = x[m];
         }
-        e[t][l] = e_bias_[selected_mixture][l] + tmp;
       }
 
-      // Set D.
-      d[t] = d_[selected_mixture];
+      const Matrix products(e_slope_[k] * transposed_block);
+      for (int j(0); j < num_selected_frame; ++j) {
+        const int t(frame_indices[frames[j]]);
+        for (int l(0); l < target_length_; ++l) {
+          e[t][l] = e_bias_[k][l] + products[l][j];
+        }
+        d[t] = d_[k];
+      }
+      frames_of_mixture[k].clear();
     }
   }
 
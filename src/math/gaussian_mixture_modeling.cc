@@ -16,9 +16,9 @@
 
 #include "SPTK/math/gaussian_mixture_modeling.h"
 
-#include <algorithm>  // std::fill, std::transform
-#include <cfloat>     // DBL_MAX
-#include <cmath>      // std::exp, std::log
+#include <algorithm>  // std::copy, std::fill, std::max, std::transform
+#include <cfloat>     // DBL_MAX, FLT_MAX
+#include <cmath>      // std::exp, std::log, std::sqrt
 #include <cstddef>    // std::size_t
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::endl
@@ -238,9 +238,16 @@ bool GaussianMixtureModeling::Run(
       }
       log_likelihood += denominator;
 
+      // Compute posteriors in place.
+      double* posteriors(&(numerators[0]));
+      for (int k(0); k < num_mixture_; ++k) {
+        posteriors[k] -= denominator;
+      }
+      sptk::Exp(posteriors, num_mixture_, posteriors);
+
       const double* x(&(input_vectors[t][0]));
       for (int k(0); k < num_mixture_; ++k) {
-        const double posterior(std::exp(numerators[k] - denominator));
+        const double posterior(posteriors[k]);
 
         // Accumulate zeroth-order statistics.
         buffer0[k] += posterior;
@@ -383,6 +390,9 @@ bool GaussianMixtureModeling::CalculateLogProbability(
   if (buffer->d_.size() != static_cast<std::size_t>(length)) {
     buffer->d_.resize(length);
   }
+  if (buffer->components_.size() != static_cast<std::size_t>(num_mixture)) {
+    buffer->components_.resize(num_mixture);
+  }
   if (buffer->gconsts_.size() != static_cast<std::size_t>(num_mixture)) {
     buffer->gconsts_.resize(num_mixture);
   }
@@ -427,7 +437,10 @@ bool GaussianMixtureModeling::CalculateLogProbability(
   }
 
   const double* x(&(input_vector[0]));
-  double total(sptk::kLogZero);
+  double* components(num_mixture <= 0 ? NULL
+                     : components_of_log_probability
+                         ? &((*components_of_log_probability)[0])
+                         : &(buffer->components_[0]));
 
   // Compute log probability of data.
   for (int k(0); k < num_mixture; ++k) {
@@ -452,17 +465,272 @@ bool GaussianMixtureModeling::CalculateLogProbability(
       }
     }
 
-    const double p(std::log(weights[k]) - 0.5 * sum);
-    if (components_of_log_probability) {
-      (*components_of_log_probability)[k] = p;
+    components[k] = std::log(weights[k]) - 0.5 * sum;
+  }
+
+  if (log_probability) {
+    *log_probability =
+        std::max(sptk::kLogZero, sptk::LogSumExp(components, num_mixture));
+  }
+
+  return true;
+}
+
+bool GaussianMixtureModeling::CalculateLogProbability(
+    int num_order, int num_mixture, bool is_diagonal, bool check_size,
+    const Matrix& input_vectors, const std::vector<double>& weights,
+    const std::vector<std::vector<double> >& mean_vectors,
+    const std::vector<SymmetricMatrix>& covariance_matrices,
+    std::vector<double>* log_probabilities,
+    GaussianMixtureModeling::Buffer* buffer) {
+  // Check inputs.
+  const int length(num_order + 1);
+  if (num_mixture < 0 || input_vectors.GetNumColumn() != length ||
+      NULL == log_probabilities || NULL == buffer) {
+    return false;
+  }
+
+  // Check size of GMM.
+  if (check_size && !CheckGmm(num_mixture, length, weights, mean_vectors,
+                              covariance_matrices)) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int num_data(input_vectors.GetNumRow());
+  if (log_probabilities->size() != static_cast<std::size_t>(num_data)) {
+    log_probabilities->resize(num_data);
+  }
+  if (buffer->log_weights_.size() != static_cast<std::size_t>(num_mixture)) {
+    buffer->log_weights_.resize(num_mixture);
+  }
+  if (buffer->components_.size() != static_cast<std::size_t>(num_mixture)) {
+    buffer->components_.resize(num_mixture);
+  }
+
+  if (!buffer->factorized_ &&
+      !Factorize(num_order, num_mixture, is_diagonal, mean_vectors,
+                 covariance_matrices, buffer)) {
+    return false;
+  }
+
+  for (int k(0); k < num_mixture; ++k) {
+    buffer->log_weights_[k] = std::log(weights[k]);
+  }
+
+  // Whiten input vectors by all mixtures at once.
+  if (!is_diagonal && 0 < num_data) {
+    buffer->whitened_vectors_ = input_vectors * buffer->whitening_matrix_;
+  }
+
+  double* p(num_mixture <= 0 ? NULL : &(buffer->components_[0]));
+  for (int t(0); t < num_data; ++t) {
+    // Compute log probability of each mixture component.
+    for (int k(0); k < num_mixture; ++k) {
+      const double* c(&(buffer->whitened_mean_vectors_[k * length]));
+      double sum(buffer->gconsts_[k]);
+      if (is_diagonal) {
+        const double* x(input_vectors[t]);
+        const double* w(buffer->whitening_matrix_[k]);
+        for (int l(0); l < length; ++l) {
+          const double diff(w[l] * x[l] - c[l]);
+          sum += diff * diff;
+        }
+      } else {
+        const double* z(buffer->whitened_vectors_[t] + k * length);
+        for (int l(0); l < length; ++l) {
+          const double diff(z[l] - c[l]);
+          sum += diff * diff;
+        }
+      }
+      p[k] = buffer->log_weights_[k] - 0.5 * sum;
     }
-    total = AddInLogSpace(total, p);
+
+    // Sum up the components in log space.
+    (*log_probabilities)[t] =
+        std::max(sptk::kLogZero, sptk::LogSumExp(p, num_mixture, true));
   }
 
+  return true;
+}
+
+bool GaussianMixtureModeling::CalculateLogProbability(
+    int num_order, int num_mixture, bool is_diagonal, bool check_size,
+    const std::vector<float>& input_vector, const std::vector<double>& weights,
+    const std::vector<std::vector<double> >& mean_vectors,
+    const std::vector<SymmetricMatrix>& covariance_matrices,
+    std::vector<float>* components_of_log_probability, float* log_probability,
+    GaussianMixtureModeling::Buffer* buffer) {
+  // Check inputs.
+  const int length(num_order + 1);
+  if (num_mixture < 0 ||
+      input_vector.size() != static_cast<std::size_t>(length) ||
+      NULL == buffer) {
+    return false;
+  }
+
+  // Check size of GMM.
+  if (check_size && !CheckGmm(num_mixture, length, weights, mean_vectors,
+                              covariance_matrices)) {
+    return false;
+  }
+
+  // Prepare memories.
+  if (components_of_log_probability &&
+      components_of_log_probability->size() !=
+          static_cast<std::size_t>(num_mixture)) {
+    components_of_log_probability->resize(num_mixture);
+  }
+  if (buffer->float_components_.size() !=
+      static_cast<std::size_t>(num_mixture)) {
+    buffer->float_components_.resize(num_mixture);
+  }
+
+  if (!buffer->factorized_ &&
+      !Factorize(num_order, num_mixture, is_diagonal, mean_vectors,
+                 covariance_matrices, buffer)) {
+    return false;
+  }
+
+  if (!buffer->float_factorized_) {
+    // Store W_k and W_k \mu_k in single precision. In the case of full
+    // covariance, unlike the matrix for a block of data, each row of W_k is
+    // stored contiguously.
+    if (is_diagonal) {
+      buffer->float_whitening_matrices_.resize(num_mixture * length);
+      for (int k(0); k < num_mixture; ++k) {
+        const double* w(buffer->whitening_matrix_[k]);
+        std::copy(w, w + length,
+                  buffer->float_whitening_matrices_.begin() + k * length);
+      }
+    } else {
+      buffer->float_whitening_matrices_.resize(num_mixture * length * length);
+      for (int k(0); k < num_mixture; ++k) {
+        float* w(&(buffer->float_whitening_matrices_[k * length * length]));
+        for (int m(0); m < length; ++m) {
+          for (int l(0); l < length; ++l) {
+            w[m * length + l] = static_cast<float>(
+                buffer->whitening_matrix_[l][k * length + m]);
+          }
+        }
+      }
+    }
+    buffer->float_whitened_mean_vectors_.assign(
+        buffer->whitened_mean_vectors_.begin(),
+        buffer->whitened_mean_vectors_.end());
+    buffer->float_factorized_ = true;
+  }
+
+  const float* x(&(input_vector[0]));
+  float* components(num_mixture <= 0 ? NULL
+                    : components_of_log_probability
+                        ? &((*components_of_log_probability)[0])
+                        : &(buffer->float_components_[0]));
+
+  // Compute log probability of each mixture component.
+  for (int k(0); k < num_mixture; ++k) {
+    const float* c(&(buffer->float_whitened_mean_vectors_[k * length]));
+    float sum(static_cast<float>(buffer->gconsts_[k]));
+    if (is_diagonal) {
+      const float* w(&(buffer->float_whitening_matrices_[k * length]));
+      for (int l(0); l < length; ++l) {
+        const float diff(w[l] * x[l] - c[l]);
+        sum += diff * diff;
+      }
+    } else {
+      const float* w(&(buffer->float_whitening_matrices_[k * length * length]));
+      for (int m(0); m < length; ++m) {
+        float z(0.0f);
+        for (int l(m); l < length; ++l) {
+          z += w[m * length + l] * x[l];
+        }
+        const float diff(z - c[m]);
+        sum += diff * diff;
+      }
+    }
+    components[k] = static_cast<float>(std::log(weights[k])) - 0.5f * sum;
+  }
+
+  // Sum up the components in log space.
   if (log_probability) {
-    *log_probability = total;
+    float max_value(static_cast<float>(sptk::kLogZero));
+    for (int k(0); k < num_mixture; ++k) {
+      max_value = std::max(max_value, components[k]);
+    }
+    float sum(0.0f);
+    if (max_value <= FLT_MAX) {
+      for (int k(0); k < num_mixture; ++k) {
+        sum += std::exp(components[k] - max_value);
+      }
+    }
+    *log_probability = 0.0f < sum ? max_value + std::log(sum) : max_value;
+  }
+
+  return true;
+}
+
+bool GaussianMixtureModeling::Factorize(
+    int num_order, int num_mixture, bool is_diagonal,
+    const std::vector<std::vector<double> >& mean_vectors,
+    const std::vector<SymmetricMatrix>& covariance_matrices,
+    GaussianMixtureModeling::Buffer* buffer) {
+  const int length(num_order + 1);
+  buffer->gconsts_.resize(num_mixture);
+  buffer->whitened_mean_vectors_.resize(num_mixture * length);
+  if (is_diagonal) {
+    buffer->whitening_matrix_.Resize(num_mixture, length);
+  } else {
+    buffer->whitening_matrix_.Resize(length, num_mixture * length);
+  }
+
+  // Precompute W_k and W_k \mu_k, where W_k^T W_k is the inverse of the
+  // covariance matrix, and constant of log likelihood without multiplying
+  // -0.5.
+  for (int k(0); k < num_mixture; ++k) {
+    const int offset(k * length);
+    const double* mu(&(mean_vectors[k][0]));
+    double log_determinant(0.0);
+    if (is_diagonal) {
+      double* w(buffer->whitening_matrix_[k]);
+      for (int l(0); l < length; ++l) {
+        const double variance(covariance_matrices[k][l][l]);
+        if (variance <= 0.0) {
+          return false;
+        }
+        w[l] = 1.0 / std::sqrt(variance);
+        buffer->whitened_mean_vectors_[offset + l] = w[l] * mu[l];
+        log_determinant += std::log(variance);
+      }
+    } else {
+      // Use the LDL^T decomposition of the precision matrix, i.e.,
+      // W_k = D^{1/2} L^T.
+      SymmetricMatrix precision_matrix;
+      SymmetricMatrix lower_triangular_matrix;
+      std::vector<double> diagonal_elements;
+      if (!covariance_matrices[k].Invert(&precision_matrix) ||
+          !precision_matrix.CholeskyDecomposition(&lower_triangular_matrix,
+                                                  &diagonal_elements)) {
+        return false;
+      }
+      for (int m(0); m < length; ++m) {
+        if (diagonal_elements[m] <= 0.0) {
+          return false;
+        }
+        const double scale(std::sqrt(diagonal_elements[m]));
+        double tmp(0.0);
+        for (int l(m); l < length; ++l) {
+          const double w(scale * lower_triangular_matrix[l][m]);
+          buffer->whitening_matrix_[l][offset + m] = w;
+          tmp += w * mu[l];
+        }
+        buffer->whitened_mean_vectors_[offset + m] = tmp;
+        log_determinant -= std::log(diagonal_elements[m]);
+      }
+    }
+    buffer->gconsts_[k] = length * std::log(sptk::kTwoPi) + log_determinant;
   }
 
+  buffer->factorized_ = true;
   return true;
 }
 
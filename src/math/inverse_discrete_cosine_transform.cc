@@ -16,29 +16,27 @@
 
 #include "SPTK/math/inverse_discrete_cosine_transform.h"
 
-#include <algorithm>   // std::copy, std::reverse, std::transform
-#include <cmath>       // std::cos, std::sin, std::sqrt
-#include <cstddef>     // std::size_t
-#include <functional>  // std::negate
+#include <cmath>    // std::cos, std::sin, std::sqrt
+#include <cstddef>  // std::size_t
 
 namespace sptk {
 
 InverseDiscreteCosineTransform::InverseDiscreteCosineTransform(int dct_length)
-    : dct_length_(dct_length), fourier_transform_(2 * dct_length) {
+    : dct_length_(dct_length), fourier_transform_(dct_length) {
   if (!fourier_transform_.IsValid()) {
     return;
   }
 
-  const int dft_length(fourier_transform_.GetLength());
-  const double argument(sptk::kPi / dft_length);
-  const double c(1.0 / std::sqrt(dft_length));
-  cosine_table_.resize(dft_length);
-  sine_table_.resize(dft_length);
+  // The factor 1/L of the inverse DFT is included.
+  const double argument(sptk::kPi / (2 * dct_length_));
+  const double c(1.0 / std::sqrt(2.0 * dct_length_));
+  cosine_table_.resize(dct_length_);
+  sine_table_.resize(dct_length_);
   cosine_table_[0] = c * std::sqrt(2.0);
   sine_table_[0] = 0.0;
-  for (int i(1); i < dft_length; ++i) {
+  for (int i(1); i < dct_length_; ++i) {
     cosine_table_[i] = std::cos(argument * i) * c;
-    sine_table_[i] = -std::sin(argument * i) * c;
+    sine_table_[i] = std::sin(argument * i) * c;
   }
 }
 
@@ -57,67 +55,114 @@ bool InverseDiscreteCosineTransform::Run(
   }
 
   // Prepare memories.
-  const int dft_length(fourier_transform_.GetLength());
+  if (real_part_output->size() != static_cast<std::size_t>(dct_length_)) {
+    real_part_output->resize(dct_length_);
+  }
+  if (imag_part_output->size() != static_cast<std::size_t>(dct_length_)) {
+    imag_part_output->resize(dct_length_);
+  }
+
+  return Transform(&(real_part_input[0]), &(imag_part_input[0]),
+                   &((*real_part_output)[0]), &((*imag_part_output)[0]),
+                   buffer);
+}
+
+bool InverseDiscreteCosineTransform::Run(
+    std::vector<double>* real_part, std::vector<double>* imag_part,
+    InverseDiscreteCosineTransform::Buffer* buffer) const {
+  if (NULL == real_part || NULL == imag_part) return false;
+  return Run(*real_part, *imag_part, real_part, imag_part, buffer);
+}
+
+bool InverseDiscreteCosineTransform::Run(
+    const Matrix& input_sequences, Matrix* output_sequences,
+    InverseDiscreteCosineTransform::Buffer* buffer) const {
+  // Check inputs.
+  const int num_sequence(input_sequences.GetNumRow());
+  if (!fourier_transform_.IsValid() ||
+      input_sequences.GetNumColumn() != dct_length_ ||
+      NULL == output_sequences || &input_sequences == output_sequences ||
+      NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  if (output_sequences->GetNumRow() != num_sequence ||
+      output_sequences->GetNumColumn() != dct_length_) {
+    output_sequences->Resize(num_sequence, dct_length_);
+  }
+
+  // Transform two sequences at once by regarding them as real and imaginary
+  // parts.
+  for (int t(0); t < num_sequence; t += 2) {
+    if (t + 1 < num_sequence) {
+      if (!Transform(input_sequences[t], input_sequences[t + 1],
+                     (*output_sequences)[t], (*output_sequences)[t + 1],
+                     buffer)) {
+        return false;
+      }
+    } else {
+      if (buffer->imag_part_output_.size() !=
+          static_cast<std::size_t>(dct_length_)) {
+        buffer->imag_part_output_.resize(dct_length_);
+      }
+      if (!Transform(input_sequences[t], NULL, (*output_sequences)[t],
+                     &(buffer->imag_part_output_[0]), buffer)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+bool InverseDiscreteCosineTransform::Transform(
+    const double* real_part_input, const double* imag_part_input,
+    double* real_part_output, double* imag_part_output,
+    InverseDiscreteCosineTransform::Buffer* buffer) const {
+  // Prepare memories.
   if (buffer->fourier_transform_real_part_.size() !=
-      static_cast<std::size_t>(dft_length)) {
-    buffer->fourier_transform_real_part_.resize(dft_length);
+      static_cast<std::size_t>(dct_length_)) {
+    buffer->fourier_transform_real_part_.resize(dct_length_);
   }
   if (buffer->fourier_transform_imag_part_.size() !=
-      static_cast<std::size_t>(dft_length)) {
-    buffer->fourier_transform_imag_part_.resize(dft_length);
+      static_cast<std::size_t>(dct_length_)) {
+    buffer->fourier_transform_imag_part_.resize(dct_length_);
   }
 
-  // Prepare real part input.
-  std::copy(real_part_input.begin(), real_part_input.end(),
-            buffer->fourier_transform_real_part_.begin());
-  std::transform(real_part_input.begin() + 1, real_part_input.end(),
-                 buffer->fourier_transform_real_part_.begin() + dct_length_ + 1,
-                 std::negate<double>());
-  std::reverse(buffer->fourier_transform_real_part_.begin() + dct_length_ + 1,
-               buffer->fourier_transform_real_part_.end());
-  buffer->fourier_transform_real_part_[dct_length_] = 0.0;
-
-  // Prepare imaginary part input.
-  std::copy(imag_part_input.begin(), imag_part_input.end(),
-            buffer->fourier_transform_imag_part_.begin());
-  std::transform(imag_part_input.begin() + 1, imag_part_input.end(),
-                 buffer->fourier_transform_imag_part_.begin() + dct_length_ + 1,
-                 std::negate<double>());
-  std::reverse(buffer->fourier_transform_imag_part_.begin() + dct_length_ + 1,
-               buffer->fourier_transform_imag_part_.end());
-  buffer->fourier_transform_imag_part_[dct_length_] = 0.0;
-
+  // Multiply input by twiddle factors. The inverse DFT is computed by the
+  // forward one with conjugation, so that the conjugate is stored here. A null
+  // imaginary part is regarded as zeros.
   const double* cosine_table(&(cosine_table_[0]));
   const double* sine_table(&(sine_table_[0]));
-  double* fourier_transform_real_part(&buffer->fourier_transform_real_part_[0]);
-  double* fourier_transform_imag_part(&buffer->fourier_transform_imag_part_[0]);
-
-  for (int i(0); i < dft_length; ++i) {
-    const double temp_real_part(fourier_transform_real_part[i]);
-    const double temp_imag_part(fourier_transform_imag_part[i]);
-    fourier_transform_real_part[i] =
-        temp_real_part * cosine_table[i] - temp_imag_part * sine_table[i];
-    fourier_transform_imag_part[i] =
-        temp_real_part * sine_table[i] + temp_imag_part * cosine_table[i];
+  double* v_real(&buffer->fourier_transform_real_part_[0]);
+  double* v_imag(&buffer->fourier_transform_imag_part_[0]);
+  for (int k(0); k < dct_length_; ++k) {
+    const int l(dct_length_ - k);
+    const double real_k(real_part_input[k]);
+    const double real_l(0 == k ? 0.0 : real_part_input[l]);
+    const double imag_k(NULL == imag_part_input ? 0.0 : imag_part_input[k]);
+    const double imag_l(NULL == imag_part_input || 0 == k ? 0.0
+                                                          : imag_part_input[l]);
+    const double a(real_k + imag_l);
+    const double b(real_l - imag_k);
+    v_real[k] = cosine_table[k] * a + sine_table[k] * b;
+    v_imag[k] = cosine_table[k] * b - sine_table[k] * a;
   }
 
-  if (!fourier_transform_.Run(buffer->fourier_transform_real_part_,
-                              buffer->fourier_transform_imag_part_,
-                              real_part_output, imag_part_output)) {
+  if (!fourier_transform_.Run(&buffer->fourier_transform_real_part_,
+                              &buffer->fourier_transform_imag_part_)) {
     return false;
   }
 
-  real_part_output->resize(dct_length_);
-  imag_part_output->resize(dct_length_);
+  // Reorder output as x(0), x(2), ..., x(3), x(1).
+  for (int n(0); n < dct_length_; ++n) {
+    const int i(0 == n % 2 ? n / 2 : dct_length_ - 1 - n / 2);
+    real_part_output[n] = v_real[i];
+    imag_part_output[n] = -v_imag[i];
+  }
 
   return true;
 }
 
-bool InverseDiscreteCosineTransform::Run(
-    std::vector<double>* real_part, std::vector<double>* imag_part,
-    InverseDiscreteCosineTransform::Buffer* buffer) const {
-  if (NULL == real_part || NULL == imag_part) return false;
-  return Run(*real_part, *imag_part, real_part, imag_part, buffer);
-}
-
 }  // namespace sptk
@@ -0,0 +1,210 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/math/inverse_short_time_fourier_transform.h"
+
+#include <algorithm>  // std::fill, std::max, std::max_element, std::min
+#include <cstddef>    // std::size_t
+
+namespace {
+
+// Relative threshold of the sum of squared windows below which the samples are
+// not reconstructed.
+const double kMinimumRelativeWeight(1e-12);
+
+}  // namespace
+
+namespace sptk {
+
+InverseShortTimeFourierTransform::InverseShortTimeFourierTransform(
+    WindowInterface* window, int frame_period, int fft_length,
+    DataWindowing::NormalizationType normalization_type)
+    : frame_length_(window ? window->GetWindowLength() : 0),
+      frame_period_(frame_period),
+      fft_length_(fft_length),
+      ring_buffer_length_(std::max(frame_length_, frame_period_)),
+      inverse_fast_fourier_transform_(fft_length_ - 1, fft_length_),
+      is_valid_(true),
+      minimum_weight_(0.0) {
+  if (frame_length_ <= 0 || frame_period_ <= 0 ||
+      fft_length_ < frame_length_ ||
+      !inverse_fast_fourier_transform_.IsValid()) {
+    is_valid_ = false;
+    return;
+  }
+
+  // Get normalized window by windowing ones.
+  const DataWindowing data_windowing(window, frame_length_,
+                                     normalization_type);
+  if (!data_windowing.IsValid() ||
+      !data_windowing.Run(std::vector<double>(frame_length_, 1.0),
+                          &window_)) {
+    is_valid_ = false;
+    return;
+  }
+
+  const double maximum_weight(
+      std::max(*std::max_element(window_.begin(), window_.end()),
+               -*std::min_element(window_.begin(), window_.end())));
+  minimum_weight_ = kMinimumRelativeWeight * maximum_weight * maximum_weight;
+  if (0.0 == minimum_weight_) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+void InverseShortTimeFourierTransform::Clear(
+    InverseShortTimeFourierTransform::Buffer* buffer) const {
+  if (NULL != buffer) {
+    buffer->weighted_signal_.resize(ring_buffer_length_);
+    buffer->weight_.resize(ring_buffer_length_);
+    std::fill(buffer->weighted_signal_.begin(),
+              buffer->weighted_signal_.end(), 0.0);
+    std::fill(buffer->weight_.begin(), buffer->weight_.end(), 0.0);
+    buffer->position_ = 0;
+  }
+}
+
+bool InverseShortTimeFourierTransform::Run(
+    const std::vector<double>& real_part, const std::vector<double>& imag_part,
+    std::vector<double>* waveform,
+    InverseShortTimeFourierTransform::Buffer* buffer) const {
+  // Check inputs.
+  const int input_length(fft_length_ / 2 + 1);
+  if (!is_valid_ ||
+      real_part.size() != static_cast<std::size_t>(input_length) ||
+      imag_part.size() != static_cast<std::size_t>(input_length) ||
+      NULL == waveform || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  if (buffer->weighted_signal_.size() !=
+      static_cast<std::size_t>(ring_buffer_length_)) {
+    Clear(buffer);
+  }
+  if (buffer->real_part_input_.size() !=
+      static_cast<std::size_t>(fft_length_)) {
+    buffer->real_part_input_.resize(fft_length_);
+  }
+  if (buffer->imag_part_input_.size() !=
+      static_cast<std::size_t>(fft_length_)) {
+    buffer->imag_part_input_.resize(fft_length_);
+  }
+  if (waveform->size() != static_cast<std::size_t>(frame_period_)) {
+    waveform->resize(frame_period_);
+  }
+
+  // Expand spectrum using Hermitian symmetry.
+  {
+    const double* xr(&(real_part[0]));
+    const double* xi(&(imag_part[0]));
+    double* yr(&(buffer->real_part_input_[0]));
+    double* yi(&(buffer->imag_part_input_[0]));
+    for (int k(0); k < input_length; ++k) {
+      yr[k] = xr[k];
+      yi[k] = xi[k];
+    }
+    for (int k(input_length); k < fft_length_; ++k) {
+      yr[k] = xr[fft_length_ - k];
+      yi[k] = -xi[fft_length_ - k];
+    }
+  }
+
+  // The inverse DFTs of the real and imaginary parts are real and purely
+  // imaginary, respectively, so the frame is obtained by two real-valued FFTs.
+  // Note that the imaginary part of the real-valued inverse FFT is conjugated.
+  if (!inverse_fast_fourier_transform_.Run(
+          buffer->real_part_input_,
+          &buffer->real_part_output_for_real_part_input_,
+          &buffer->imag_part_output_for_real_part_input_,
+          &buffer->inverse_fast_fourier_transform_buffer_) ||
+      !inverse_fast_fourier_transform_.Run(
+          buffer->imag_part_input_,
+          &buffer->real_part_output_for_imag_part_input_,
+          &buffer->imag_part_output_for_imag_part_input_,
+          &buffer->inverse_fast_fourier_transform_buffer_)) {
+    return false;
+  }
+
+  // Overlap-add windowed frame. The current frame starts at the current
+  // position.
+  {
+    const int head_length(
+        std::min(frame_length_, ring_buffer_length_ - buffer->position_));
+    const double* a(&(buffer->real_part_output_for_real_part_input_[0]));
+    const double* b(&(buffer->imag_part_output_for_imag_part_input_[0]));
+    const double* w(&(window_[0]));
+    double* y(&(buffer->weighted_signal_[0]));
+    double* z(&(buffer->weight_[0]));
+    for (int i(0); i < head_length; ++i) {
+      y[buffer->position_ + i] += w[i] * (a[i] + b[i]);
+      z[buffer->position_ + i] += w[i] * w[i];
+    }
+    for (int i(head_length); i < frame_length_; ++i) {
+      y[i - head_length] += w[i] * (a[i] + b[i]);
+      z[i - head_length] += w[i] * w[i];
+    }
+  }
+
+  // The samples before the next frame are no longer changed.
+  Output(frame_period_, &((*waveform)[0]), buffer);
+
+  return true;
+}
+
+bool InverseShortTimeFourierTransform::Flush(
+    std::vector<double>* waveform,
+    InverseShortTimeFourierTransform::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || NULL == waveform || NULL == buffer) {
+    return false;
+  }
+
+  const int output_length(std::max(0, frame_length_ - frame_period_));
+  if (waveform->size() != static_cast<std::size_t>(output_length)) {
+    waveform->resize(output_length);
+  }
+
+  if (buffer->weighted_signal_.size() !=
+      static_cast<std::size_t>(ring_buffer_length_)) {
+    Clear(buffer);
+  }
+  if (0 < output_length) {
+    Output(output_length, &((*waveform)[0]), buffer);
+  }
+  Clear(buffer);
+
+  return true;
+}
+
+void InverseShortTimeFourierTransform::Output(
+    int num_sample, double* waveform,
+    InverseShortTimeFourierTransform::Buffer* buffer) const {
+  double* y(&(buffer->weighted_signal_[0]));
+  double* z(&(buffer->weight_[0]));
+  for (int i(0); i < num_sample; ++i) {
+    const int j(buffer->position_);
+    waveform[i] = minimum_weight_ < z[j] ? y[j] / z[j] : 0.0;
+    y[j] = 0.0;
+    z[j] = 0.0;
+    if (ring_buffer_length_ == ++buffer->position_) {
+      buffer->position_ = 0;
+    }
+  }
+}
+
+}  // namespace sptk
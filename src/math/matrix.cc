@@ -16,15 +16,105 @@
 
 #include "SPTK/math/matrix.h"
 
-#include <algorithm>   // std::fill, std::min, std::transform
+#include <algorithm>   // std::fill, std::max, std::min, std::transform
+#include <cstddef>     // std::size_t
 #include <functional>  // std::minus, std::negate, std::plus
 #include <stdexcept>   // std::logic_error, std::out_of_range
 
+#include "SPTK/utils/thread_utils.h"
+
 namespace {
 
 const char* kErrorMessageForOutOfRange("Matrix: Out of range");
 const char* kErrorMessageForLogicError("Matrix: Matrix sizes do not match");
 
+// Block sizes are chosen so that a block of the right matrix fits in L2 cache.
+const int kNumRowOfMicroKernel(4);
+const int kBlockSizeOfInnerDimension(128);
+const int kBlockSizeOfColumn(256);
+const double kMinNumOperationForMultithreading(4194304.0);
+const int kBlockSizeOfTranspose(16);
+
+// Compute rows [begin, end) of C += A * B, where all matrices are stored in
+// row-major order. Each element of C is accumulated in the same order as in
+// the naive triple loop.
+void MultiplyRows(const double* a, const double* b, int begin, int end,
+                  int num_inner, int num_column, double* c) {
+  for (int kk(0); kk < num_inner; kk += kBlockSizeOfInnerDimension) {
+    const int k_end(std::min(kk + kBlockSizeOfInnerDimension, num_inner));
+    for (int jj(0); jj < num_column; jj += kBlockSizeOfColumn) {
+      const int j_end(std::min(jj + kBlockSizeOfColumn, num_column));
+      int i(begin);
+      for (; i + kNumRowOfMicroKernel <= end; i += kNumRowOfMicroKernel) {
+        const double* a0(a + i * num_inner);
+        const double* a1(a0 + num_inner);
+        const double* a2(a1 + num_inner);
+        const double* a3(a2 + num_inner);
+        double* c0(c + i * num_column);
+        double* c1(c0 + num_column);
+        double* c2(c1 + num_column);
+        double* c3(c2 + num_column);
+        for (int k(kk); k < k_end; ++k) {
+          const double* bk(b + k * num_column);
+          const double x0(a0[k]);
+          const double x1(a1[k]);
+          const double x2(a2[k]);
+          const double x3(a3[k]);
+          for (int j(jj); j < j_end; ++j) {
+            const double y(bk[j]);
+            c0[j] += x0 * y;
+            c1[j] += x1 * y;
+            c2[j] += x2 * y;
+            c3[j] += x3 * y;
+          }
+        }
+      }
+      for (; i < end; ++i) {
+        const double* ai(a + i * num_inner);
+        double* ci(c + i * num_column);
+        for (int k(kk); k < k_end; ++k) {
+          const double* bk(b + k * num_column);
+          const double x(ai[k]);
+          for (int j(jj); j < j_end; ++j) {
+            ci[j] += x * bk[j];
+          }
+        }
+      }
+    }
+  }
+}
+
+// Transpose the submatrix [row_begin, row_end) x [column_begin, column_end)
+// of A into B. The longer side is halved recursively so that both matrices are
+// accessed in cache-sized blocks regardless of the cache size.
+void TransposeBlock(const double* a, int num_column_of_a, int row_begin,
+                    int row_end, int column_begin, int column_end, double* b,
+                    int num_column_of_b) {
+  const int num_row(row_end - row_begin);
+  const int num_column(column_end - column_begin);
+  if (num_row <= kBlockSizeOfTranspose &&
+      num_column <= kBlockSizeOfTranspose) {
+    for (int i(row_begin); i < row_end; ++i) {
+      const double* a_i(a + i * num_column_of_a);
+      for (int j(column_begin); j < column_end; ++j) {
+        b[j * num_column_of_b + i] = a_i[j];
+      }
+    }
+  } else if (num_column <= num_row) {
+    const int row_middle(row_begin + num_row / 2);
+    TransposeBlock(a, num_column_of_a, row_begin, row_middle, column_begin,
+                   column_end, b, num_column_of_b);
+    TransposeBlock(a, num_column_of_a, row_middle, row_end, column_begin,
+                   column_end, b, num_column_of_b);
+  } else {
+    const int column_middle(column_begin + num_column / 2);
+    TransposeBlock(a, num_column_of_a, row_begin, row_end, column_begin,
+                   column_middle, b, num_column_of_b);
+    TransposeBlock(a, num_column_of_a, row_begin, row_end, column_middle,
+                   column_end, b, num_column_of_b);
+  }
+}
+
 }  // namespace
 
 namespace sptk {
@@ -139,13 +229,33 @@ Matrix Matrix::operator*(const Matrix& matrix) const {
     throw std::logic_error(kErrorMessageForLogicError);
   }
   Matrix result(num_row_, matrix.num_column_);
-  for (int i(0); i < num_row_; ++i) {
-    for (int j(0); j < matrix.num_column_; ++j) {
-      for (int k(0); k < num_column_; ++k) {
-        result.index_[i][j] += index_[i][k] * matrix.index_[k][j];
-      }
-    }
+  if (result.data_.empty() || 0 == num_column_) {
+    return result;
   }
+
+  if (1 == matrix.num_column_) {
+    Multiply(matrix.data_, &result.data_);
+    return result;
+  }
+
+  const double* a(&(data_[0]));
+  const double* b(&(matrix.data_[0]));
+  double* c(&(result.data_[0]));
+
+  // Split rows into threads if the product is large enough.
+  const double num_operation(static_cast<double>(num_row_) * num_column_ *
+                             matrix.num_column_);
+  const int num_thread(GetNumThread(num_operation,
+                                    kMinNumOperationForMultithreading,
+                                    num_row_ / kNumRowOfMicroKernel));
+  const int num_inner(num_column_);
+  const int num_column(matrix.num_column_);
+  ProcessRowsInParallel(num_row_, num_thread, kNumRowOfMicroKernel,
+                        [=](int begin, int end) {
+                          MultiplyRows(a, b, begin, end, num_inner, num_column,
+                                       c);
+                          return true;
+                        });
   return result;
 }
 
@@ -155,6 +265,29 @@ Matrix Matrix::operator-() const {
   return result;
 }
 
+bool Matrix::Multiply(const std::vector<double>& vector,
+                      std::vector<double>* product) const {
+  if (vector.size() != static_cast<std::size_t>(num_column_) ||
+      NULL == product || &vector == product) {
+    return false;
+  }
+
+  if (product->size() != static_cast<std::size_t>(num_row_)) {
+    product->resize(num_row_);
+  }
+
+  for (int i(0); i < num_row_; ++i) {
+    const double* a(index_[i]);
+    double sum(0.0);
+    for (int k(0); k < num_column_; ++k) {
+      sum += a[k] * vector[k];
+    }
+    (*product)[i] = sum;
+  }
+
+  return true;
+}
+
 void Matrix::Fill(double value) {
   std::fill(data_.begin(), data_.end(), value);
 }
@@ -182,10 +315,9 @@ bool Matrix::Transpose(Matrix* transposed_matrix) const {
     transposed_matrix->Resize(num_column_, num_row_);
   }
 
-  for (int i(0); i < num_column_; ++i) {
-    for (int j(0); j < num_row_; ++j) {
-      transposed_matrix->index_[i][j] = index_[j][i];
-    }
+  if (!data_.empty()) {
+    TransposeBlock(&(data_[0]), num_column_, 0, num_row_, 0, num_column_,
+                   &(transposed_matrix->data_[0]), num_row_);
   }
 
   return true;
@@ -16,29 +16,379 @@
 
 #include "SPTK/math/principal_component_analysis.h"
 
-#include <algorithm>  // std::sort, std::swap
+#include <algorithm>  // std::copy, std::fill, std::max, std::min, etc.
+#include <cfloat>     // DBL_EPSILON
 #include <cmath>      // std::fabs, std::sqrt
 #include <cstddef>    // std::size_t
 #include <numeric>    // std::iota
 
+#include "SPTK/generation/normal_distributed_random_value_generation.h"
+
+namespace {
+
+const int kNumOversample(10);
+const int kNumPowerIteration(4);
+const int kSeed(1);
+
+double Hypotenuse(double a, double b) {
+  return std::sqrt(a * a + b * b);
+}
+
+// Reduce a symmetric matrix to a tridiagonal matrix by Householder
+// transformations. On output, the columns of v are the accumulated
+// orthogonal transformation, d is the diagonal, and e is the subdiagonal.
+void Tridiagonalize(int n, sptk::Matrix* v, double* d, double* e) {
+  sptk::Matrix& V(*v);
+  for (int j(0); j < n; ++j) {
+    d[j] = V[n - 1][j];
+  }
+
+  for (int i(n - 1); 0 < i; --i) {
+    double scale(0.0);
+    double h(0.0);
+    for (int k(0); k < i; ++k) {
+      scale += std::fabs(d[k]);
+    }
+    if (0.0 == scale) {
+      e[i] = d[i - 1];
+      for (int j(0); j < i; ++j) {
+        d[j] = V[i - 1][j];
+        V[i][j] = 0.0;
+        V[j][i] = 0.0;
+      }
+    } else {
+      // Generate Householder vector.
+      for (int k(0); k < i; ++k) {
+        d[k] /= scale;
+        h += d[k] * d[k];
+      }
+      double f(d[i - 1]);
+      double g(std::sqrt(h));
+      if (0.0 < f) g = -g;
+      e[i] = scale * g;
+      h -= f * g;
+      d[i - 1] = f - g;
+      for (int j(0); j < i; ++j) {
+        e[j] = 0.0;
+      }
+
+      // Apply similarity transformation to remaining columns.
+      for (int j(0); j < i; ++j) {
+        f = d[j];
+        V[j][i] = f;
+        g = e[j] + V[j][j] * f;
+        for (int k(j + 1); k < i; ++k) {
+          g += V[k][j] * d[k];
+          e[k] += V[k][j] * f;
+        }
+        e[j] = g;
+      }
+      f = 0.0;
+      for (int j(0); j < i; ++j) {
+        e[j] /= h;
+        f += e[j] * d[j];
+      }
+      const double hh(f / (h + h));
+      for (int j(0); j < i; ++j) {
+        e[j] -= hh * d[j];
+      }
+      for (int j(0); j < i; ++j) {
+        f = d[j];
+        g = e[j];
+        for (int k(j); k < i; ++k) {
+          V[k][j] -= (f * e[k] + g * d[k]);
+        }
+        d[j] = V[i - 1][j];
+        V[i][j] = 0.0;
+      }
+    }
+    d[i] = h;
+  }
+
+  // Accumulate transformations.
+  for (int i(0); i < n - 1; ++i) {
+    V[n - 1][i] = V[i][i];
+    V[i][i] = 1.0;
+    const double h(d[i + 1]);
+    if (0.0 != h) {
+      for (int k(0); k <= i; ++k) {
+        d[k] = V[k][i + 1] / h;
+      }
+      for (int j(0); j <= i; ++j) {
+        double g(0.0);
+        for (int k(0); k <= i; ++k) {
+          g += V[k][i + 1] * V[k][j];
+        }
+        for (int k(0); k <= i; ++k) {
+          V[k][j] -= g * d[k];
+        }
+      }
+    }
+    for (int k(0); k <= i; ++k) {
+      V[k][i + 1] = 0.0;
+    }
+  }
+  for (int j(0); j < n; ++j) {
+    d[j] = V[n - 1][j];
+    V[n - 1][j] = 0.0;
+  }
+  V[n - 1][n - 1] = 1.0;
+  e[0] = 0.0;
+}
+
+// Diagonalize a tridiagonal matrix by the implicit QL method. The rows of w
+// are the eigenvectors, i.e., w is the transposed output of Tridiagonalize.
+bool Diagonalize(int n, int num_iteration, sptk::Matrix* w, double* d,
+                 double* e) {
+  sptk::Matrix& W(*w);
+  for (int i(1); i < n; ++i) {
+    e[i - 1] = e[i];
+  }
+  e[n - 1] = 0.0;
+
+  double f(0.0);
+  double tst1(0.0);
+  for (int l(0); l < n; ++l) {
+    // Find small subdiagonal element.
+    tst1 = std::max(tst1, std::fabs(d[l]) + std::fabs(e[l]));
+    int m(l);
+    while (m < n - 1) {
+      if (std::fabs(e[m]) <= DBL_EPSILON * tst1) break;
+      ++m;
+    }
+
+    if (l < m) {
+      int iter(0);
+      do {
+        if (num_iteration < ++iter) {
+          return false;
+        }
+
+        // Compute implicit shift.
+        double g(d[l]);
+        double p((d[l + 1] - g) / (2.0 * e[l]));
+        double r(Hypotenuse(p, 1.0));
+        if (p < 0.0) r = -r;
+        d[l] = e[l] / (p + r);
+        d[l + 1] = e[l] * (p + r);
+        const double dl1(d[l + 1]);
+        double h(g - d[l]);
+        for (int i(l + 2); i < n; ++i) {
+          d[i] -= h;
+        }
+        f += h;
+
+        // Implicit QL transformation.
+        p = d[m];
+        double c(1.0);
+        double c2(c);
+        double c3(c);
+        const double el1(e[l + 1]);
+        double s(0.0);
+        double s2(0.0);
+        for (int i(m - 1); l <= i; --i) {
+          c3 = c2;
+          c2 = c;
+          s2 = s;
+          g = c * e[i];
+          h = c * p;
+          r = Hypotenuse(p, e[i]);
+          e[i + 1] = s * r;
+          s = e[i] / r;
+          c = p / r;
+          p = c * d[i] - s * g;
+          d[i + 1] = h + s * (c * g + s * d[i]);
+
+          // Accumulate transformation.
+          double* w0(W[i]);
+          double* w1(W[i + 1]);
+          for (int k(0); k < n; ++k) {
+            const double tmp(w1[k]);
+            w1[k] = s * w0[k] + c * tmp;
+            w0[k] = c * w0[k] - s * tmp;
+          }
+        }
+        p = -s * s2 * c3 * el1 * e[l] / dl1;
+        e[l] = s * p;
+        d[l] = c * p;
+      } while (DBL_EPSILON * tst1 < std::fabs(e[l]));
+    }
+    d[l] += f;
+    e[l] = 0.0;
+  }
+
+  return true;
+}
+
+// Compute eigenvalues and eigenvectors of a symmetric matrix. On input, a is
+// the symmetric matrix. On output, the rows of a are the eigenvectors.
+bool DecomposeSymmetricMatrix(int num_iteration, sptk::Matrix* a,
+                              std::vector<double>* d, std::vector<double>* e) {
+  const int n(a->GetNumRow());
+  if (d->size() != static_cast<std::size_t>(n)) {
+    d->resize(n);
+  }
+  if (e->size() != static_cast<std::size_t>(n)) {
+    e->resize(n);
+  }
+  if (1 == n) {
+    (*d)[0] = (*a)[0][0];
+    (*a)[0][0] = 1.0;
+    return true;
+  }
+
+  Tridiagonalize(n, a, &((*d)[0]), &((*e)[0]));
+
+  // Transpose in place so that the rotations in the QL method access rows.
+  for (int i(0); i < n; ++i) {
+    for (int j(i + 1); j < n; ++j) {
+      std::swap((*a)[i][j], (*a)[j][i]);
+    }
+  }
+
+  return Diagonalize(n, num_iteration, a, &((*d)[0]), &((*e)[0]));
+}
+
+// Orthonormalize rows of a matrix by the modified Gram-Schmidt process with
+// reorthogonalization. Linearly dependent rows are set to zeros.
+void Orthonormalize(sptk::Matrix* q) {
+  const int num_row(q->GetNumRow());
+  const int num_column(q->GetNumColumn());
+  for (int j(0); j < num_row; ++j) {
+    double* qj((*q)[j]);
+    double original_norm(0.0);
+    for (int k(0); k < num_column; ++k) {
+      original_norm += qj[k] * qj[k];
+    }
+    original_norm = std::sqrt(original_norm);
+
+    for (int pass(0); pass < 2; ++pass) {
+      for (int i(0); i < j; ++i) {
+        const double* qi((*q)[i]);
+        double r(0.0);
+        for (int k(0); k < num_column; ++k) {
+          r += qi[k] * qj[k];
+        }
+        for (int k(0); k < num_column; ++k) {
+          qj[k] -= r * qi[k];
+        }
+      }
+    }
+
+    double norm(0.0);
+    for (int k(0); k < num_column; ++k) {
+      norm += qj[k] * qj[k];
+    }
+    norm = std::sqrt(norm);
+    if (norm <= 1e-10 * original_norm || 0.0 == norm) {
+      std::fill(qj, qj + num_column, 0.0);
+    } else {
+      const double z(1.0 / norm);
+      for (int k(0); k < num_column; ++k) {
+        qj[k] *= z;
+      }
+    }
+  }
+}
+
+// Compute z = q * a, where a is a symmetric matrix, i.e., each row of z is the
+// product of a and the corresponding row of q.
+void MultiplySymmetricMatrix(const sptk::Matrix& q, const sptk::Matrix& a,
+                             sptk::Matrix* z) {
+  const int num_row(q.GetNumRow());
+  const int n(a.GetNumRow());
+  if (z->GetNumRow() != num_row || z->GetNumColumn() != n) {
+    z->Resize(num_row, n);
+  } else {
+    z->Fill(0.0);
+  }
+  for (int j(0); j < num_row; ++j) {
+    const double* qj(q[j]);
+    double* zj((*z)[j]);
+    for (int i(0); i < n; ++i) {
+      const double x(qj[i]);
+      if (0.0 == x) continue;
+      const double* ai(a[i]);
+      for (int k(0); k < n; ++k) {
+        zj[k] += x * ai[k];
+      }
+    }
+  }
+}
+
+// Sort eigenvalues in descending order and copy the corresponding rows.
+void SortEigenvalues(const std::vector<double>& d, const sptk::Matrix& v,
+                     int num_output, std::vector<int>* order,
+                     std::vector<double>* eigenvalues,
+                     sptk::Matrix* eigenvectors) {
+  const int n(static_cast<int>(d.size()));
+  if (order->size() != static_cast<std::size_t>(n)) {
+    order->resize(n);
+  }
+  std::iota(order->begin(), order->end(), 0);
+  std::stable_sort(order->begin(), order->end(),
+                   [&d](int i, int j) { return d[j] < d[i]; });
+  const int num_column(v.GetNumColumn());
+  for (int i(0); i < num_output; ++i) {
+    const int j((*order)[i]);
+    (*eigenvalues)[i] = d[j];
+    std::copy(v[j], v[j] + num_column, (*eigenvectors)[i]);
+  }
+}
+
+}  // namespace
+
 namespace sptk {
 
 PrincipalComponentAnalysis::PrincipalComponentAnalysis(
     int num_order, int num_iteration, double convergence_threshold,
-    CovarianceType covariance_type)
+    CovarianceType covariance_type, EigensolverType eigensolver_type,
+    int num_principal_component)
     : num_order_(num_order),
       num_iteration_(num_iteration),
       convergence_threshold_(convergence_threshold),
       covariance_type_(covariance_type),
+      eigensolver_type_(eigensolver_type),
+      num_principal_component_(num_principal_component),
       accumulation_(num_order, 2),
       is_valid_(true) {
   if (num_order_ < 0 || num_iteration_ <= 0 || convergence_threshold_ < 0.0 ||
-      kNumCovarianceTypes == covariance_type_ || !accumulation_.IsValid()) {
+      kNumCovarianceTypes == covariance_type_ ||
+      kNumEigensolverTypes == eigensolver_type_ ||
+      (kRandomized == eigensolver_type_ &&
+       !IsInRange(num_principal_component_, 1, num_order_ + 1)) ||
+      !accumulation_.IsValid()) {
     is_valid_ = false;
     return;
   }
 }
 
+void PrincipalComponentAnalysis::Clear(
+    PrincipalComponentAnalysis::Buffer* buffer) const {
+  if (NULL != buffer) {
+    accumulation_.Clear(&buffer->buffer_for_accumulation);
+  }
+}
+
+bool PrincipalComponentAnalysis::Accumulate(
+    const std::vector<double>& input_vector,
+    PrincipalComponentAnalysis::Buffer* buffer) const {
+  if (!is_valid_ || NULL == buffer) {
+    return false;
+  }
+  return accumulation_.Run(input_vector, &buffer->buffer_for_accumulation);
+}
+
+bool PrincipalComponentAnalysis::Merge(
+    const PrincipalComponentAnalysis::Buffer& other,
+    PrincipalComponentAnalysis::Buffer* buffer) const {
+  if (!is_valid_ || NULL == buffer) {
+    return false;
+  }
+  return accumulation_.Merge(other.buffer_for_accumulation,
+                             &buffer->buffer_for_accumulation);
+}
+
 bool PrincipalComponentAnalysis::Run(
     const std::vector<std::vector<double> >& input_vectors,
     std::vector<double>* mean_vector, std::vector<double>* eigenvalues,
@@ -49,6 +399,26 @@ bool PrincipalComponentAnalysis::Run(
     return false;
   }
 
+  // Calculate statistics.
+  Clear(buffer);
+  for (const std::vector<double>& input_vector : input_vectors) {
+    if (!Accumulate(input_vector, buffer)) {
+      return false;
+    }
+  }
+
+  return Run(mean_vector, eigenvalues, eigenvectors, buffer);
+}
+
+bool PrincipalComponentAnalysis::Run(
+    std::vector<double>* mean_vector, std::vector<double>* eigenvalues,
+    Matrix* eigenvectors, PrincipalComponentAnalysis::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || NULL == mean_vector || NULL == eigenvalues ||
+      NULL == eigenvectors || NULL == buffer) {
+    return false;
+  }
+
   // Prepare memories.
   const int length(num_order_ + 1);
   if (eigenvalues->size() != static_cast<std::size_t>(length)) {
@@ -63,12 +433,6 @@ bool PrincipalComponentAnalysis::Run(
   }
 
   // Calculate statistics.
-  accumulation_.Clear(&buffer->buffer_for_accumulation);
-  for (const std::vector<double>& input_vector : input_vectors) {
-    if (!accumulation_.Run(input_vector, &buffer->buffer_for_accumulation)) {
-      return false;
-    }
-  }
   if (!accumulation_.GetMean(buffer->buffer_for_accumulation, mean_vector)) {
     return false;
   }
@@ -99,6 +463,29 @@ bool PrincipalComponentAnalysis::Run(
     }
   }
 
+  switch (eigensolver_type_) {
+    case kJacobi: {
+      return RunJacobi(eigenvalues, eigenvectors, buffer);
+    }
+    case kHouseholderQl: {
+      return RunHouseholderQl(eigenvalues, eigenvectors, buffer);
+    }
+    case kRandomized: {
+      return RunRandomized(eigenvalues, eigenvectors, buffer);
+    }
+    default: {
+      break;
+    }
+  }
+
+  return false;
+}
+
+bool PrincipalComponentAnalysis::RunJacobi(
+    std::vector<double>* eigenvalues, Matrix* eigenvectors,
+    PrincipalComponentAnalysis::Buffer* buffer) const {
+  const int length(num_order_ + 1);
+
   // Initialize eigenvector matrix with identity matrix.
   eigenvectors->FillDiagonal(1.0);
 
@@ -192,4 +579,140 @@ bool PrincipalComponentAnalysis::Run(
   return true;
 }
 
+bool PrincipalComponentAnalysis::RunHouseholderQl(
+    std::vector<double>* eigenvalues, Matrix* eigenvectors,
+    PrincipalComponentAnalysis::Buffer* buffer) const {
+  const int length(num_order_ + 1);
+
+  // Expand symmetric matrix.
+  Matrix& a(buffer->full_a_);
+  if (a.GetNumRow() != length || a.GetNumColumn() != length) {
+    a.Resize(length, length);
+  }
+  for (int i(0); i < length; ++i) {
+    for (int j(0); j <= i; ++j) {
+      a[i][j] = a[j][i] = buffer->a_[i][j];
+    }
+  }
+
+  if (!DecomposeSymmetricMatrix(num_iteration_, &a, &buffer->d_,
+                                &buffer->e_)) {
+    return false;
+  }
+
+  SortEigenvalues(buffer->d_, a, length, &buffer->order_of_eigenvalue_,
+                  eigenvalues, eigenvectors);
+
+  return true;
+}
+
+bool PrincipalComponentAnalysis::RunRandomized(
+    std::vector<double>* eigenvalues, Matrix* eigenvectors,
+    PrincipalComponentAnalysis::Buffer* buffer) const {
+  const int length(num_order_ + 1);
+  const int num_basis(
+      std::min(length, num_principal_component_ + kNumOversample));
+
+  // Expand symmetric matrix.
+  Matrix& a(buffer->full_a_);
+  if (a.GetNumRow() != length || a.GetNumColumn() != length) {
+    a.Resize(length, length);
+  }
+  double trace(0.0);
+  for (int i(0); i < length; ++i) {
+    for (int j(0); j <= i; ++j) {
+      a[i][j] = a[j][i] = buffer->a_[i][j];
+    }
+    trace += a[i][i];
+  }
+
+  // Draw random basis.
+  Matrix* x(&buffer->q_);
+  Matrix* y(&buffer->z_);
+  if (x->GetNumRow() != num_basis || x->GetNumColumn() != length) {
+    x->Resize(num_basis, length);
+  }
+  {
+    NormalDistributedRandomValueGeneration random_value_generation(kSeed);
+    for (int j(0); j < num_basis; ++j) {
+      for (int k(0); k < length; ++k) {
+        if (!random_value_generation.Get(&((*x)[j][k]))) {
+          return false;
+        }
+      }
+    }
+  }
+
+  // Find orthonormal basis of the dominant subspace by subspace iteration.
+  // The buffers are swapped by pointers to avoid copying matrices.
+  MultiplySymmetricMatrix(*x, a, y);
+  for (int n(0); n < kNumPowerIteration; ++n) {
+    Orthonormalize(y);
+    MultiplySymmetricMatrix(*y, a, x);
+    std::swap(x, y);
+  }
+  Matrix& q(*y);
+  Matrix& z(*x);
+  Orthonormalize(&q);
+
+  // Project symmetric matrix onto the subspace.
+  MultiplySymmetricMatrix(q, a, &z);
+  Matrix& b(buffer->v_);
+  if (b.GetNumRow() != num_basis || b.GetNumColumn() != num_basis) {
+    b.Resize(num_basis, num_basis);
+  }
+  for (int i(0); i < num_basis; ++i) {
+    for (int j(0); j <= i; ++j) {
+      double sum(0.0);
+      for (int k(0); k < length; ++k) {
+        sum += q[i][k] * z[j][k];
+      }
+      b[i][j] = sum;
+    }
+  }
+  for (int i(0); i < num_basis; ++i) {
+    for (int j(0); j < i; ++j) {
+      b[j][i] = b[i][j];
+    }
+  }
+
+  if (!DecomposeSymmetricMatrix(num_iteration_, &b, &buffer->d_,
+                                &buffer->e_)) {
+    return false;
+  }
+
+  // Map eigenvectors in the subspace to the original space.
+  if (z.GetNumRow() != num_basis || z.GetNumColumn() != length) {
+    z.Resize(num_basis, length);
+  } else {
+    z.Fill(0.0);
+  }
+  for (int i(0); i < num_basis; ++i) {
+    for (int j(0); j < num_basis; ++j) {
+      const double x(b[i][j]);
+      for (int k(0); k < length; ++k) {
+        z[i][k] += x * q[j][k];
+      }
+    }
+  }
+
+  eigenvectors->Fill(0.0);
+  SortEigenvalues(buffer->d_, z, num_principal_component_,
+                  &buffer->order_of_eigenvalue_, eigenvalues, eigenvectors);
+
+  // Approximate the remaining eigenvalues by the average residual variance.
+  if (num_principal_component_ < length) {
+    double residual(trace);
+    for (int i(0); i < num_principal_component_; ++i) {
+      residual -= (*eigenvalues)[i];
+    }
+    const double average(std::max(
+        0.0, residual / (length - num_principal_component_)));
+    std::fill(eigenvalues->begin() + num_principal_component_,
+              eigenvalues->end(), average);
+  }
+
+  return true;
+}
+
 }  // namespace sptk
@@ -48,27 +48,25 @@ RealValuedFastFourierTransform::RealValuedFastFourierTransform(int num_order,
   sine_table_[fft_length_ / 2] = 0.0;
 }
 
-bool RealValuedFastFourierTransform::Run(
-    const std::vector<double>& real_part_input,
-    std::vector<double>* real_part_output,
-    std::vector<double>* imag_part_output,
-    RealValuedFastFourierTransform::Buffer* buffer) const {
+template <typename T>
+bool RealValuedFastFourierTransform::Transform(
+    const std::vector<T>& real_part_input, const std::vector<T>& sine_table,
+    std::vector<T>* real_part_output, std::vector<T>* imag_part_output,
+    std::vector<T>* real_part_buffer, std::vector<T>* imag_part_buffer) const {
   // Check inputs.
   const int input_length(num_order_ + 1);
   if (!is_valid_ ||
       real_part_input.size() != static_cast<std::size_t>(input_length) ||
-      NULL == real_part_output || NULL == imag_part_output || NULL == buffer) {
+      NULL == real_part_output || NULL == imag_part_output) {
     return false;
   }
 
   // Prepare memories.
-  if (buffer->real_part_input_.size() !=
-      static_cast<std::size_t>(half_fft_length_)) {
-    buffer->real_part_input_.resize(half_fft_length_);
+  if (real_part_buffer->size() != static_cast<std::size_t>(half_fft_length_)) {
+    real_part_buffer->resize(half_fft_length_);
   }
-  if (buffer->imag_part_input_.size() !=
-      static_cast<std::size_t>(half_fft_length_)) {
-    buffer->imag_part_input_.resize(half_fft_length_);
+  if (imag_part_buffer->size() != static_cast<std::size_t>(half_fft_length_)) {
+    imag_part_buffer->resize(half_fft_length_);
   }
   if (real_part_output->capacity() < static_cast<std::size_t>(fft_length_)) {
     real_part_output->reserve(fft_length_);
@@ -79,46 +77,45 @@ bool RealValuedFastFourierTransform::Run(
 
   // Copy input and fill zero.
   for (int i(0), j(0); i < input_length; ++j) {
-    buffer->real_part_input_[j] = real_part_input[i++];
+    (*real_part_buffer)[j] = real_part_input[i++];
     if (input_length <= i) break;
-    buffer->imag_part_input_[j] = real_part_input[i++];
+    (*imag_part_buffer)[j] = real_part_input[i++];
   }
-  std::fill(buffer->real_part_input_.begin() + (input_length + 1) / 2,
-            buffer->real_part_input_.end(), 0.0);
-  std::fill(buffer->imag_part_input_.begin() + input_length / 2,
-            buffer->imag_part_input_.end(), 0.0);
+  std::fill(real_part_buffer->begin() + (input_length + 1) / 2,
+            real_part_buffer->end(), T(0));
+  std::fill(imag_part_buffer->begin() + input_length / 2,
+            imag_part_buffer->end(), T(0));
 
   // Run fast Fourier transform.
-  if (!fast_fourier_transform_.Run(buffer->real_part_input_,
-                                   buffer->imag_part_input_, real_part_output,
-                                   imag_part_output)) {
+  if (!fast_fourier_transform_.Run(*real_part_buffer, *imag_part_buffer,
+                                   real_part_output, imag_part_output)) {
     return false;
   }
   real_part_output->resize(fft_length_);
   imag_part_output->resize(fft_length_);
 
-  double* x(&((*real_part_output)[0]));
-  double* y(&((*imag_part_output)[0]));
-  double* xp(x);
-  double* yp(y);
-  double* xq(xp + fft_length_);
-  double* yq(yp + fft_length_);
+  T* x(&((*real_part_output)[0]));
+  T* y(&((*imag_part_output)[0]));
+  T* xp(x);
+  T* yp(y);
+  T* xq(xp + fft_length_);
+  T* yq(yp + fft_length_);
   *(xp + half_fft_length_) = *xp - *yp;
   *xp = *xp + *yp;
-  *(yp + half_fft_length_) = 0.0;
-  *yp = 0.0;
+  *(yp + half_fft_length_) = T(0);
+  *yp = T(0);
 
-  const double* sinp(&(sine_table_[0]));
-  const double* cosp(&(sine_table_[0]) + fft_length_ / 4);
+  const T* sinp(&(sine_table[0]));
+  const T* cosp(&(sine_table[0]) + fft_length_ / 4);
   for (int i(1), j(half_fft_length_ - 2); i < half_fft_length_; ++i, j -= 2) {
     ++xp;
     ++yp;
     ++sinp;
     ++cosp;
-    const double xt(*xp - *(xp + j));
-    const double yt(*yp + *(yp + j));
-    *(--xq) = (*xp + *(xp + j) + *cosp * yt - *sinp * xt) * 0.5;
-    *(--yq) = (-*yp + *(yp + j) + *sinp * yt + *cosp * xt) * 0.5;
+    const T xt(*xp - *(xp + j));
+    const T yt(*yp + *(yp + j));
+    *(--xq) = (*xp + *(xp + j) + *cosp * yt - *sinp * xt) * T(0.5);
+    *(--yq) = (-*yp + *(yp + j) + *sinp * yt + *cosp * xt) * T(0.5);
   }
 
   xp = x + 1;
@@ -133,6 +130,17 @@ bool RealValuedFastFourierTransform::Run(
   return true;
 }
 
+bool RealValuedFastFourierTransform::Run(
+    const std::vector<double>& real_part_input,
+    std::vector<double>* real_part_output,
+    std::vector<double>* imag_part_output,
+    RealValuedFastFourierTransform::Buffer* buffer) const {
+  if (NULL == buffer) return false;
+  return Transform(real_part_input, sine_table_, real_part_output,
+                   imag_part_output, &buffer->real_part_input_,
+                   &buffer->imag_part_input_);
+}
+
 bool RealValuedFastFourierTransform::Run(
     std::vector<double>* real_part, std::vector<double>* imag_part,
     RealValuedFastFourierTransform::Buffer* buffer) const {
@@ -140,4 +148,24 @@ bool RealValuedFastFourierTransform::Run(
   return Run(*real_part, real_part, imag_part, buffer);
 }
 
+bool RealValuedFastFourierTransform::Run(
+    const std::vector<float>& real_part_input,
+    std::vector<float>* real_part_output, std::vector<float>* imag_part_output,
+    RealValuedFastFourierTransform::Buffer* buffer) const {
+  if (NULL == buffer) return false;
+  std::call_once(float_sine_table_flag_, [this]() {
+    float_sine_table_.assign(sine_table_.begin(), sine_table_.end());
+  });
+  return Transform(real_part_input, float_sine_table_, real_part_output,
+                   imag_part_output, &buffer->float_real_part_input_,
+                   &buffer->float_imag_part_input_);
+}
+
+bool RealValuedFastFourierTransform::Run(
+    std::vector<float>* real_part, std::vector<float>* imag_part,
+    RealValuedFastFourierTransform::Buffer* buffer) const {
+  if (NULL == real_part) return false;
+  return Run(*real_part, real_part, imag_part, buffer);
+}
+
 }  // namespace sptk
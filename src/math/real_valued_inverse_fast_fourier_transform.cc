@@ -30,10 +30,10 @@ RealValuedInverseFastFourierTransform::RealValuedInverseFastFourierTransform(
     : fast_fourier_transform_(num_order, fft_length) {
 }
 
-bool RealValuedInverseFastFourierTransform::Run(
-    const std::vector<double>& real_part_input,
-    std::vector<double>* real_part_output,
-    std::vector<double>* imag_part_output,
+template <typename T>
+bool RealValuedInverseFastFourierTransform::Transform(
+    const std::vector<T>& real_part_input, std::vector<T>* real_part_output,
+    std::vector<T>* imag_part_output,
     RealValuedInverseFastFourierTransform::Buffer* buffer) const {
   if (NULL == buffer) {
     return false;
@@ -46,17 +46,26 @@ bool RealValuedInverseFastFourierTransform::Run(
   }
 
   const int fft_length(fast_fourier_transform_.GetFftLength());
-  const double z(1.0 / fft_length);
+  const T z(T(1) / fft_length);
   std::transform(real_part_output->begin(),
                  real_part_output->begin() + fft_length,
-                 real_part_output->begin(), [z](double x) { return x * z; });
+                 real_part_output->begin(), [z](T x) { return x * z; });
   std::transform(imag_part_output->begin(),
                  imag_part_output->begin() + fft_length,
-                 imag_part_output->begin(), [z](double x) { return x * z; });
+                 imag_part_output->begin(), [z](T x) { return x * z; });
 
   return true;
 }
 
+bool RealValuedInverseFastFourierTransform::Run(
+    const std::vector<double>& real_part_input,
+    std::vector<double>* real_part_output,
+    std::vector<double>* imag_part_output,
+    RealValuedInverseFastFourierTransform::Buffer* buffer) const {
+  return Transform(real_part_input, real_part_output, imag_part_output,
+                   buffer);
+}
+
 bool RealValuedInverseFastFourierTransform::Run(
     std::vector<double>* real_part, std::vector<double>* imag_part,
     RealValuedInverseFastFourierTransform::Buffer* buffer) const {
@@ -64,4 +73,19 @@ bool RealValuedInverseFastFourierTransform::Run(
   return Run(*real_part, real_part, imag_part, buffer);
 }
 
+bool RealValuedInverseFastFourierTransform::Run(
+    const std::vector<float>& real_part_input,
+    std::vector<float>* real_part_output, std::vector<float>* imag_part_output,
+    RealValuedInverseFastFourierTransform::Buffer* buffer) const {
+  return Transform(real_part_input, real_part_output, imag_part_output,
+                   buffer);
+}
+
+bool RealValuedInverseFastFourierTransform::Run(
+    std::vector<float>* real_part, std::vector<float>* imag_part,
+    RealValuedInverseFastFourierTransform::Buffer* buffer) const {
+  if (NULL == real_part) return false;
+  return Run(*real_part, real_part, imag_part, buffer);
+}
+
 }  // namespace sptk
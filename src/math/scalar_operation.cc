@@ -16,7 +16,9 @@
 
 #include "SPTK/math/scalar_operation.h"
 
-#include <cmath>  // std::atan, std::atanh, std::ceil, std::cos, std::exp, std::fabs, std::floor, std::fmod, std::log, std::pow, std::round, std::sin, std::sqrt, std::tan, std::tanh, std::trunc
+#include <algorithm>  // std::find
+#include <cmath>      // std::atan, std::atanh, std::ceil, std::cos, std::exp, std::fabs, std::floor, std::fmod, std::log, std::pow, std::round, std::sin, std::sqrt, std::tan, std::tanh, std::trunc
+#include <vector>     // std::vector
 
 namespace {
 
@@ -26,6 +28,16 @@ class OperationInterface {
   }
 
   virtual bool Run(double* number) const = 0;
+
+  virtual bool Run(std::vector<double>* numbers) const {
+    for (std::vector<double>::iterator itr(numbers->begin());
+         itr != numbers->end(); ++itr) {
+      if (!Run(&(*itr))) {
+        return false;
+      }
+    }
+    return true;
+  }
 };
 
 /**
@@ -49,6 +61,22 @@ class OperationPerformer : public sptk::ScalarOperation::ModuleInterface {
     return operation_->Run(number);
   }
 
+  virtual bool Run(std::vector<double>* numbers,
+                   std::vector<bool>* is_magic_numbers) const {
+    // Process all numbers at once if there is no magic number.
+    if (is_magic_numbers->end() ==
+        std::find(is_magic_numbers->begin(), is_magic_numbers->end(), true)) {
+      return operation_->Run(numbers);
+    }
+    const int size(static_cast<int>(numbers->size()));
+    for (int i(0); i < size; ++i) {
+      if (!(*is_magic_numbers)[i] && !operation_->Run(&((*numbers)[i]))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
  private:
   const OperationInterface* operation_;
   DISALLOW_COPY_AND_ASSIGN(OperationPerformer);
@@ -139,6 +167,14 @@ class Power : public OperationInterface {
     return true;
   }
 
+  virtual bool Run(std::vector<double>* numbers) const {
+    if (!numbers->empty()) {
+      sptk::Pow(&((*numbers)[0]), exponent_, static_cast<int>(numbers->size()),
+                &((*numbers)[0]));
+    }
+    return true;
+  }
+
  private:
   const double exponent_;
   DISALLOW_COPY_AND_ASSIGN(Power);
@@ -232,15 +268,29 @@ class SquareRoot : public OperationInterface {
 
 class NaturalLogarithm : public OperationInterface {
  public:
-  NaturalLogarithm() {
+  explicit NaturalLogarithm(bool use_approximation)
+      : use_approximation_(use_approximation) {
   }
 
   virtual bool Run(double* number) const {
-    *number = std::log(*number);
+    if (use_approximation_) {
+      sptk::Log(number, 1, number, true);
+    } else {
+      *number = std::log(*number);
+    }
+    return true;
+  }
+
+  virtual bool Run(std::vector<double>* numbers) const {
+    if (!numbers->empty()) {
+      sptk::Log(&((*numbers)[0]), static_cast<int>(numbers->size()),
+                &((*numbers)[0]), use_approximation_);
+    }
     return true;
   }
 
  private:
+  const bool use_approximation_;
   DISALLOW_COPY_AND_ASSIGN(NaturalLogarithm);
 };
 
@@ -254,6 +304,18 @@ class Logarithm : public OperationInterface {
     return true;
   }
 
+  virtual bool Run(std::vector<double>* numbers) const {
+    if (!numbers->empty()) {
+      sptk::Log(&((*numbers)[0]), static_cast<int>(numbers->size()),
+                &((*numbers)[0]));
+    }
+    for (std::vector<double>::iterator itr(numbers->begin());
+         itr != numbers->end(); ++itr) {
+      *itr *= multiplier_;
+    }
+    return true;
+  }
+
  private:
   const double multiplier_;
   DISALLOW_COPY_AND_ASSIGN(Logarithm);
@@ -261,15 +323,29 @@ class Logarithm : public OperationInterface {
 
 class NaturalExponential : public OperationInterface {
  public:
-  NaturalExponential() {
+  explicit NaturalExponential(bool use_approximation)
+      : use_approximation_(use_approximation) {
   }
 
   virtual bool Run(double* number) const {
-    *number = std::exp(*number);
+    if (use_approximation_) {
+      sptk::Exp(number, 1, number, true);
+    } else {
+      *number = std::exp(*number);
+    }
+    return true;
+  }
+
+  virtual bool Run(std::vector<double>* numbers) const {
+    if (!numbers->empty()) {
+      sptk::Exp(&((*numbers)[0]), static_cast<int>(numbers->size()),
+                &((*numbers)[0]), use_approximation_);
+    }
     return true;
   }
 
  private:
+  const bool use_approximation_;
   DISALLOW_COPY_AND_ASSIGN(NaturalExponential);
 };
 
@@ -486,6 +562,20 @@ class MagicNumberRemover : public sptk::ScalarOperation::ModuleInterface {
     return true;
   }
 
+  virtual bool Run(std::vector<double>* numbers,
+                   std::vector<bool>* is_magic_numbers) const {
+    const int size(static_cast<int>(numbers->size()));
+    for (int i(0); i < size; ++i) {
+      if ((*is_magic_numbers)[i]) {
+        return false;
+      }
+      if (magic_number_ == (*numbers)[i]) {
+        (*is_magic_numbers)[i] = true;
+      }
+    }
+    return true;
+  }
+
  private:
   const double magic_number_;
   DISALLOW_COPY_AND_ASSIGN(MagicNumberRemover);
@@ -505,6 +595,18 @@ class MagicNumberReplacer : public sptk::ScalarOperation::ModuleInterface {
     return true;
   }
 
+  virtual bool Run(std::vector<double>* numbers,
+                   std::vector<bool>* is_magic_numbers) const {
+    const int size(static_cast<int>(numbers->size()));
+    for (int i(0); i < size; ++i) {
+      if ((*is_magic_numbers)[i]) {
+        (*numbers)[i] = replacement_number_;
+        (*is_magic_numbers)[i] = false;
+      }
+    }
+    return true;
+  }
+
  private:
   const double replacement_number_;
   DISALLOW_COPY_AND_ASSIGN(MagicNumberReplacer);
@@ -576,8 +678,9 @@ bool ScalarOperation::AddSquareRootOperation() {
   return true;
 }
 
-bool ScalarOperation::AddNaturalLogarithmOperation() {
-  modules_.push_back(new OperationPerformer(new NaturalLogarithm()));
+bool ScalarOperation::AddNaturalLogarithmOperation(bool use_approximation) {
+  modules_.push_back(
+      new OperationPerformer(new NaturalLogarithm(use_approximation)));
   return true;
 }
 
@@ -587,8 +690,9 @@ bool ScalarOperation::AddLogarithmOperation(double base) {
   return true;
 }
 
-bool ScalarOperation::AddNaturalExponentialOperation() {
-  modules_.push_back(new OperationPerformer(new NaturalExponential()));
+bool ScalarOperation::AddNaturalExponentialOperation(bool use_approximation) {
+  modules_.push_back(
+      new OperationPerformer(new NaturalExponential(use_approximation)));
   return true;
 }
 
@@ -693,4 +797,22 @@ bool ScalarOperation::Run(double* number, bool* is_magic_number) const {
   return true;
 }
 
+bool ScalarOperation::Run(std::vector<double>* numbers,
+                          std::vector<bool>* is_magic_numbers) const {
+  if (NULL == numbers || NULL == is_magic_numbers) {
+    return false;
+  }
+
+  is_magic_numbers->assign(numbers->size(), false);
+  for (std::vector<ScalarOperation::ModuleInterface*>::const_iterator itr(
+           modules_.begin());
+       itr != modules_.end(); ++itr) {
+    if (!(*itr)->Run(numbers, is_magic_numbers)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
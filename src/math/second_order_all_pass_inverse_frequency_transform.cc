@@ -19,7 +19,6 @@
 #include <algorithm>  // std::copy, std::fill
 #include <cmath>      // std::cos, std::sin
 #include <cstddef>    // std::size_t
-#include <numeric>    // std::inner_product
 
 #include "SPTK/math/inverse_fast_fourier_transform.h"
 
@@ -78,18 +77,17 @@ SecondOrderAllPassInverseFrequencyTransform::
     }
   }
 
-  conversion_matrix_.resize(output_length);
+  conversion_matrix_.Resize(input_length, output_length);
   for (int m2(0); m2 <= num_output_order_; ++m2) {
-    conversion_matrix_[m2].resize(input_length);
     for (int m1(0); m1 <= num_input_order_; ++m1) {
-      conversion_matrix_[m2][m1] = real[m1 + num_input_order_][m2];
+      conversion_matrix_[m1][m2] = real[m1 + num_input_order_][m2];
     }
   }
   for (int m1(1); m1 <= num_input_order_; ++m1) {
-    conversion_matrix_[0][m1] *= 0.5;
+    conversion_matrix_[m1][0] *= 0.5;
   }
   for (int m2(1); m2 <= num_output_order_; ++m2) {
-    conversion_matrix_[m2][0] *= 2.0;
+    conversion_matrix_[0][m2] *= 2.0;
   }
 }
 
@@ -127,12 +125,31 @@ bool SecondOrderAllPassInverseFrequencyTransform::Run(
   }
 
   // Perform inverse frequency transform.
-  for (int m2(0); m2 <= num_output_order_; ++m2) {
-    (*minimum_phase_sequence)[m2] = std::inner_product(
-        conversion_matrix_[m2].begin(), conversion_matrix_[m2].end(),
-        warped_sequence.begin(), 0.0);
+  std::fill(minimum_phase_sequence->begin(), minimum_phase_sequence->end(),
+            0.0);
+  double* y(&((*minimum_phase_sequence)[0]));
+  for (int m1(0); m1 <= num_input_order_; ++m1) {
+    const double x(warped_sequence[m1]);
+    const double* a(conversion_matrix_[m1]);
+    for (int m2(0); m2 <= num_output_order_; ++m2) {
+      y[m2] += x * a[m2];
+    }
+  }
+
+  return true;
+}
+
+bool SecondOrderAllPassInverseFrequencyTransform::Run(
+    const Matrix& warped_sequences, Matrix* minimum_phase_sequences) const {
+  // Check inputs.
+  if (!is_valid_ || warped_sequences.GetNumColumn() != num_input_order_ + 1 ||
+      NULL == minimum_phase_sequences) {
+    return false;
   }
 
+  // Perform inverse frequency transform.
+  *minimum_phase_sequences = warped_sequences * conversion_matrix_;
+
   return true;
 }
 
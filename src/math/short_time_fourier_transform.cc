@@ -0,0 +1,188 @@
+// ------------------------------------------------------------------------ //
+// Copyright 2021 SPTK Working Group                                        //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ------------------------------------------------------------------------ //
+
+#include "SPTK/math/short_time_fourier_transform.h"
+
+#include <algorithm>  // std::copy, std::fill, std::max, std::min
+#include <cstddef>    // std::ptrdiff_t, std::size_t
+
+namespace sptk {
+
+ShortTimeFourierTransform::ShortTimeFourierTransform(
+    WindowInterface* window, int fft_length,
+    DataWindowing::NormalizationType normalization_type,
+    SpectrumToSpectrum::InputOutputFormats output_format, double epsilon,
+    double relative_floor_in_decibels)
+    : frame_length_(window ? window->GetWindowLength() : 0),
+      fft_length_(fft_length),
+      fast_fourier_transform_(frame_length_ - 1, fft_length_),
+      spectrum_to_spectrum_(fft_length_, SpectrumToSpectrum::kPowerSpectrum,
+                            output_format, epsilon, relative_floor_in_decibels),
+      is_valid_(true) {
+  if (frame_length_ <= 0 || !fast_fourier_transform_.IsValid() ||
+      !spectrum_to_spectrum_.IsValid()) {
+    is_valid_ = false;
+    return;
+  }
+
+  // Get normalized window by windowing ones.
+  const DataWindowing data_windowing(window, frame_length_,
+                                     normalization_type);
+  if (!data_windowing.IsValid() ||
+      !data_windowing.Run(std::vector<double>(frame_length_, 1.0),
+                          &window_)) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+void ShortTimeFourierTransform::Clear(
+    ShortTimeFourierTransform::Buffer* buffer) const {
+  if (NULL != buffer) {
+    std::fill(buffer->ring_buffer_.begin(), buffer->ring_buffer_.end(), 0.0);
+    std::fill(buffer->float_ring_buffer_.begin(),
+              buffer->float_ring_buffer_.end(), 0.0f);
+    buffer->position_ = 0;
+  }
+}
+
+template <typename T>
+bool ShortTimeFourierTransform::ComputePowerSpectrum(
+    const std::vector<T>& waveform, const std::vector<T>& window,
+    std::vector<T>* power_spectrum, std::vector<T>* ring_buffer,
+    std::vector<T>* windowed_frame, std::vector<T>* real_part,
+    std::vector<T>* imag_part,
+    ShortTimeFourierTransform::Buffer* buffer) const {
+  // Prepare memories.
+  if (ring_buffer->size() != static_cast<std::size_t>(frame_length_)) {
+    ring_buffer->assign(frame_length_, T(0));
+    buffer->position_ = 0;
+  }
+  if (windowed_frame->size() != static_cast<std::size_t>(frame_length_)) {
+    windowed_frame->resize(frame_length_);
+  }
+  const int output_length(fft_length_ / 2 + 1);
+  if (power_spectrum->size() != static_cast<std::size_t>(output_length)) {
+    power_spectrum->resize(output_length);
+  }
+
+  // Store the latest signals in ring buffer.
+  {
+    const int num_sample(static_cast<int>(waveform.size()));
+    typename std::vector<T>::const_iterator input(
+        waveform.begin() + std::max(0, num_sample - frame_length_));
+    while (waveform.end() != input) {
+      const int num_copy(static_cast<int>(
+          std::min(waveform.end() - input,
+                   static_cast<std::ptrdiff_t>(frame_length_ -
+                                               buffer->position_))));
+      std::copy(input, input + num_copy,
+                ring_buffer->begin() + buffer->position_);
+      input += num_copy;
+      buffer->position_ += num_copy;
+      if (frame_length_ == buffer->position_) {
+        buffer->position_ = 0;
+      }
+    }
+  }
+
+  // Apply window. The oldest signal is at the current position.
+  {
+    const int head_length(frame_length_ - buffer->position_);
+    const T* x(&((*ring_buffer)[0]));
+    const T* w(&(window[0]));
+    T* y(&((*windowed_frame)[0]));
+    for (int i(0); i < head_length; ++i) {
+      y[i] = x[buffer->position_ + i] * w[i];
+    }
+    for (int i(head_length); i < frame_length_; ++i) {
+      y[i] = x[i - head_length] * w[i];
+    }
+  }
+
+  // Compute power spectrum.
+  if (!fast_fourier_transform_.Run(*windowed_frame, real_part, imag_part,
+                                   &buffer->fast_fourier_transform_buffer_)) {
+    return false;
+  }
+  {
+    const T* xr(&((*real_part)[0]));
+    const T* xi(&((*imag_part)[0]));
+    T* s(&((*power_spectrum)[0]));
+    for (int i(0); i < output_length; ++i) {
+      s[i] = xr[i] * xr[i] + xi[i] * xi[i];
+    }
+  }
+
+  return true;
+}
+
+bool ShortTimeFourierTransform::Run(
+    const std::vector<double>& waveform, std::vector<double>* spectrum,
+    ShortTimeFourierTransform::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || NULL == spectrum || NULL == buffer) {
+    return false;
+  }
+
+  if (!ComputePowerSpectrum(waveform, window_, spectrum, &buffer->ring_buffer_,
+                            &buffer->windowed_frame_,
+                            &buffer->fast_fourier_transform_real_output_,
+                            &buffer->fast_fourier_transform_imag_output_,
+                            buffer)) {
+    return false;
+  }
+
+  // Convert to output format.
+  if (!spectrum_to_spectrum_.Run(spectrum)) {
+    return false;
+  }
+
+  return true;
+}
+
+bool ShortTimeFourierTransform::Run(
+    const std::vector<float>& waveform, std::vector<float>* spectrum,
+    ShortTimeFourierTransform::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || NULL == spectrum || NULL == buffer) {
+    return false;
+  }
+
+  std::call_once(float_window_flag_, [this]() {
+    float_window_.assign(window_.begin(), window_.end());
+  });
+  if (!ComputePowerSpectrum(waveform, float_window_, spectrum,
+                            &buffer->float_ring_buffer_,
+                            &buffer->float_windowed_frame_,
+                            &buffer->float_fast_fourier_transform_real_output_,
+                            &buffer->float_fast_fourier_transform_imag_output_,
+                            buffer)) {
+    return false;
+  }
+
+  // Convert to output format in double precision.
+  buffer->spectrum_.assign(spectrum->begin(), spectrum->end());
+  if (!spectrum_to_spectrum_.Run(&buffer->spectrum_)) {
+    return false;
+  }
+  std::copy(buffer->spectrum_.begin(), buffer->spectrum_.end(),
+            spectrum->begin());
+
+  return true;
+}
+
+}  // namespace sptk
@@ -16,7 +16,7 @@
 
 #include "SPTK/math/statistics_accumulation.h"
 
-#include <algorithm>   // std::copy, std::transform
+#include <algorithm>   // std::copy, std::fill, std::transform
 #include <cmath>       // std::sqrt
 #include <cstddef>     // std::size_t
 #include <functional>  // std::plus
@@ -95,16 +95,10 @@ bool StatisticsAccumulation::GetDiagonalCovariance(
     diagonal_covariance->resize(num_order_ + 1);
   }
 
-  std::vector<double> mean;
-  if (!GetMean(buffer, &mean)) {
-    return false;
-  }
-
   const double z(1.0 / buffer.zeroth_order_statistics_);
-  const double* mu(&(mean[0]));
   double* variance(&((*diagonal_covariance)[0]));
   for (int i(0); i <= num_order_; ++i) {
-    variance[i] = z * buffer.second_order_statistics_[i][i] - mu[i] * mu[i];
+    variance[i] = z * buffer.second_order_statistics_[i][i];
   }
 
   return true;
@@ -140,17 +134,10 @@ bool StatisticsAccumulation::GetFullCovariance(
     full_covariance->Resize(num_order_ + 1);
   }
 
-  std::vector<double> mean;
-  if (!GetMean(buffer, &mean)) {
-    return false;
-  }
-
   const double z(1.0 / buffer.zeroth_order_statistics_);
-  const double* mu(&(mean[0]));
   for (int i(0); i <= num_order_; ++i) {
     for (int j(0); j <= i; ++j) {
-      (*full_covariance)[i][j] =
-          z * buffer.second_order_statistics_[i][j] - mu[i] * mu[j];
+      (*full_covariance)[i][j] = z * buffer.second_order_statistics_[i][j];
     }
   }
 
@@ -229,6 +216,27 @@ bool StatisticsAccumulation::Run(const std::vector<double>& data,
     buffer->second_order_statistics_.Resize(length);
   }
 
+  // Accumulate 2nd order statistics around the running mean.
+  if (2 <= num_statistics_order_ && 0 < buffer->zeroth_order_statistics_) {
+    if (buffer->delta_.size() != static_cast<std::size_t>(length)) {
+      buffer->delta_.resize(length);
+    }
+    const double n(buffer->zeroth_order_statistics_);
+    const double z(1.0 / n);
+    const double* s1(&(buffer->first_order_statistics_[0]));
+    double* d(&(buffer->delta_[0]));
+    for (int i(0); i < length; ++i) {
+      d[i] = data[i] - z * s1[i];
+    }
+    const double r(n / (n + 1.0));
+    for (int i(0); i < length; ++i) {
+      const double rd(r * d[i]);
+      for (int j(0); j <= i; ++j) {
+        buffer->second_order_statistics_[i][j] += rd * d[j];
+      }
+    }
+  }
+
   // Accumulate 0th order statistics.
   ++(buffer->zeroth_order_statistics_);
 
@@ -239,15 +247,149 @@ bool StatisticsAccumulation::Run(const std::vector<double>& data,
         buffer->first_order_statistics_.begin(), std::plus<double>());
   }
 
-  // Accumulate 2nd order statistics.
+  return true;
+}
+
+bool StatisticsAccumulation::Merge(
+    int num_data, const std::vector<double>& mean,
+    const SymmetricMatrix& full_covariance,
+    StatisticsAccumulation::Buffer* buffer) const {
+  // Check inputs.
+  const int length(num_order_ + 1);
+  if (!is_valid_ || num_data < 0 ||
+      (1 <= num_statistics_order_ &&
+       mean.size() != static_cast<std::size_t>(length)) ||
+      (2 <= num_statistics_order_ &&
+       full_covariance.GetNumDimension() != length) ||
+      NULL == buffer) {
+    return false;
+  }
+
+  if (0 == num_data) {
+    return true;
+  }
+
+  // Prepare memories.
+  if (1 <= num_statistics_order_ && buffer->first_order_statistics_.size() !=
+                                        static_cast<std::size_t>(length)) {
+    buffer->first_order_statistics_.resize(length);
+  }
+  if (2 <= num_statistics_order_ &&
+      buffer->second_order_statistics_.GetNumDimension() != length) {
+    buffer->second_order_statistics_.Resize(length);
+  }
+
+  // Merge 2nd order statistics.
+  if (2 <= num_statistics_order_) {
+    if (buffer->delta_.size() != static_cast<std::size_t>(length)) {
+      buffer->delta_.resize(length);
+    }
+    const double n1(buffer->zeroth_order_statistics_);
+    const double n2(num_data);
+    double* d(&(buffer->delta_[0]));
+    if (0.0 < n1) {
+      const double z(1.0 / n1);
+      const double* s1(&(buffer->first_order_statistics_[0]));
+      for (int i(0); i < length; ++i) {
+        d[i] = mean[i] - z * s1[i];
+      }
+    } else {
+      std::fill(buffer->delta_.begin(), buffer->delta_.end(), 0.0);
+    }
+    const double r(n1 * n2 / (n1 + n2));
+    for (int i(0); i < length; ++i) {
+      const double rd(r * d[i]);
+      for (int j(0); j <= i; ++j) {
+        buffer->second_order_statistics_[i][j] +=
+            n2 * full_covariance[i][j] + rd * d[j];
+      }
+    }
+  }
+
+  // Merge 0th order statistics.
+  buffer->zeroth_order_statistics_ += num_data;
+
+  // Merge 1st order statistics.
+  if (1 <= num_statistics_order_) {
+    for (int i(0); i < length; ++i) {
+      buffer->first_order_statistics_[i] += num_data * mean[i];
+    }
+  }
+
+  return true;
+}
+
+bool StatisticsAccumulation::Merge(
+    const StatisticsAccumulation::Buffer& other,
+    StatisticsAccumulation::Buffer* buffer) const {
+  // Check inputs.
+  const int length(num_order_ + 1);
+  if (!is_valid_ || NULL == buffer || &other == buffer) {
+    return false;
+  }
+
+  if (0 == other.zeroth_order_statistics_) {
+    return true;
+  }
+
+  if ((1 <= num_statistics_order_ && other.first_order_statistics_.size() !=
+                                         static_cast<std::size_t>(length)) ||
+      (2 <= num_statistics_order_ &&
+       other.second_order_statistics_.GetNumDimension() != length)) {
+    return false;
+  }
+
+  // Prepare memories.
+  if (1 <= num_statistics_order_ && buffer->first_order_statistics_.size() !=
+                                        static_cast<std::size_t>(length)) {
+    buffer->first_order_statistics_.resize(length);
+  }
+  if (2 <= num_statistics_order_ &&
+      buffer->second_order_statistics_.GetNumDimension() != length) {
+    buffer->second_order_statistics_.Resize(length);
+  }
+
+  // Merge 2nd order statistics.
   if (2 <= num_statistics_order_) {
+    if (buffer->delta_.size() != static_cast<std::size_t>(length)) {
+      buffer->delta_.resize(length);
+    }
+    const double n1(buffer->zeroth_order_statistics_);
+    const double n2(other.zeroth_order_statistics_);
+    double* d(&(buffer->delta_[0]));
+    if (0.0 < n1) {
+      const double z1(1.0 / n1);
+      const double z2(1.0 / n2);
+      const double* s1(&(buffer->first_order_statistics_[0]));
+      const double* s2(&(other.first_order_statistics_[0]));
+      for (int i(0); i < length; ++i) {
+        d[i] = z2 * s2[i] - z1 * s1[i];
+      }
+    } else {
+      std::fill(buffer->delta_.begin(), buffer->delta_.end(), 0.0);
+    }
+    const double r(n1 * n2 / (n1 + n2));
     for (int i(0); i < length; ++i) {
+      const double rd(r * d[i]);
       for (int j(0); j <= i; ++j) {
-        buffer->second_order_statistics_[i][j] += data[i] * data[j];
+        buffer->second_order_statistics_[i][j] +=
+            other.second_order_statistics_[i][j] + rd * d[j];
       }
     }
   }
 
+  // Merge 0th order statistics.
+  buffer->zeroth_order_statistics_ += other.zeroth_order_statistics_;
+
+  // Merge 1st order statistics.
+  if (1 <= num_statistics_order_) {
+    std::transform(other.first_order_statistics_.begin(),
+                   other.first_order_statistics_.end(),
+                   buffer->first_order_statistics_.begin(),
+                   buffer->first_order_statistics_.begin(),
+                   std::plus<double>());
+  }
+
   return true;
 }
 
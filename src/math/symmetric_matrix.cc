@@ -16,7 +16,7 @@
 
 #include "SPTK/math/symmetric_matrix.h"
 
-#include <algorithm>  // std::fill, std::swap
+#include <algorithm>  // std::copy, std::fill, std::swap
 #include <cmath>      // std::fabs
 #include <cstddef>    // std::size_t
 #include <stdexcept>  // std::out_of_range
@@ -32,22 +32,6 @@ const double kMinimumValueOfDiagonalElement(1e-12);
 
 namespace sptk {
 
-double& SymmetricMatrix::Row::operator[](int column) {
-  int row(row_);
-  if (row < column) {
-    std::swap(row, column);
-  }
-  return matrix_.index_[row][column];
-}
-
-const double& SymmetricMatrix::Row::operator[](int column) const {
-  int row(row_);
-  if (row < column) {
-    std::swap(row, column);
-  }
-  return matrix_.index_[row][column];
-}
-
 SymmetricMatrix::SymmetricMatrix(int num_dimension)
     : num_dimension_(num_dimension < 0 ? 0 : num_dimension) {
   data_.resize(num_dimension_ * (num_dimension_ + 1) / 2);
@@ -143,41 +127,55 @@ bool SymmetricMatrix::SetDiagonal(
 bool SymmetricMatrix::CholeskyDecomposition(
     SymmetricMatrix* lower_triangular_matrix,
     std::vector<double>* diagonal_elements) const {
-  if (NULL == lower_triangular_matrix || NULL == diagonal_elements ||
-      this == lower_triangular_matrix || 0.0 == index_[0][0]) {
+  if (NULL == lower_triangular_matrix || this == lower_triangular_matrix) {
     return false;
   }
 
   if (lower_triangular_matrix->num_dimension_ != num_dimension_) {
     lower_triangular_matrix->Resize(num_dimension_);
   }
+  std::copy(data_.begin(), data_.end(),
+            lower_triangular_matrix->data_.begin());
+
+  return lower_triangular_matrix->CholeskyDecomposition(diagonal_elements);
+}
+
+bool SymmetricMatrix::CholeskyDecomposition(
+    std::vector<double>* diagonal_elements) {
+  if (NULL == diagonal_elements || 0 == num_dimension_ ||
+      0.0 == index_[0][0]) {
+    return false;
+  }
+
   if (diagonal_elements->size() != static_cast<std::size_t>(num_dimension_)) {
     diagonal_elements->resize(num_dimension_);
   }
 
+  // Row i first holds l(i, j) d(j), which is divided by d(j) afterwards. The
+  // elements of the input matrix are read just before they are overwritten.
   double* d(&((*diagonal_elements)[0]));
-
-  d[0] = index_[0][0];
-  lower_triangular_matrix->index_[0][0] = 1.0;
-  for (int i(1); i < num_dimension_; ++i) {
+  for (int i(0); i < num_dimension_; ++i) {
+    double* l_i(index_[i]);
     for (int j(0); j < i; ++j) {
-      double tmp(index_[i][j]);
+      const double* l_j(index_[j]);
+      double tmp(l_i[j]);
       for (int k(0); k < j; ++k) {
-        tmp -= lower_triangular_matrix->index_[i][k] *
-               lower_triangular_matrix->index_[j][k] * d[k];
+        tmp -= l_i[k] * l_j[k];
       }
-      lower_triangular_matrix->index_[i][j] = tmp / d[j];
+      l_i[j] = tmp;
     }
 
-    d[i] = index_[i][i];
+    double tmp(l_i[i]);
     for (int j(0); j < i; ++j) {
-      d[i] -= lower_triangular_matrix->index_[i][j] *
-              lower_triangular_matrix->index_[i][j] * d[j];
+      const double u(l_i[j]);
+      l_i[j] = u / d[j];
+      tmp -= u * l_i[j];
     }
-    if (std::fabs(d[i]) <= kMinimumValueOfDiagonalElement) {
+    if (0 < i && std::fabs(tmp) <= kMinimumValueOfDiagonalElement) {
       return false;
     }
-    lower_triangular_matrix->index_[i][i] = 1.0;
+    d[i] = tmp;
+    l_i[i] = 1.0;
   }
   return true;
 }
@@ -190,39 +188,52 @@ bool SymmetricMatrix::Invert(SymmetricMatrix* inverse_matrix) const {
   if (inverse_matrix->num_dimension_ != num_dimension_) {
     inverse_matrix->Resize(num_dimension_);
   }
+  std::copy(data_.begin(), data_.end(), inverse_matrix->data_.begin());
 
-  SymmetricMatrix lower_triangular_matrix(num_dimension_);
+  // Compute L and D in place.
   std::vector<double> diagonal_elements(num_dimension_);
-  if (!CholeskyDecomposition(&lower_triangular_matrix, &diagonal_elements)) {
+  if (!inverse_matrix->CholeskyDecomposition(&diagonal_elements)) {
     return false;
   }
 
-  for (int i(num_dimension_ - 1); 0 <= i; --i) {
-    inverse_matrix->index_[i][i] = 1.0;
-    for (int j(i + 1); j < num_dimension_; ++j) {
-      inverse_matrix->index_[j][i] =
-          lower_triangular_matrix.index_[j][i] * inverse_matrix->index_[i][i];
-      for (int k(i + 1); k < j; ++k) {
-        inverse_matrix->index_[j][i] +=
-            lower_triangular_matrix.index_[j][k] * inverse_matrix->index_[k][i];
+  // Invert L in place. The (i, k)-th element of L is not yet overwritten when
+  // the k-th row of the inverse is added to the i-th row.
+  double** x(&(inverse_matrix->index_[0]));
+  for (int i(1); i < num_dimension_; ++i) {
+    double* y(x[i]);
+    for (int k(1); k < i; ++k) {
+      const double l(y[k]);
+      const double* x_k(x[k]);
+      for (int j(0); j < k; ++j) {
+        y[j] += l * x_k[j];
       }
-      inverse_matrix->index_[j][i] *= -inverse_matrix->index_[j][j];
+    }
+    for (int j(0); j < i; ++j) {
+      y[j] = -y[j];
     }
   }
 
-  std::vector<double> inverse_diagonal_elements(num_dimension_);
   for (int i(0); i < num_dimension_; ++i) {
-    inverse_diagonal_elements[i] = 1.0 / diagonal_elements[i];
+    diagonal_elements[i] = 1.0 / diagonal_elements[i];
   }
 
+  // Compute L^{-T} D^{-1} L^{-1} in place. The i-th row is accumulated from
+  // the rows below it, which are not yet overwritten.
+  std::vector<double> weights(num_dimension_);
   for (int i(0); i < num_dimension_; ++i) {
+    for (int k(i); k < num_dimension_; ++k) {
+      weights[k] = x[k][i] * diagonal_elements[k];
+    }
+    double* y(x[i]);
     for (int j(0); j <= i; ++j) {
-      double sum(0.0);
-      for (int k(i); k < num_dimension_; ++k) {
-        sum += inverse_matrix->index_[k][i] * inverse_diagonal_elements[k] *
-               inverse_matrix->index_[k][j];
+      y[j] = weights[i] * y[j];
+    }
+    for (int k(i + 1); k < num_dimension_; ++k) {
+      const double w(weights[k]);
+      const double* x_k(x[k]);
+      for (int j(0); j <= i; ++j) {
+        y[j] += w * x_k[j];
       }
-      inverse_matrix->index_[i][j] = sum;
     }
   }
 
@@ -43,30 +43,29 @@ bool SymmetricSystemSolver::Run(const SymmetricMatrix& coefficient_matrix,
   if (solution_vector->size() != static_cast<std::size_t>(length)) {
     solution_vector->resize(length);
   }
-  if (buffer->inverse_matrix_.GetNumDimension() != length) {
-    buffer->inverse_matrix_.Resize(length);
-  }
-
-  const double* b(&constant_vector[0]);
-  double* x(&((*solution_vector)[0]));
 
-  SymmetricMatrix lower_triangular_matrix(length);
-  std::vector<double> diagonal_elements(length);
-  if (!coefficient_matrix.CholeskyDecomposition(&lower_triangular_matrix,
-                                                &diagonal_elements)) {
+  if (!coefficient_matrix.CholeskyDecomposition(
+          &buffer->lower_triangular_matrix_, &buffer->diagonal_elements_)) {
     return false;
   }
+  const SymmetricMatrix& lower_triangular_matrix(
+      buffer->lower_triangular_matrix_);
+  const double* d(&(buffer->diagonal_elements_[0]));
+  const double* b(&constant_vector[0]);
+  double* x(&((*solution_vector)[0]));
 
-  std::vector<double> y(length);
+  // Solve Ly = b. The solution y is stored in x.
   for (int i(0); i < length; ++i) {
-    y[i] = b[i];
+    double y(b[i]);
     for (int j(0); j < i; ++j) {
-      y[i] -= lower_triangular_matrix[i][j] * y[j];
+      y -= lower_triangular_matrix[i][j] * x[j];
     }
+    x[i] = y;
   }
 
+  // Solve DL^T x = y.
   for (int i(length - 1); 0 <= i; --i) {
-    x[i] = y[i] / diagonal_elements[i];
+    x[i] /= d[i];
     for (int j(i + 1); j < length; ++j) {
       x[i] -= lower_triangular_matrix[j][i] * x[j];
     }
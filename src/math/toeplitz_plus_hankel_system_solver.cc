@@ -16,13 +16,64 @@
 
 #include "SPTK/math/toeplitz_plus_hankel_system_solver.h"
 
+#include <cmath>    // std::fabs
 #include <cstddef>  // std::size_t
 
 namespace {
 
-void PutBar(int i, const std::vector<double>& x, std::vector<double>* y) {
-  (*y)[0] = x[i];
-  (*y)[1] = x[x.size() - 1 - i];
+// Each 2x2 matrix is stored in row-major order, i.e., {(0,0), (0,1), (1,0),
+// (1,1)}, and each 2-dimensional vector is stored as {0, 1}.
+
+const double kMinimumValueOfDeterminant(1e-6);
+
+// z += x y
+inline void MultiplyAdd(const double* x, const double* y, double* z) {
+  z[0] += x[0] * y[0] + x[1] * y[2];
+  z[1] += x[0] * y[1] + x[1] * y[3];
+  z[2] += x[2] * y[0] + x[3] * y[2];
+  z[3] += x[2] * y[1] + x[3] * y[3];
+}
+
+// z += x y where y is vector
+inline void MultiplyAddVector(const double* x, const double* y, double* z) {
+  z[0] += x[0] * y[0] + x[1] * y[1];
+  z[1] += x[2] * y[0] + x[3] * y[1];
+}
+
+// z -= tau(x) y where tau(x) is the cross transpose of x
+inline void CrossTransposeMultiplySubtract(const double* x, const double* y,
+                                           double* z) {
+  z[0] -= x[3] * y[0] + x[2] * y[2];
+  z[1] -= x[3] * y[1] + x[2] * y[3];
+  z[2] -= x[1] * y[0] + x[0] * y[2];
+  z[3] -= x[1] * y[1] + x[0] * y[3];
+}
+
+// z += tau(x) y where y is vector
+inline void CrossTransposeMultiplyAddVector(const double* x, const double* y,
+                                            double* z) {
+  z[0] += x[3] * y[0] + x[2] * y[1];
+  z[1] += x[1] * y[0] + x[0] * y[1];
+}
+
+// y = x^{-1}
+inline bool Invert(const double* x, double* y) {
+  const double determinant(x[0] * x[3] - x[1] * x[2]);
+  if (std::fabs(determinant) < kMinimumValueOfDeterminant) {
+    return false;
+  }
+  const double inverse_of_determinant(1.0 / determinant);
+  y[0] = x[3] * inverse_of_determinant;
+  y[1] = -x[1] * inverse_of_determinant;
+  y[2] = -x[2] * inverse_of_determinant;
+  y[3] = x[0] * inverse_of_determinant;
+  return true;
+}
+
+// y = tau(x)^{-1}
+inline bool CrossTransposeInvert(const double* x, double* y) {
+  const double tau[4] = {x[3], x[2], x[1], x[0]};
+  return Invert(tau, y);
 }
 
 }  // namespace
@@ -62,147 +113,135 @@ bool ToeplitzPlusHankelSystemSolver::Run(
   if (solution_vector->size() != static_cast<std::size_t>(length)) {
     solution_vector->resize(length);
   }
-  if (buffer->r_.size() != static_cast<std::size_t>(length)) {
-    buffer->r_.resize(length);
+  if (buffer->r_.size() != static_cast<std::size_t>(4 * length)) {
+    buffer->r_.resize(4 * length);
   }
-  if (buffer->x_.size() != static_cast<std::size_t>(length)) {
-    buffer->x_.resize(length);
+  if (buffer->x_.size() != static_cast<std::size_t>(4 * length)) {
+    buffer->x_.resize(4 * length);
   }
-  if (buffer->prev_x_.size() != static_cast<std::size_t>(length)) {
-    buffer->prev_x_.resize(length);
-  }
-  if (buffer->p_.size() != static_cast<std::size_t>(length)) {
-    buffer->p_.resize(length);
-    for (int i(0); i < length; ++i) {
-      buffer->p_[i].resize(2);
-    }
+  if (buffer->p_.size() != static_cast<std::size_t>(2 * length)) {
+    buffer->p_.resize(2 * length);
   }
 
+  const double* b(&(constant_vector[0]));
+  double* r(&(buffer->r_[0]));
+  double* x(&(buffer->x_[0]));
+  double* p(&(buffer->p_[0]));
+
   // Step 0)
   {
     // Set R.
     const double* t(&(toeplitz_coefficient_vector[0]));
     const double* h(&(hankel_coefficient_vector[0]));
     for (int i(0); i < length; ++i) {
-      buffer->r_[i][0][0] = t[num_order_ + i];
-      buffer->r_[i][1][1] = t[num_order_ - i];
-      buffer->r_[i][0][1] = h[num_order_ + i];
-      buffer->r_[i][1][0] = h[num_order_ - i];
+      double* r_i(r + 4 * i);
+      r_i[0] = t[num_order_ + i];
+      r_i[1] = h[num_order_ + i];
+      r_i[2] = h[num_order_ - i];
+      r_i[3] = t[num_order_ - i];
     }
 
     if (coefficients_modification_) {
       const double d0(t[num_order_]);
       for (int i(0); i < length; i += 2) {
-        buffer->r_[i][0][0] += d0;
-        buffer->r_[i][1][1] += d0;
+        r[4 * i + 0] += d0;
+        r[4 * i + 3] += d0;
       }
       for (int i((0 == num_order_ % 2) ? 0 : 1); i < length; i += 2) {
-        buffer->r_[i][0][1] -= d0;
-        buffer->r_[i][1][0] -= d0;
+        r[4 * i + 1] -= d0;
+        r[4 * i + 2] -= d0;
       }
     }
   }
 
+  double vx[4];
+  double inv[4];
+
   // Step 1)
   {
     // Set X_0.
-    buffer->x_[0].FillDiagonal(1.0);
+    x[0] = 1.0;
+    x[1] = 0.0;
+    x[2] = 0.0;
+    x[3] = 1.0;
 
     // Set p_0.
-    PutBar(0, constant_vector, &buffer->bar_);
-    if (!buffer->r_[0].Invert(&buffer->inv_) ||
-        !sptk::Matrix2D::Multiply(buffer->inv_, buffer->bar_, &buffer->p_[0])) {
+    if (!Invert(r, inv)) {
       return false;
     }
+    const double bar[2] = {b[0], b[num_order_]};
+    p[0] = 0.0;
+    p[1] = 0.0;
+    MultiplyAddVector(inv, bar, p);
 
     // Set V_x.
-    buffer->vx_ = buffer->r_[0];
+    for (int k(0); k < 4; ++k) {
+      vx[k] = r[k];
+    }
   }
 
   // Step 2)
   for (int i(1); i < length; ++i) {
     // a) Calculate E_x.
-    buffer->ex_.Fill(0.0);
+    double ex[4] = {0.0, 0.0, 0.0, 0.0};
     for (int j(0); j < i; ++j) {
-      if (!sptk::Matrix2D::Multiply(buffer->r_[i - j], buffer->x_[j],
-                                    &buffer->tmp_matrix_) ||
-          !sptk::Matrix2D::Add(buffer->tmp_matrix_, &buffer->ex_)) {
-        return false;
-      }
+      MultiplyAdd(r + 4 * (i - j), x + 4 * j, ex);
     }
 
     // b) Calculate \bar{e}_p.
-    buffer->ep_[0] = 0.0;
-    buffer->ep_[1] = 0.0;
+    double ep[2] = {0.0, 0.0};
     for (int j(0); j < i; ++j) {
-      if (!sptk::Matrix2D::Multiply(buffer->r_[i - j], buffer->p_[j],
-                                    &buffer->tmp_vector_)) {
-        return false;
-      }
-      buffer->ep_[0] += buffer->tmp_vector_[0];
-      buffer->ep_[1] += buffer->tmp_vector_[1];
+      MultiplyAddVector(r + 4 * (i - j), p + 2 * j, ep);
     }
 
     // c) Calculate B_x.
-    if (!buffer->vx_.CrossTranspose(&buffer->tau_) ||
-        !buffer->tau_.Invert(&buffer->inv_) ||
-        !sptk::Matrix2D::Multiply(buffer->inv_, buffer->ex_, &buffer->bx_)) {
+    double bx[4] = {0.0, 0.0, 0.0, 0.0};
+    if (!CrossTransposeInvert(vx, inv)) {
       return false;
     }
-
-    // d) Update X.
-    for (int j(1); j < i; ++j) {
-      if (!buffer->prev_x_[i - j].CrossTranspose(&buffer->tau_) ||
-          !sptk::Matrix2D::Multiply(buffer->tau_, buffer->bx_,
-                                    &buffer->tmp_matrix_) ||
-          !sptk::Matrix2D::Subtract(buffer->tmp_matrix_, &buffer->x_[j])) {
-        return false;
+    MultiplyAdd(inv, ex, bx);
+
+    // d) Update X. The j-th and (i-j)-th elements are updated together since
+    // each of them refers to the other before update.
+    for (int j(1), k(i - 1); j <= k; ++j, --k) {
+      double* x_j(x + 4 * j);
+      double* x_k(x + 4 * k);
+      const double prev_x_j[4] = {x_j[0], x_j[1], x_j[2], x_j[3]};
+      if (j < k) {
+        CrossTransposeMultiplySubtract(x_k, bx, x_j);
+        CrossTransposeMultiplySubtract(prev_x_j, bx, x_k);
+      } else {
+        CrossTransposeMultiplySubtract(prev_x_j, bx, x_j);
       }
     }
-    buffer->x_[i].Negate(buffer->bx_);
-    for (int j(1); j <= i; ++j) {
-      buffer->prev_x_[j] = buffer->x_[j];
+    for (int k(0); k < 4; ++k) {
+      x[4 * i + k] = -bx[k];
     }
 
     // d) Update V_x.
-    if (!buffer->ex_.CrossTranspose(&buffer->tau_) ||
-        !sptk::Matrix2D::Multiply(buffer->tau_, buffer->bx_,
-                                  &buffer->tmp_matrix_) ||
-        !sptk::Matrix2D::Subtract(buffer->tmp_matrix_, &buffer->vx_)) {
-      return false;
-    }
+    CrossTransposeMultiplySubtract(ex, bx, vx);
 
     // e) Calculate \bar{g}.
-    if (!buffer->vx_.CrossTranspose(&buffer->tau_) ||
-        !buffer->tau_.Invert(&buffer->inv_)) {
-      return false;
-    }
-    PutBar(i, constant_vector, &buffer->bar_);
-    buffer->tmp_vector_[0] = buffer->bar_[0] - buffer->ep_[0];
-    buffer->tmp_vector_[1] = buffer->bar_[1] - buffer->ep_[1];
-    if (!sptk::Matrix2D::Multiply(buffer->inv_, buffer->tmp_vector_,
-                                  &buffer->g_)) {
+    if (!CrossTransposeInvert(vx, inv)) {
       return false;
     }
+    const double bar[2] = {b[i] - ep[0], b[num_order_ - i] - ep[1]};
+    double* g(p + 2 * i);
+    g[0] = 0.0;
+    g[1] = 0.0;
+    MultiplyAddVector(inv, bar, g);
 
     // f) Update \bar{p}.
     for (int j(0); j < i; ++j) {
-      if (!buffer->x_[i - j].CrossTranspose(&buffer->tau_) ||
-          !sptk::Matrix2D::Multiply(buffer->tau_, buffer->g_,
-                                    &buffer->tmp_vector_)) {
-        return false;
-      }
-      buffer->p_[j][0] += buffer->tmp_vector_[0];
-      buffer->p_[j][1] += buffer->tmp_vector_[1];
+      CrossTransposeMultiplyAddVector(x + 4 * (i - j), g, p + 2 * j);
     }
-    buffer->p_[i] = buffer->g_;
   }
 
   // Step 3)
   {
     double* a(&((*solution_vector)[0]));
     for (int i(0); i < length; ++i) {
-      a[i] = buffer->p_[i][0];
+      a[i] = p[2 * i];
     }
   }
 
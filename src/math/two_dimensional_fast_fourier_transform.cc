@@ -16,8 +16,7 @@
 
 #include "SPTK/math/two_dimensional_fast_fourier_transform.h"
 
-#include <algorithm>  // std::copy, std::fill
-#include <cstddef>    // std::size_t
+#include "SPTK/utils/thread_utils.h"
 
 namespace sptk {
 
@@ -49,83 +48,48 @@ bool TwoDimensionalFastFourierTransform::Run(
   }
 
   // Prepare memories.
-  {
-    const std::size_t size(static_cast<std::size_t>(fft_length_));
-    if (buffer->real_part_input_.size() != size) {
-      buffer->real_part_input_.resize(size);
-    }
-    if (buffer->imag_part_input_.size() != size) {
-      buffer->imag_part_input_.resize(size);
-    }
-    if (buffer->first_real_part_outputs_.size() != size) {
-      buffer->first_real_part_outputs_.resize(size);
-    }
-    if (buffer->first_imag_part_outputs_.size() != size) {
-      buffer->first_imag_part_outputs_.resize(size);
-    }
-    if (buffer->second_real_part_outputs_.size() != size) {
-      buffer->second_real_part_outputs_.resize(size);
-    }
-    if (buffer->second_imag_part_outputs_.size() != size) {
-      buffer->second_imag_part_outputs_.resize(size);
-    }
-    if (real_part_output->GetNumRow() != fft_length_ ||
-        real_part_output->GetNumColumn() != fft_length_) {
-      real_part_output->Resize(fft_length_, fft_length_);
-    }
-    if (imag_part_output->GetNumRow() != fft_length_ ||
-        imag_part_output->GetNumColumn() != fft_length_) {
-      imag_part_output->Resize(fft_length_, fft_length_);
-    }
+  if (buffer->first_real_part_outputs_.GetNumRow() != num_column_ ||
+      buffer->first_real_part_outputs_.GetNumColumn() != fft_length_) {
+    buffer->first_real_part_outputs_.Resize(num_column_, fft_length_);
+  }
+  if (buffer->first_imag_part_outputs_.GetNumRow() != num_column_ ||
+      buffer->first_imag_part_outputs_.GetNumColumn() != fft_length_) {
+    buffer->first_imag_part_outputs_.Resize(num_column_, fft_length_);
   }
 
-  double* x(&buffer->real_part_input_[0]);
-  double* y(&buffer->imag_part_input_[0]);
-
-  // First stage.
-  std::fill(buffer->real_part_input_.begin() + num_row_,
-            buffer->real_part_input_.end(), 0.0);
-  std::fill(buffer->imag_part_input_.begin() + num_row_,
-            buffer->imag_part_input_.end(), 0.0);
-  for (int i(0); i < num_column_; ++i) {
-    for (int j(0); j < num_row_; ++j) {
-      x[j] = real_part_input[j][i];
-      y[j] = imag_part_input[j][i];
-    }
-    if (!fast_fourier_transform_.Run(buffer->real_part_input_,
-                                     buffer->imag_part_input_,
-                                     &buffer->first_real_part_outputs_[i],
-                                     &buffer->first_imag_part_outputs_[i])) {
-      return false;
-    }
+  // First stage. The columns are transformed as the rows of the transposed
+  // matrices, so that each transform accesses contiguous memory.
+  if (!real_part_input.Transpose(&buffer->first_real_part_inputs_) ||
+      !imag_part_input.Transpose(&buffer->first_imag_part_inputs_) ||
+      !TransformRowsInParallel(fast_fourier_transform_,
+                               buffer->first_real_part_inputs_,
+                               buffer->first_imag_part_inputs_,
+                               &buffer->first_real_part_outputs_,
+                               &buffer->first_imag_part_outputs_)) {
+    return false;
   }
 
-  // Second stage.
-  std::fill(buffer->real_part_input_.begin() + num_column_,
-            buffer->real_part_input_.end(), 0.0);
-  std::fill(buffer->imag_part_input_.begin() + num_column_,
-            buffer->imag_part_input_.end(), 0.0);
-  for (int i(0); i < fft_length_; ++i) {
-    for (int j(0); j < num_column_; ++j) {
-      x[j] = buffer->first_real_part_outputs_[j][i];
-      y[j] = buffer->first_imag_part_outputs_[j][i];
-    }
-    if (!fast_fourier_transform_.Run(buffer->real_part_input_,
-                                     buffer->imag_part_input_,
-                                     &buffer->second_real_part_outputs_[i],
-                                     &buffer->second_imag_part_outputs_[i])) {
-      return false;
-    }
+  // The outputs are resized after the inputs are read because they may be
+  // the same matrices.
+  if (real_part_output->GetNumRow() != fft_length_ ||
+      real_part_output->GetNumColumn() != fft_length_) {
+    real_part_output->Resize(fft_length_, fft_length_);
+  }
+  if (imag_part_output->GetNumRow() != fft_length_ ||
+      imag_part_output->GetNumColumn() != fft_length_) {
+    imag_part_output->Resize(fft_length_, fft_length_);
   }
 
-  // Save results.
-  for (int i(0); i < fft_length_; ++i) {
-    std::copy(buffer->second_real_part_outputs_[i].begin(),
-              buffer->second_real_part_outputs_[i].end(),
-              (*real_part_output)[i]);
-    std::copy(buffer->second_imag_part_outputs_[i].begin(),
-              buffer->second_imag_part_outputs_[i].end(),
-              (*imag_part_output)[i]);
+  // Second stage.
+  if (!buffer->first_real_part_outputs_.Transpose(
+          &buffer->second_real_part_inputs_) ||
+      !buffer->first_imag_part_outputs_.Transpose(
+          &buffer->second_imag_part_inputs_) ||
+      !TransformRowsInParallel(fast_fourier_transform_,
+                               buffer->second_real_part_inputs_,
+                               buffer->second_imag_part_inputs_,
+                               real_part_output, imag_part_output)) {
+    return false;
   }
 
   return true;
@@ -16,8 +16,47 @@
 
 #include "SPTK/math/two_dimensional_real_valued_fast_fourier_transform.h"
 
-#include <algorithm>  // std::copy, std::fill
-#include <cstddef>    // std::size_t
+#include <algorithm>  // std::copy
+#include <vector>     // std::vector
+
+#include "SPTK/utils/thread_utils.h"
+
+namespace {
+
+// Transform rows of the real-valued input matrix. Each row is padded with zeros
+// to the FFT length. Only the first elements of the outputs that fit in the
+// output matrices are saved.
+bool TransformRealRowsInParallel(
+    const sptk::RealValuedFastFourierTransform& fourier_transform,
+    const sptk::Matrix& real_part_input, sptk::Matrix* real_part_output,
+    sptk::Matrix* imag_part_output) {
+  const int num_row(real_part_input.GetNumRow());
+  const int fft_length(fourier_transform.GetFftLength());
+  const int num_input_column(real_part_input.GetNumColumn());
+  const int num_output_column(real_part_output->GetNumColumn());
+  return sptk::ProcessRowsInParallel(
+      num_row, sptk::GetNumThreadToTransformRows(num_row, fft_length), 1,
+      [&](int begin, int end) {
+        std::vector<double> x(fft_length, 0.0);
+        std::vector<double> real_part(fft_length);
+        std::vector<double> imag_part(fft_length);
+        sptk::RealValuedFastFourierTransform::Buffer buffer;
+        for (int i(begin); i < end; ++i) {
+          std::copy(real_part_input[i], real_part_input[i] + num_input_column,
+                    x.begin());
+          if (!fourier_transform.Run(x, &real_part, &imag_part, &buffer)) {
+            return false;
+          }
+          std::copy(real_part.begin(), real_part.begin() + num_output_column,
+                    (*real_part_output)[i]);
+          std::copy(imag_part.begin(), imag_part.begin() + num_output_column,
+                    (*imag_part_output)[i]);
+        }
+        return true;
+      });
+}
+
+}  // namespace
 
 namespace sptk {
 
@@ -50,81 +89,62 @@ bool TwoDimensionalRealValuedFastFourierTransform::Run(
   }
 
   // Prepare memories.
-  {
-    const std::size_t size(static_cast<std::size_t>(fft_length_));
-    if (buffer->real_part_input_.size() != size) {
-      buffer->real_part_input_.resize(size);
-    }
-    if (buffer->imag_part_input_.size() != size) {
-      buffer->imag_part_input_.resize(size);
-    }
-    if (buffer->first_real_part_outputs_.size() != size) {
-      buffer->first_real_part_outputs_.resize(size);
-    }
-    if (buffer->first_imag_part_outputs_.size() != size) {
-      buffer->first_imag_part_outputs_.resize(size);
-    }
-    if (buffer->second_real_part_outputs_.size() != size) {
-      buffer->second_real_part_outputs_.resize(size);
-    }
-    if (buffer->second_imag_part_outputs_.size() != size) {
-      buffer->second_imag_part_outputs_.resize(size);
-    }
-    if (real_part_output->GetNumRow() != fft_length_ ||
-        real_part_output->GetNumColumn() != fft_length_) {
-      real_part_output->Resize(fft_length_, fft_length_);
-    }
-    if (imag_part_output->GetNumRow() != fft_length_ ||
-        imag_part_output->GetNumColumn() != fft_length_) {
-      imag_part_output->Resize(fft_length_, fft_length_);
-    }
+  const int half_fft_length(fft_length_ / 2);
+  if (buffer->first_real_part_outputs_.GetNumRow() != num_column_ ||
+      buffer->first_real_part_outputs_.GetNumColumn() != half_fft_length + 1) {
+    buffer->first_real_part_outputs_.Resize(num_column_, half_fft_length + 1);
+  }
+  if (buffer->first_imag_part_outputs_.GetNumRow() != num_column_ ||
+      buffer->first_imag_part_outputs_.GetNumColumn() != half_fft_length + 1) {
+    buffer->first_imag_part_outputs_.Resize(num_column_, half_fft_length + 1);
   }
 
-  double* x(&buffer->real_part_input_[0]);
+  // First stage. The columns are transformed as the rows of the transposed
+  // matrix, so that each transform accesses contiguous memory. Only the first
+  // half of each output is required.
+  if (!real_part_input.Transpose(&buffer->first_real_part_inputs_) ||
+      !TransformRealRowsInParallel(real_valued_fast_fourier_transform_,
+                                   buffer->first_real_part_inputs_,
+                                   &buffer->first_real_part_outputs_,
+                                   &buffer->first_imag_part_outputs_)) {
+    return false;
+  }
 
-  // First stage.
-  std::fill(buffer->real_part_input_.begin() + num_row_,
-            buffer->real_part_input_.end(), 0.0);
-  for (int i(0); i < num_column_; ++i) {
-    for (int j(0); j < num_row_; ++j) {
-      x[j] = real_part_input[j][i];
-    }
-    if (!real_valued_fast_fourier_transform_.Run(
-            buffer->real_part_input_, &buffer->first_real_part_outputs_[i],
-            &buffer->first_imag_part_outputs_[i],
-            &buffer->fast_fourier_transform_buffer_)) {
-      return false;
-    }
+  // The outputs are resized after the input is read because they may be the
+  // same matrix.
+  if (real_part_output->GetNumRow() != fft_length_ ||
+      real_part_output->GetNumColumn() != fft_length_) {
+    real_part_output->Resize(fft_length_, fft_length_);
+  }
+  if (imag_part_output->GetNumRow() != fft_length_ ||
+      imag_part_output->GetNumColumn() != fft_length_) {
+    imag_part_output->Resize(fft_length_, fft_length_);
   }
 
-  double* y(&buffer->imag_part_input_[0]);
-
-  // Second stage.
-  std::fill(buffer->real_part_input_.begin() + num_column_,
-            buffer->real_part_input_.end(), 0.0);
-  std::fill(buffer->imag_part_input_.begin() + num_column_,
-            buffer->imag_part_input_.end(), 0.0);
-  for (int i(0); i < fft_length_; ++i) {
-    for (int j(0); j < num_column_; ++j) {
-      x[j] = buffer->first_real_part_outputs_[j][i];
-      y[j] = buffer->first_imag_part_outputs_[j][i];
-    }
-    if (!fast_fourier_transform_.Run(buffer->real_part_input_,
-                                     buffer->imag_part_input_,
-                                     &buffer->second_real_part_outputs_[i],
-                                     &buffer->second_imag_part_outputs_[i])) {
-      return false;
-    }
+  // Second stage. The first L/2+1 rows of the outputs are computed.
+  if (!buffer->first_real_part_outputs_.Transpose(
+          &buffer->second_real_part_inputs_) ||
+      !buffer->first_imag_part_outputs_.Transpose(
+          &buffer->second_imag_part_inputs_) ||
+      !TransformRowsInParallel(fast_fourier_transform_,
+                               buffer->second_real_part_inputs_,
+                               buffer->second_imag_part_inputs_,
+                               real_part_output, imag_part_output)) {
+    return false;
   }
 
-  // Save results.
-  for (int i(0); i < fft_length_; ++i) {
-    std::copy(buffer->second_real_part_outputs_[i].begin(),
-              buffer->second_real_part_outputs_[i].end(),
-              (*real_part_output)[i]);
-    std::copy(buffer->second_imag_part_outputs_[i].begin(),
-              buffer->second_imag_part_outputs_[i].end(),
-              (*imag_part_output)[i]);
+  // Fill the remaining rows by using X(i, j) = X*(L - i, L - j).
+  for (int i(half_fft_length + 1); i < fft_length_; ++i) {
+    const double* x_real((*real_part_output)[fft_length_ - i]);
+    const double* x_imag((*imag_part_output)[fft_length_ - i]);
+    double* y_real((*real_part_output)[i]);
+    double* y_imag((*imag_part_output)[i]);
+    y_real[0] = x_real[0];
+    y_imag[0] = -x_imag[0];
+    for (int j(1); j < fft_length_; ++j) {
+      y_real[j] = x_real[fft_length_ - j];
+      y_imag[j] = -x_imag[fft_length_ - j];
+    }
   }
 
   return true;
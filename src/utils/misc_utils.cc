@@ -147,7 +147,8 @@ bool ComputePercentagePointOfTDistribution(double probability,
 bool MakePseudoQuadratureMirrorFilterBanks(
     bool inverse, int num_subband, int num_filter_order, double attenuation,
     int num_iteration, double convergence_threshold, double initial_step_size,
-    std::vector<std::vector<double> >* filter_banks, bool* is_converged) {
+    std::vector<std::vector<double> >* filter_banks, bool* is_converged,
+    std::vector<double>* impulse_response) {
   if (0 == num_subband || num_filter_order <= 1 || attenuation <= 0.0 ||
       0 == num_iteration || convergence_threshold < 0.0 ||
       initial_step_size <= 0.0 || NULL == filter_banks) {
@@ -245,6 +246,10 @@ bool MakePseudoQuadratureMirrorFilterBanks(
       sign *= -1;
     }
   }
+
+  if (NULL != impulse_response) {
+    *impulse_response = prototype_filter;
+  }
   return true;
 }
 
@@ -16,13 +16,14 @@
 
 #include "SPTK/utils/sptk_utils.h"
 
-#include <algorithm>  // std::fill_n, std::transform
+#include <algorithm>  // std::copy, std::fill, std::fill_n, std::min, etc.
 #include <cctype>     // std::tolower
 #include <cerrno>     // errno, ERANGE
 #include <cmath>      // std::ceil, std::exp, std::log, std::sqrt, etc.
 #include <cstdint>    // int8_t, int16_t, int32_t, int64_t, etc.
 #include <cstdio>     // std::snprintf
 #include <cstdlib>    // std::strtod, std::strtol
+#include <cstring>    // std::memcpy
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::endl, std::left
 
@@ -34,6 +35,124 @@ namespace {
 // 34 is a reasonable number near log(1e-15)
 static const double kThresholdOfInformationLossInLogSpace(-34.0);
 
+// Constants for the approximations of the exponential and logarithm.
+static const double kLog2OfE(1.4426950408889634);
+static const double kLogTwoHigh(6.93147180369123816490e-01);
+static const double kLogTwoLow(1.90821492927058770002e-10);
+static const double kRoundingBias(6755399441055744.0);  // 1.5 * 2^52
+static const double kTwoToThe52(4503599627370496.0);
+static const double kMaxArgumentOfApproximateExp(709.43);  // ln(2^1023.5)
+static const double kMinArgumentOfApproximateExp(-708.39);  // ln(2^-1022)
+static const double kMinArgumentOfApproximateLog(2.2250738585072014e-308);
+static const double kMaxArgumentOfApproximateLog(1.7976931348623157e+308);
+static const std::uint64_t kBitsOfHalfOfSqrtTwo(0x3fe6a09e667f3bcdULL);
+
+// Number of values processed at once by the approximated kernels.
+static const int kChunkSize(64);
+
+// Compute e^x = 2^n e^r, where |r| <= ln(2) / 2. The Taylor series of e^r is
+// truncated at the 13th order whose truncation error is below 0.5 ULP. 2^n is
+// made from the bits of n + 1.5 * 2^52 without integer conversion. The loop
+// has no branches and a constant trip count so that it can be vectorized. The
+// values out of the supported range are recomputed by std::exp.
+void ApproximateExp(double* x) {
+  double y[kChunkSize];
+  for (int i(0); i < kChunkSize; ++i) {
+    const double n((x[i] * kLog2OfE + kRoundingBias) - kRoundingBias);
+    const double r(x[i] - n * kLogTwoHigh - n * kLogTwoLow);
+    double p(1.0 / 6227020800.0);
+    p = p * r + 1.0 / 479001600.0;
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+
+    const double biased_n(n + kRoundingBias);
+    std::uint64_t bits;
+    std::memcpy(&bits, &biased_n, sizeof(bits));
+    bits = (bits + 1023) << 52;
+    double power_of_two;
+    std::memcpy(&power_of_two, &bits, sizeof(power_of_two));
+    y[i] = p * power_of_two;
+  }
+
+  for (int i(0); i < kChunkSize; ++i) {
+    if (kMinArgumentOfApproximateExp <= x[i] &&
+        x[i] <= kMaxArgumentOfApproximateExp) {
+      x[i] = y[i];
+    } else {
+      x[i] = std::exp(x[i]);
+    }
+  }
+}
+
+// Compute ln(x) = k ln(2) + ln(m), where x = 2^k m and 1/sqrt(2) <= m <
+// sqrt(2). ln(m) is given by the series 2 atanh(f) with f = (m - 1) / (m + 1),
+// which is truncated at the 19th order because |f| < 0.172. k is extracted by
+// unsigned integer operations and converted to double via the bits of
+// 2^52 + k. The values out of the supported range are recomputed by std::log.
+void ApproximateLog(double* x) {
+  double y[kChunkSize];
+  for (int i(0); i < kChunkSize; ++i) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &(x[i]), sizeof(bits));
+    const std::uint64_t exponent_field(
+        (bits - kBitsOfHalfOfSqrtTwo + 0x8000000000000000ULL) >> 52);
+    bits -= (exponent_field - 2048) << 52;
+    double m;
+    std::memcpy(&m, &bits, sizeof(m));
+
+    const std::uint64_t biased_exponent_bits(0x4330000000000000ULL |
+                                             exponent_field);
+    double k;
+    std::memcpy(&k, &biased_exponent_bits, sizeof(k));
+    k -= kTwoToThe52 + 2048.0;
+
+    const double f((m - 1.0) / (m + 1.0));
+    const double s(f * f);
+    double p(1.0 / 19.0);
+    p = p * s + 1.0 / 17.0;
+    p = p * s + 1.0 / 15.0;
+    p = p * s + 1.0 / 13.0;
+    p = p * s + 1.0 / 11.0;
+    p = p * s + 1.0 / 9.0;
+    p = p * s + 1.0 / 7.0;
+    p = p * s + 1.0 / 5.0;
+    p = p * s + 1.0 / 3.0;
+    y[i] = k * kLogTwoHigh + (2.0 * f + (2.0 * f * s * p + k * kLogTwoLow));
+  }
+
+  for (int i(0); i < kChunkSize; ++i) {
+    if (kMinArgumentOfApproximateLog <= x[i] &&
+        x[i] <= kMaxArgumentOfApproximateLog) {
+      x[i] = y[i];
+    } else {
+      x[i] = std::log(x[i]);
+    }
+  }
+}
+
+// Apply an approximated kernel to an array of any length.
+void ApplyByChunk(void (*function)(double*), const double* x, int size,
+                  double* y) {
+  double chunk[kChunkSize];
+  for (int i(0); i < size; i += kChunkSize) {
+    const int chunk_size(std::min(kChunkSize, size - i));
+    std::copy(x + i, x + i + chunk_size, chunk);
+    std::fill(chunk + chunk_size, chunk + kChunkSize, 1.0);
+    (*function)(chunk);
+    std::copy(chunk, chunk + chunk_size, y + i);
+  }
+}
+
 }  // namespace
 
 namespace sptk {
@@ -432,6 +551,69 @@ double AddInLogSpace(double log_x, double log_y) {
   return greater + std::log(std::exp(diff) + 1.0);
 }
 
+double LogSumExp(const double* log_x, int size, bool use_approximation) {
+  if (NULL == log_x || size <= 0) {
+    return kLogZero;
+  }
+
+  double max_value(log_x[0]);
+  for (int i(1); i < size; ++i) {
+    if (max_value < log_x[i]) {
+      max_value = log_x[i];
+    }
+  }
+  if (-HUGE_VAL == max_value || HUGE_VAL == max_value) {
+    return max_value;
+  }
+
+  double sum(0.0);
+  if (use_approximation) {
+    double chunk[kChunkSize];
+    for (int i(0); i < size; i += kChunkSize) {
+      const int chunk_size(std::min(kChunkSize, size - i));
+      for (int j(0); j < chunk_size; ++j) {
+        chunk[j] = log_x[i + j] - max_value;
+      }
+      std::fill(chunk + chunk_size, chunk + kChunkSize, -HUGE_VAL);
+      ApproximateExp(chunk);
+      for (int j(0); j < chunk_size; ++j) {
+        sum += chunk[j];
+      }
+    }
+  } else {
+    for (int i(0); i < size; ++i) {
+      sum += std::exp(log_x[i] - max_value);
+    }
+  }
+  return max_value + std::log(sum);
+}
+
+void Exp(const double* x, int size, double* y, bool use_approximation) {
+  if (use_approximation) {
+    ApplyByChunk(ApproximateExp, x, size, y);
+  } else {
+    for (int i(0); i < size; ++i) {
+      y[i] = std::exp(x[i]);
+    }
+  }
+}
+
+void Log(const double* x, int size, double* y, bool use_approximation) {
+  if (use_approximation) {
+    ApplyByChunk(ApproximateLog, x, size, y);
+  } else {
+    for (int i(0); i < size; ++i) {
+      y[i] = std::log(x[i]);
+    }
+  }
+}
+
+void Pow(const double* x, double exponent, int size, double* y) {
+  for (int i(0); i < size; ++i) {
+    y[i] = std::pow(x[i], exponent);
+  }
+}
+
 double Warp(double omega, double alpha) {
   if (0.0 == alpha) return omega;
   return (omega + 2.0 * std::atan2(alpha * std::sin(omega),
@@ -69,8 +69,10 @@ DataWindowing::DataWindowing(WindowInterface* window_interface,
   }
 }
 
-bool DataWindowing::Run(const std::vector<double>& data,
-                        std::vector<double>* windowed_data) const {
+template <typename T>
+bool DataWindowing::Apply(const std::vector<T>& window,
+                          const std::vector<T>& data,
+                          std::vector<T>* windowed_data) const {
   // Check inputs.
   if (!is_valid_ || data.size() != static_cast<std::size_t>(input_length_) ||
       NULL == windowed_data) {
@@ -83,14 +85,26 @@ bool DataWindowing::Run(const std::vector<double>& data,
   }
 
   // Apply window.
-  std::transform(data.begin(), data.begin() + input_length_, window_.begin(),
-                 windowed_data->begin(),
-                 [](double x, double w) { return x * w; });
+  std::transform(data.begin(), data.begin() + input_length_, window.begin(),
+                 windowed_data->begin(), [](T x, T w) { return x * w; });
 
   // Fill zero.
-  std::fill(windowed_data->begin() + input_length_, windowed_data->end(), 0.0);
+  std::fill(windowed_data->begin() + input_length_, windowed_data->end(), T(0));
 
   return true;
 }
 
+bool DataWindowing::Run(const std::vector<double>& data,
+                        std::vector<double>* windowed_data) const {
+  return Apply(window_, data, windowed_data);
+}
+
+bool DataWindowing::Run(const std::vector<float>& data,
+                        std::vector<float>* windowed_data) const {
+  std::call_once(float_window_flag_, [this]() {
+    float_window_.assign(window_.begin(), window_.end());
+  });
+  return Apply(float_window_, data, windowed_data);
+}
+
 }  // namespace sptk
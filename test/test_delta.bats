@@ -56,6 +56,42 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "delta: blocks" {
+    # Magic numbers at the edges and around the block boundary.
+    echo 0 1 2 3 -1 5 6 7 8 9 10 11 -1 -1 14 15 16 17 18 -1 |
+        $sptk4/x2x +ad > $tmp/1
+    $sptk4/nrand -s 1 -l 230 >> $tmp/1
+    echo 250 -1 -1 253 254 -1 -1 257 -1 259 | $sptk4/x2x +ad >> $tmp/1
+    $sptk4/nrand -s 2 -l 250 >> $tmp/1
+    echo 510 -1 -1 513 -1 -1 516 517 -1 519 | $sptk4/x2x +ad >> $tmp/1
+    $sptk4/nrand -s 3 -l 2480 >> $tmp/1
+    opt=("-l 2 -d -0.5 0 0.5 -d 1 -2 1 -magic -1" "-l 5 -d -1 -0.5 0 0.5"
+         "-l 1 -r 3 4 -magic -1" "-l 3 -r 1 1" "-l 1 -r 40 40 -magic -1")
+    for i in $(seq 0 4); do
+        # shellcheck disable=SC2086
+        $sptk4/delta ${opt[$i]} < $tmp/1 > $tmp/2
+        # shellcheck disable=SC2086
+        $sptk4/delta ${opt[$i]} $tmp/1 > $tmp/3
+        run $sptk4/aeq $tmp/2 $tmp/3
+        [ "$status" -eq 0 ]
+
+        # The frames far enough from the edges of a segment must not depend
+        # on the frames outside the segment.
+        l=$(echo "${opt[$i]}" | awk '{print $2}')
+        # shellcheck disable=SC2086
+        $sptk4/bcut -l "$l" -s 0 -e 599 $tmp/1 |
+            $sptk4/delta ${opt[$i]} > $tmp/2
+        # shellcheck disable=SC2086
+        $sptk4/bcut -l "$l" -s 200 -e 399 $tmp/1 |
+            $sptk4/delta ${opt[$i]} > $tmp/4
+        n=$(($(wc -c < $tmp/2) / 8 / 600))
+        $sptk4/bcut -l "$n" -s 240 -e 359 $tmp/2 > $tmp/5
+        $sptk4/bcut -l "$n" -s 40 -e 159 $tmp/4 > $tmp/6
+        run $sptk4/aeq $tmp/5 $tmp/6
+        [ "$status" -eq 0 ]
+    done
+}
+
 @test "delta: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/delta -l 10 -d -0.5 0 0.5 $tmp/1
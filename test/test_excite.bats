@@ -42,6 +42,29 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "excite: multiple blocks" {
+    # The output crosses the boundaries of blocks of 4096 samples.
+    $sptk3/step -l 3000 -v 0 > $tmp/1
+    $sptk3/excite -p 4 $tmp/1 > $tmp/2
+    $sptk4/excite -p 4 $tmp/1 > $tmp/3
+    run $sptk4/aeq -L $tmp/2 $tmp/3
+    [ "$status" -eq 0 ]
+}
+
+@test "excite: end of input" {
+    # A negative pitch terminates the output even if values follow it.
+    echo 100 100 -5 100 100 | $sptk3/x2x +ad > $tmp/1
+    $sptk4/excite -p 2 -i 1 $tmp/1 > $tmp/2
+    [ "$(wc -c < $tmp/2)" -eq 32 ]
+
+    # The same holds after the boundaries of blocks.
+    $sptk3/step -l 3000 -v 0 > $tmp/1
+    echo -1 | $sptk3/x2x +ad >> $tmp/1
+    $sptk3/step -l 3000 -v 0 >> $tmp/1
+    $sptk4/excite -p 4 $tmp/1 > $tmp/2
+    [ "$(wc -c < $tmp/2)" -eq 96000 ]
+}
+
 @test "excite: valgrind" {
     $sptk3/ramp -l 10 > $tmp/1
     run valgrind $sptk4/excite -p 2 $tmp/1
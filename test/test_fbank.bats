@@ -38,6 +38,35 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "fbank: multiple blocks" {
+    $sptk3/nrand -l 2400 |
+        $sptk3/mfcc -a 0 -c 0 -e 1 -l 8 -L 8 -w 1 -n 4 -m 3 > $tmp/1
+    $sptk3/nrand -l 2400 |
+        $sptk4/fbank -l 8 -n 4 -e 1 |
+        $sptk3/dct -l 4 |
+        $sptk3/bcp -l 4 -s 1 +d > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
+@test "fbank: single precision" {
+    $sptk4/nrand -l 16000 | $sptk4/frame -l 400 -p 160 |
+        $sptk4/window -l 400 -L 512 > $tmp/0
+    $sptk4/fbank -l 512 -n 20 -o 1 $tmp/0 > $tmp/1
+    $sptk4/x2x +df $tmp/0 | $sptk4/fbank -l 512 -n 20 -o 1 +f |
+        $sptk4/x2x +fd > $tmp/2
+    run $sptk4/aeq -t 1e-4 $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+    for q in 0 3; do
+        $sptk4/spec -l 512 -o $q $tmp/0 > $tmp/3
+        $sptk4/fbank -l 512 -n 20 -q $q $tmp/3 > $tmp/1
+        $sptk4/x2x +df $tmp/3 | $sptk4/fbank -l 512 -n 20 -q $q +f |
+            $sptk4/x2x +fd > $tmp/2
+        run $sptk4/aeq -t 1e-4 $tmp/1 $tmp/2
+        [ "$status" -eq 0 ]
+    done
+}
+
 @test "fbank: valgrind" {
     $sptk3/nrand -l 16 > $tmp/1
     run valgrind $sptk4/fbank -l 8 -n 4 -e 1e-6 $tmp/1
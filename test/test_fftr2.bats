@@ -59,6 +59,13 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "fftr2: reversibility of large matrix" {
+    $sptk3/nrand -l 262144 > $tmp/1
+    $sptk4/fftr2 -l 512 $tmp/1 | $sptk4/ifft2 -l 512 -o 1 > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
 @test "fftr2: valgrind" {
     $sptk3/nrand -l 512 > $tmp/1
     run valgrind $sptk4/fftr2 -l 8 $tmp/1
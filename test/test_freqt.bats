@@ -49,6 +49,14 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "freqt: multiple blocks" {
+    $sptk3/nrand -l 3000 > $tmp/1
+    $sptk3/freqt -m 9 -M 5 -a 0.1 -A 0.3 $tmp/1 > $tmp/2
+    $sptk4/freqt -m 9 -M 5 -a 0.1 -A 0.3 $tmp/1 > $tmp/3
+    run $sptk4/aeq $tmp/2 $tmp/3
+    [ "$status" -eq 0 ]
+}
+
 @test "freqt: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/freqt -m 9 -M 9 $tmp/1
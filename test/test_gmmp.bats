@@ -40,6 +40,32 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "gmmp: multiple blocks" {
+    $sptk3/nrand -s 1 -l 256 | $sptk3/gmm -l 4 -m 4 -b 19 > $tmp/1
+    $sptk3/nrand -s 1 -l 256 | $sptk4/gmm -l 4 -k 4 -i 20 > $tmp/2
+
+    $sptk3/nrand -s 2 -l 4004 | $sptk3/gmmp -l 4 -m 4 $tmp/1 > $tmp/3
+    $sptk3/nrand -s 2 -l 4004 | $sptk4/gmmp -l 4 -k 4 $tmp/2 > $tmp/4
+    run $sptk4/aeq $tmp/3 $tmp/4
+    [ "$status" -eq 0 ]
+}
+
+@test "gmmp: single precision" {
+    $sptk4/nrand -s 1 -l 2560 > $tmp/0
+    $sptk4/nrand -s 2 -l 4000 > $tmp/1
+    for opt in "" "-f"; do
+        # shellcheck disable=SC2086
+        $sptk4/gmm -l 4 -k 4 $opt $tmp/0 > $tmp/2
+        # shellcheck disable=SC2086
+        $sptk4/gmmp -l 4 -k 4 $opt $tmp/2 $tmp/1 > $tmp/3
+        # shellcheck disable=SC2086
+        $sptk4/x2x +df $tmp/1 | $sptk4/gmmp -l 4 -k 4 $opt $tmp/2 +f |
+            $sptk4/x2x +fd > $tmp/4
+        run $sptk4/aeq -t 1e-4 $tmp/3 $tmp/4
+        [ "$status" -eq 0 ]
+    done
+}
+
 @test "gmmp: valgrind" {
     $sptk3/nrand -s 1 -l 32 | $sptk4/gmm -l 2 -k 2 > $tmp/1
     $sptk3/nrand -s 2 -l 16 > $tmp/2
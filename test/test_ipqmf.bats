@@ -43,6 +43,14 @@ teardown() {
     done
 }
 
+@test "ipqmf: decimation" {
+    $sptk3/x2x +sd $data | $sptk4/pqmf -k 4 -o 1 > $tmp/1
+    $sptk4/interpolate -l 4 -p 4 $tmp/1 | $sptk4/ipqmf -k 4 > $tmp/2
+    $sptk4/ipqmf -k 4 -q 1 $tmp/1 > $tmp/3
+    run $sptk4/aeq $tmp/2 $tmp/3
+    [ "$status" -eq 0 ]
+}
+
 @test "ipqmf: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/ipqmf -k 2 -m 10 $tmp/1
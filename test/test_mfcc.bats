@@ -39,6 +39,15 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "mfcc: multiple blocks" {
+    $sptk3/nrand -l 2056 |
+        $sptk3/mfcc -a 0 -c 10 -e 1 -l 8 -L 8 -w 1 -n 6 -m 3 -E -0 > $tmp/1
+    $sptk3/nrand -l 2056 |
+        $sptk4/mfcc -c 10 -e 1 -l 8 -n 6 -m 3 -o 3 > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
 @test "mfcc: valgrind" {
     $sptk3/nrand -l 16 > $tmp/1
     run valgrind $sptk4/mfcc -l 8 -n 4 -m 3 $tmp/1
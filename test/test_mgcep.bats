@@ -41,6 +41,28 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "mgcep: warm start" {
+    $sptk3/nrand -s 2 -l 160 > $tmp/0
+    for g in 0 -0.5; do
+        $sptk4/mgcep -l 16 -m 4 -g $g -d 1e-6 $tmp/0 > $tmp/1
+        $sptk4/mgcep -l 16 -m 4 -g $g -d 1e-6 -w $tmp/0 > $tmp/2
+        run $sptk4/aeq -t 1e-4 $tmp/1 $tmp/2
+        [ "$status" -eq 0 ]
+    done
+}
+
+@test "mgcep: number of iterations" {
+    $sptk3/nrand -s 3 -l 16 > $tmp/0
+    for i in $(seq 10); do cat $tmp/0; done > $tmp/1
+    $sptk4/mgcep -l 16 -m 4 -d 1e-6 -I $tmp/2 $tmp/1 > /dev/null
+    $sptk4/mgcep -l 16 -m 4 -d 1e-6 -w -I $tmp/3 $tmp/1 > /dev/null
+    [ "$(wc -c < $tmp/2)" -eq 40 ]
+    [ "$(wc -c < $tmp/3)" -eq 40 ]
+    cold=$($sptk4/x2x +id $tmp/2 | $sptk4/vsum | $sptk4/x2x +di | $sptk4/x2x +ia)
+    warm=$($sptk4/x2x +id $tmp/3 | $sptk4/vsum | $sptk4/x2x +di | $sptk4/x2x +ia)
+    [ "$warm" -lt "$cold" ]
+}
+
 @test "mgcep: valgrind" {
     $sptk3/nrand -l 32 > $tmp/1
     run valgrind $sptk4/mgcep -l 16 -m 4 -i 3 $tmp/1
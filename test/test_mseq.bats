@@ -34,6 +34,13 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "mseq: multiple blocks" {
+    $sptk3/train -l 10001 -p 0 > $tmp/1
+    $sptk4/mseq -l 10001 > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
 @test "mseq: valgrind" {
     run valgrind $sptk4/mseq -l 10
     [ "$(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/')" -eq 0 ]
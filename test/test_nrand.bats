@@ -34,6 +34,13 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "nrand: multiple blocks" {
+    $sptk3/nrand -l 10001 -s 5 > $tmp/1
+    $sptk4/nrand -l 10001 -s 5 > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
 @test "nrand: valgrind" {
     run valgrind $sptk4/nrand -l 10
     [ "$(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/')" -eq 0 ]
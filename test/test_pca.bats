@@ -39,6 +39,30 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "pca: eigensolver" {
+    $sptk3/nrand -l 1024 > $tmp/0
+    $sptk4/pca -l 8 -n 4 -s 0 -v $tmp/1 $tmp/0 > /dev/null
+    for s in $(seq 1 2); do
+        $sptk4/pca -l 8 -n 4 -s "$s" -v $tmp/2 $tmp/0 > /dev/null
+        run $sptk4/aeq $tmp/1 $tmp/2
+        [ "$status" -eq 0 ]
+    done
+
+    # The randomized method searches a 14-dimensional subspace of the
+    # 64-dimensional space. Speech frames have dominant principal components,
+    # so it finds the same ones as the exact methods up to sign.
+    $sptk4/x2x +sd asset/data.short | $sptk4/frame -l 64 -p 16 > $tmp/0
+    $sptk4/pca -l 64 -n 4 -s 0 -v $tmp/1 $tmp/0 | $sptk4/sopr -ABS > $tmp/2
+    for s in $(seq 1 2); do
+        $sptk4/pca -l 64 -n 4 -s "$s" -v $tmp/3 $tmp/0 |
+            $sptk4/sopr -ABS > $tmp/4
+        run $sptk4/aeq $tmp/1 $tmp/3
+        [ "$status" -eq 0 ]
+        run $sptk4/aeq -t 1e-4 $tmp/2 $tmp/4
+        [ "$status" -eq 0 ]
+    done
+}
+
 @test "pca: valgrind" {
     $sptk3/nrand -l 32 > $tmp/1
     run valgrind $sptk4/pca -l 4 -n 2 $tmp/1
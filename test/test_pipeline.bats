@@ -0,0 +1,171 @@
+#!/usr/bin/env bats
+# ------------------------------------------------------------------------ #
+# Copyright 2021 SPTK Working Group                                        #
+#                                                                          #
+# Licensed under the Apache License, Version 2.0 (the "License");          #
+# you may not use this file except in compliance with the License.         #
+# You may obtain a copy of the License at                                  #
+#                                                                          #
+#     http://www.apache.org/licenses/LICENSE-2.0                           #
+#                                                                          #
+# Unless required by applicable law or agreed to in writing, software      #
+# distributed under the License is distributed on an "AS IS" BASIS,        #
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. #
+# See the License for the specific language governing permissions and      #
+# limitations under the License.                                           #
+# ------------------------------------------------------------------------ #
+
+sptk4=bin
+tmp=test_pipeline
+data=asset/data.short
+
+setup() {
+    mkdir -p $tmp
+}
+
+teardown() {
+    if [ -n "$pid" ]; then
+        kill "$pid"
+    fi
+    rm -rf $tmp
+}
+
+@test "pipeline: compatibility" {
+    $sptk4/x2x +sd $data > $tmp/0
+    desc=(
+        "frame -l 400 -p 80 | window -l 400 -L 512 |
+         mgcep -l 512 -m 24 -a 0.42 | delta -m 24 -r 1 1"
+        "frame -l 401 -p 80 -n 1 | window -l 401 -L 512 -w 1 -n 2 |
+         spec -l 512 -o 2 -e 1e-3"
+        "frame -l 512 | window -l 512 | mgcep -l 512 -m 12 -c 2 -o 3 |
+         delta -l 13 -d -0.5 0 0.5 -d 1 -2 1 | sopr -a 1"
+        "frame -l 7 -p 13"
+        "sopr -m 2 -ABS -LN"
+    )
+    for d in "${desc[@]}"; do
+        cmd=$(echo "$d" | tr -s "\n " " " | sed "s@| @| $sptk4/@g")
+        eval "$sptk4/$cmd" < $tmp/0 > $tmp/1
+        for q in 0 1 64; do
+            $sptk4/pipeline -q $q "$d" $tmp/0 > $tmp/2
+            run $sptk4/aeq $tmp/1 $tmp/2
+            [ "$status" -eq 0 ]
+        done
+    done
+}
+
+@test "pipeline: server" {
+    $sptk4/x2x +sd $data > $tmp/0
+    $sptk4/pipeline -s $tmp/sock -t 2 3>&- &
+    pid=$!
+    while [ ! -S $tmp/sock ]; do sleep 0.1; done
+
+    d="frame -l 400 -p 80 | window -l 400 -L 512 | mgcep -l 512 -m 24 -a 0.42"
+    $sptk4/pipeline "$d" $tmp/0 > $tmp/1
+    pids=()
+    for i in $(seq 1 4); do
+        $sptk4/pipeline -c $tmp/sock "$d" $tmp/0 > $tmp/2_$i &
+        pids+=($!)
+    done
+    wait "${pids[@]}"
+    run $sptk4/pipeline -c $tmp/sock "frame -l 256 | mgcep -l 512" $tmp/0
+    [ "$status" -ne 0 ]
+    $sptk4/step -l 4000 -v 0 > $tmp/3
+    run $sptk4/pipeline -c $tmp/sock "frame -l 512 | mgcep -l 512 -g -0.5" \
+        $tmp/3
+    [ "$status" -ne 0 ]
+    for i in $(seq 1 4); do
+        run $sptk4/aeq $tmp/1 $tmp/2_$i
+        [ "$status" -eq 0 ]
+    done
+}
+
+@test "pipeline: server limits" {
+    # A file other than socket is not overwritten.
+    echo test > $tmp/sock
+    run $sptk4/pipeline -s $tmp/sock
+    [ "$status" -ne 0 ]
+    [ "$(cat $tmp/sock)" = "test" ]
+    rm $tmp/sock
+
+    $sptk4/pipeline -s $tmp/sock -C 1 -M 1 3>&- &
+    pid=$!
+    while [ ! -S $tmp/sock ]; do sleep 0.1; done
+
+    # The socket of a running server is not overwritten.
+    run $sptk4/pipeline -s $tmp/sock
+    [ "$status" -ne 0 ]
+
+    # A request larger than the limit is rejected.
+    $sptk4/nrand -l 200000 > $tmp/0
+    run $sptk4/pipeline -c $tmp/sock "sopr -m 2" $tmp/0
+    [ "$status" -ne 0 ]
+
+    # An output larger than the limit is sent while it is computed.
+    $sptk4/nrand -l 8000 > $tmp/0
+    $sptk4/frame -l 256 -p 1 $tmp/0 > $tmp/1
+    $sptk4/pipeline -c $tmp/sock "frame -l 256 -p 1" $tmp/0 > $tmp/2
+    cmp $tmp/1 $tmp/2
+
+    # Stages removed from the cache are constructed again.
+    $sptk4/nrand -l 1000 > $tmp/0
+    for i in $(seq 1 2); do
+        for l in 32 64; do
+            d="frame -l $l | spec -l $l"
+            $sptk4/pipeline "$d" $tmp/0 > $tmp/1
+            $sptk4/pipeline -c $tmp/sock "$d" $tmp/0 > $tmp/2
+            run $sptk4/aeq $tmp/1 $tmp/2
+            [ "$status" -eq 0 ]
+        done
+    done
+
+    # The socket is removed when the server is terminated.
+    kill $pid
+    wait $pid
+    pid=
+    [ ! -e $tmp/sock ]
+}
+
+@test "pipeline: server timeout" {
+    $sptk4/pipeline -s $tmp/sock -t 1 -T 1 3>&- &
+    pid=$!
+    while [ ! -S $tmp/sock ]; do sleep 0.1; done
+
+    # A client which does not send its whole request does not block others.
+    (sleep 10 | $sptk4/pipeline -c $tmp/sock "sopr -m 2") 3>&- &
+    sleep 0.5
+    $sptk4/nrand -l 1000 > $tmp/0
+    $sptk4/sopr -m 2 $tmp/0 > $tmp/1
+    timeout 5 $sptk4/pipeline -c $tmp/sock "sopr -m 2" $tmp/0 > $tmp/2
+    cmp $tmp/1 $tmp/2
+}
+
+@test "pipeline: mismatched length" {
+    run $sptk4/pipeline "frame -l 256 | mgcep -l 512" $data
+    [ "$status" -ne 0 ]
+}
+
+@test "pipeline: failure of stage" {
+    # The analysis of the silent segment fails in the middle of the input.
+    $sptk4/nrand -l 4000 > $tmp/0
+    $sptk4/step -l 4000 -v 0 >> $tmp/0
+    $sptk4/nrand -l 4000 >> $tmp/0
+    d="frame -l 512 -p 80 | mgcep -l 512 -m 12 -g -0.5"
+    $sptk4/frame -l 512 -p 80 $tmp/0 |
+        $sptk4/mgcep -l 512 -m 12 -g -0.5 > $tmp/1 || true
+    for q in 0 4; do
+        run $sptk4/pipeline -q $q "$d" $tmp/0
+        [ "$status" -ne 0 ]
+        $sptk4/pipeline -q $q "$d" $tmp/0 > $tmp/2 || true
+        run $sptk4/aeq $tmp/1 $tmp/2
+        [ "$status" -eq 0 ]
+        run $sptk4/pipeline -q $q "$d | delta -m 12 -r 1 1" $tmp/0
+        [ "$status" -ne 0 ]
+    done
+}
+
+@test "pipeline: valgrind" {
+    $sptk4/nrand -l 1000 > $tmp/0
+    run valgrind $sptk4/pipeline "frame -l 32 | window -l 32 | spec -l 32" \
+        $tmp/0
+    [ "$(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/')" -eq 0 ]
+}
@@ -44,6 +44,16 @@ teardown() {
     done
 }
 
+@test "pqmf: decimation" {
+    $sptk3/x2x +sd $data > $tmp/1
+    for k in 3 4; do
+        $sptk4/pqmf -k $k $tmp/1 | $sptk4/decimate -l $k -p $k > $tmp/2
+        $sptk4/pqmf -k $k -o 1 $tmp/1 > $tmp/3
+        run $sptk4/aeq $tmp/2 $tmp/3
+        [ "$status" -eq 0 ]
+    done
+}
+
 @test "pqmf: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/pqmf -k 2 -m 10 $tmp/1
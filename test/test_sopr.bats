@@ -74,6 +74,60 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "sopr: multiple blocks" {
+    $sptk3/nrand -l 10000 | $sptk3/sopr -ABS > $tmp/0
+    $sptk3/sopr $tmp/0 -LN -EXP > $tmp/1
+    $sptk4/sopr $tmp/0 -LN -EXP > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+
+    $sptk3/ramp -l 10000 | $sptk3/sopr -m 0.01 -FIX > $tmp/0
+    $sptk3/sopr $tmp/0 -magic 0 > $tmp/1
+    $sptk4/sopr $tmp/0 -magic 0 -LN -EXP > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
+@test "sopr: approximation" {
+    # Exponential over the whole range including underflow and overflow.
+    $sptk4/ramp -s -746 -e 710 -t 0.013 > $tmp/0
+    $sptk4/sopr $tmp/0 -EXP > $tmp/1
+    $sptk4/sopr $tmp/0 -FASTEXP > $tmp/2
+    run $sptk4/aeq -e 1 -t 2.3e-16 $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+
+    # Logarithm from the smallest denormalized number to the largest number.
+    $sptk4/ramp -s -1074 -e 1024 -t 0.0137 | $sptk4/sopr -POW2 > $tmp/0
+    $sptk4/ramp -s 0.5 -e 2 -t 1e-5 >> $tmp/0
+    $sptk4/sopr $tmp/0 -LN > $tmp/1
+    $sptk4/sopr $tmp/0 -FASTLN > $tmp/2
+    run $sptk4/aeq -e 1 -t 4.5e-16 $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+
+    # Special values must be identical to those of libm.
+    echo 0 -0 | $sptk4/x2x +ad | $sptk4/sopr -INV > $tmp/0
+    echo -1 | $sptk4/x2x +ad | $sptk4/sopr -SQRT >> $tmp/0
+    echo 0 -0 -1 4.9e-324 1e-310 | $sptk4/x2x +ad >> $tmp/0
+    $sptk4/sopr $tmp/0 -LN > $tmp/1
+    $sptk4/sopr $tmp/0 -FASTLN > $tmp/2
+    cmp $tmp/1 $tmp/2
+    echo -800 -740 710 800 | $sptk4/x2x +ad >> $tmp/0
+    $sptk4/sopr $tmp/0 -EXP > $tmp/1
+    $sptk4/sopr $tmp/0 -FASTEXP > $tmp/2
+    cmp $tmp/1 $tmp/2
+
+    # Scalar path taken by blocks containing magic numbers.
+    $sptk4/ramp -l 10000 | $sptk4/sopr -m 0.01 > $tmp/0
+    $sptk4/sopr $tmp/0 -magic 0 -LN > $tmp/1
+    $sptk4/sopr $tmp/0 -magic 0 -FASTLN > $tmp/2
+    run $sptk4/aeq -e 1 -t 4.5e-16 $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+    $sptk4/sopr $tmp/0 -magic 0 -EXP > $tmp/1
+    $sptk4/sopr $tmp/0 -magic 0 -FASTEXP > $tmp/2
+    run $sptk4/aeq -e 1 -t 2.3e-16 $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
 @test "sopr: valgrind" {
     $sptk3/nrand -l 20 > $tmp/1
     run valgrind $sptk4/sopr -m 2 $tmp/1
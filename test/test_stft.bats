@@ -0,0 +1,65 @@
+#!/usr/bin/env bats
+# ------------------------------------------------------------------------ #
+# Copyright 2021 SPTK Working Group                                        #
+#                                                                          #
+# Licensed under the Apache License, Version 2.0 (the "License");          #
+# you may not use this file except in compliance with the License.         #
+# You may obtain a copy of the License at                                  #
+#                                                                          #
+#     http://www.apache.org/licenses/LICENSE-2.0                           #
+#                                                                          #
+# Unless required by applicable law or agreed to in writing, software      #
+# distributed under the License is distributed on an "AS IS" BASIS,        #
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. #
+# See the License for the specific language governing permissions and      #
+# limitations under the License.                                           #
+# ------------------------------------------------------------------------ #
+
+sptk4=bin
+tmp=test_stft
+
+setup() {
+    mkdir -p $tmp
+}
+
+teardown() {
+    rm -rf $tmp
+}
+
+@test "stft: identity" {
+    $sptk4/nrand -l 2000 > $tmp/0
+    # Options for frame, window, and spec.
+    opt1=("-l 400 -p 80" "-l 512 -p 128 -n 1" "-l 401 -p 1000" "-l 7 -p 3")
+    opt2=("-l 400 -L 512" "-l 512" "-l 401 -L 1024 -w 2 -n 2" "-l 7 -L 8 -n 0")
+    opt3=("-l 512" "-l 512 -o 3" "-l 1024 -e 1e-6" "-l 8 -o 2")
+    opt4=("-L 512" "-o 3" "-L 1024 -w 2 -N 2 -e 1e-6" "-L 8 -N 0 -o 2")
+    for i in $(seq 0 3); do
+        # shellcheck disable=SC2086
+        $sptk4/frame ${opt1[$i]} $tmp/0 | $sptk4/window ${opt2[$i]} |
+            $sptk4/spec ${opt3[$i]} > $tmp/1
+        # shellcheck disable=SC2086
+        $sptk4/stft ${opt1[$i]} ${opt4[$i]} $tmp/0 > $tmp/2
+        run $sptk4/aeq $tmp/1 $tmp/2
+        [ "$status" -eq 0 ]
+    done
+}
+
+@test "stft: single precision" {
+    $sptk4/nrand -l 2000 > $tmp/0
+    opt=("-l 400 -L 512 -p 80 -o 2" "-l 401 -L 1024 -p 100 -n 1 -w 2 -o 3")
+    for i in $(seq 0 1); do
+        # shellcheck disable=SC2086
+        $sptk4/stft ${opt[$i]} $tmp/0 > $tmp/1
+        # shellcheck disable=SC2086
+        $sptk4/x2x +df $tmp/0 | $sptk4/stft ${opt[$i]} +f |
+            $sptk4/x2x +fd > $tmp/2
+        run $sptk4/aeq -t 1e-4 $tmp/1 $tmp/2
+        [ "$status" -eq 0 ]
+    done
+}
+
+@test "stft: valgrind" {
+    $sptk4/nrand -l 100 > $tmp/0
+    run valgrind $sptk4/stft -l 16 -p 4 $tmp/0
+    [ "$(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/')" -eq 0 ]
+}
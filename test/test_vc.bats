@@ -77,6 +77,39 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "vc: multiple blocks" {
+    # Make GMM of static features.
+    $sptk3/nrand -s 1 -l 4000 | $sptk4/gmm -l 8 -k 4 > $tmp/1
+    $sptk3/nrand -s 1 -l 4000 | $sptk4/gmm -l 8 -k 4 -f > $tmp/2
+
+    # Make source of 605 frames including magic numbers at frames 254-259
+    # and 511-512, which straddle the boundaries of conversion blocks.
+    m="1e10 1e10 1e10 1e10"
+    $sptk3/nrand -s 2 -l 1016 > $tmp/3
+    echo $m $m $m $m $m $m | $sptk3/x2x +ad >> $tmp/3
+    $sptk3/nrand -s 3 -l 1004 >> $tmp/3
+    echo $m $m | $sptk3/x2x +ad >> $tmp/3
+    $sptk3/nrand -s 4 -l 368 >> $tmp/3
+
+    # Without dynamic features, each frame is converted independently. The
+    # output must not depend on where the block boundaries are.
+    for opt in "$tmp/1" "$tmp/2 -f"; do
+        $sptk4/vc -l 4 -L 4 -k 4 -magic 1e10 $opt $tmp/3 > $tmp/4
+        $sptk4/bcut +d -l 4 -e 199 $tmp/3 |
+            $sptk4/vc -l 4 -L 4 -k 4 -magic 1e10 $opt > $tmp/5
+        $sptk4/bcut +d -l 4 -s 200 $tmp/3 |
+            $sptk4/vc -l 4 -L 4 -k 4 -magic 1e10 $opt >> $tmp/5
+        run $sptk4/aeq $tmp/4 $tmp/5
+        [ "$status" -eq 0 ]
+
+        $sptk4/bcut +d -l 4 -s 254 -e 259 $tmp/4 > $tmp/6
+        $sptk4/bcut +d -l 4 -s 511 -e 512 $tmp/4 >> $tmp/6
+        echo $m $m $m $m $m $m $m $m | $sptk3/x2x +ad > $tmp/7
+        run $sptk4/aeq $tmp/6 $tmp/7
+        [ "$status" -eq 0 ]
+    done
+}
+
 @test "vc: valgrind" {
     $sptk4/gmm $tmp/0 -l 10 -k 2 > $tmp/1
     $sptk3/nrand -l 20 | $sptk3/delta -d -0.5 0 0.5 -l 3 > $tmp/2
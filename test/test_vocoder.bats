@@ -0,0 +1,78 @@
+#!/usr/bin/env bats
+# ------------------------------------------------------------------------ #
+# Copyright 2021 SPTK Working Group                                        #
+#                                                                          #
+# Licensed under the Apache License, Version 2.0 (the "License");          #
+# you may not use this file except in compliance with the License.         #
+# You may obtain a copy of the License at                                  #
+#                                                                          #
+#     http://www.apache.org/licenses/LICENSE-2.0                           #
+#                                                                          #
+# Unless required by applicable law or agreed to in writing, software      #
+# distributed under the License is distributed on an "AS IS" BASIS,        #
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. #
+# See the License for the specific language governing permissions and      #
+# limitations under the License.                                           #
+# ------------------------------------------------------------------------ #
+
+sptk4=bin
+tmp=test_vocoder
+data=asset/data.short
+
+setup() {
+    mkdir -p $tmp
+}
+
+teardown() {
+    rm -rf $tmp
+}
+
+@test "vocoder: identity" {
+    $sptk4/x2x +sd $data | $sptk4/frame -l 400 -p 80 |
+        $sptk4/window -l 400 -L 512 |
+        $sptk4/mgcep -l 512 -m 24 -a 0.42 > $tmp/mgc
+    $sptk4/x2x +sd $data | $sptk4/pitch -s 16 -p 80 -o 0 > $tmp/pit
+
+    # Options for excite and those for mglsadf.
+    opt1=("" "-n" "" "-i 0 -s 3 -n")
+    opt2=("-P 7" "-P 7 -t" "-c 2 -k" "-i 0")
+    for o in $(seq 0 3); do
+        # shellcheck disable=SC2086
+        $sptk4/excite -p 80 ${opt1[$o]} $tmp/pit |
+            $sptk4/mglsadf -m 24 -a 0.42 -p 80 ${opt2[$o]} $tmp/mgc > $tmp/1
+        # shellcheck disable=SC2086
+        $sptk4/vocoder -m 24 -a 0.42 -p 80 ${opt1[$o]} ${opt2[$o]} \
+            $tmp/mgc $tmp/pit > $tmp/2
+        run $sptk4/aeq $tmp/1 $tmp/2
+        [ "$status" -eq 0 ]
+    done
+}
+
+@test "vocoder: postfilter" {
+    $sptk4/nrand -l 260 -s 2 | $sptk4/sopr -m 0.1 > $tmp/mgc
+    $sptk4/step -l 10 -v 80 > $tmp/pit
+
+    $sptk4/mcpf -m 25 -a 0.35 -b 0.2 $tmp/mgc > $tmp/0
+    $sptk4/excite $tmp/pit | $sptk4/mglsadf $tmp/0 > $tmp/1
+    $sptk4/vocoder -b 0.2 $tmp/mgc $tmp/pit > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
+@test "vocoder: short output" {
+    $sptk4/nrand -l 260 -s 2 | $sptk4/sopr -m 0.01 > $tmp/mgc
+    $sptk4/step -l 10 -v 80 > $tmp/pit
+
+    $sptk4/excite $tmp/pit | $sptk4/mglsadf $tmp/mgc |
+        $sptk4/x2x +ds -r > $tmp/1
+    $sptk4/vocoder -o 1 $tmp/mgc $tmp/pit > $tmp/2
+    run cmp $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+}
+
+@test "vocoder: valgrind" {
+    $sptk4/nrand -l 52 > $tmp/1
+    $sptk4/step -l 2 -v 10 > $tmp/2
+    run valgrind $sptk4/vocoder -p 4 $tmp/1 $tmp/2
+    [ "$(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/')" -eq 0 ]
+}
@@ -64,6 +64,25 @@ teardown() {
     [ "$status" -eq 0 ]
 }
 
+@test "vstat: merge" {
+    $sptk3/nrand -l 100 > $tmp/0
+    $sptk3/bcut +d -s 0 -e 39 $tmp/0 > $tmp/0_1
+    $sptk3/bcut +d -s 40 $tmp/0 > $tmp/0_2
+
+    # Multiple threads:
+    $sptk4/vstat -l 2 $tmp/0 > $tmp/1
+    $sptk4/vstat -l 2 $tmp/0 -n 3 > $tmp/2
+    run $sptk4/aeq $tmp/1 $tmp/2
+    [ "$status" -eq 0 ]
+
+    # Merge of statistics:
+    $sptk4/vstat -l 2 $tmp/0_1 -o 7 > $tmp/3
+    $sptk4/vstat -l 2 $tmp/0_2 -o 7 >> $tmp/3
+    $sptk4/vstat -l 2 $tmp/3 -s > $tmp/4
+    run $sptk4/aeq $tmp/1 $tmp/4
+    [ "$status" -eq 0 ]
+}
+
 @test "vstat: valgrind" {
     $sptk3/nrand -l 10 > $tmp/1
     run valgrind $sptk4/vstat $tmp/1